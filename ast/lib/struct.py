@@ -1,6 +1,6 @@
 from __future__ import annotations
 
-from typing import List
+from typing import Dict, List, Optional, Tuple
 
 import logging
 
@@ -8,10 +8,30 @@ from jinja2 import Environment
 
 from .comment_commands import CommentCommands
 from .member import Member
+from .membertype import MemberType
 
 log = logging.getLogger(__name__)
 
 
+class KeyCase:
+    """Members whose JSON keys have the same length and the same byte at the group's position"""
+
+    def __init__(self, char: Optional[str]) -> None:
+        self.char = char
+        # (index of the member in the struct, member)
+        self.members: List[Tuple[int, Member]] = []
+
+
+class KeyGroup:
+    """Members whose JSON keys have the same length"""
+
+    def __init__(self, length: int) -> None:
+        self.length = length
+        # The first position at which the keys differ, or None if there's only one key
+        self.position: Optional[int] = None
+        self.cases: List[KeyCase] = []
+
+
 class Struct:
     def __init__(self, name: str) -> None:
         self.name = name
@@ -27,6 +47,46 @@ class Struct:
         else:
             return self.name
 
+    @property
+    def key_groups(self) -> List[KeyGroup]:
+        """
+        The members grouped by the length of their JSON key, then by the first byte
+        at which those keys differ, so a key can be matched with two switches
+        and (usually) one comparison
+        """
+        by_length: Dict[int, List[Tuple[int, Member]]] = {}
+        for index, member in enumerate(self.members):
+            by_length.setdefault(len(member.json_name), []).append((index, member))
+
+        groups: List[KeyGroup] = []
+        for length, members in sorted(by_length.items()):
+            group = KeyGroup(length)
+
+            keys = [member.json_name for _, member in members]
+            if len(set(keys)) > 1:
+                group.position = next(i for i in range(length) if len(set(key[i] for key in keys)) > 1)
+
+            cases: Dict[Optional[str], KeyCase] = {}
+            for index, member in members:
+                char = None if group.position is None else member.json_name[group.position]
+                if char not in cases:
+                    cases[char] = KeyCase(char)
+                    group.cases.append(cases[char])
+                cases[char].members.append((index, member))
+
+            groups.append(group)
+
+        return groups
+
+    @property
+    def required_mask(self) -> int:
+        """Bit mask of the members that must be present in the JSON object"""
+        mask = 0
+        for index, member in enumerate(self.members):
+            if member.member_type in (MemberType.BASIC, MemberType.VECTOR):
+                mask |= 1 << index
+        return mask
+
     def __eq__(self, other: object) -> bool:
         if isinstance(other, self.__class__):
             if self.name != other.name:
@@ -172,4 +172,22 @@ def test_string():
     assert s.members[3].type_name == "std::string"
 
 
+def test_key_groups():
+    structs = build_structs("lib/tests/resources/string.hpp")
+    assert len(structs) == 1
+
+    s = structs[0]
+
+    # a, b & c are required, d is optional
+    assert s.required_mask == 0b0111
+
+    groups = s.key_groups
+    assert len(groups) == 1
+
+    assert groups[0].length == 1
+    assert groups[0].position == 0
+    assert [case.char for case in groups[0].cases] == ["a", "b", "c", "d"]
+    assert [index for index, _ in groups[0].cases[2].members] == [2]
+
+
 init_clang()
@@ -0,0 +1,55 @@
+#include "twitch-eventsub-ws/chrono.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace eventsub;
+
+namespace {
+
+const std::string_view TIMESTAMPS[] = {
+    "2023-05-14T12:31:47.995298776Z",
+    "2019-11-16T10:11:12.464757833Z",
+    "2023-07-19T10:11:12.634234626Z",
+    "2023-05-14T12:31:47Z",
+};
+
+void BM_ParseISO8601DateParse(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        for (auto raw : TIMESTAMPS)
+        {
+            // How timestamps were parsed before tryParseISO8601
+            std::istringstream in{std::string{raw}};
+            std::chrono::system_clock::time_point tp;
+            in >> date::parse("%FT%TZ", tp);
+            benchmark::DoNotOptimize(tp);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(std::size(TIMESTAMPS)));
+}
+BENCHMARK(BM_ParseISO8601DateParse);
+
+void BM_ParseISO8601(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        for (auto raw : TIMESTAMPS)
+        {
+            auto tp = parseISO8601(raw);
+            benchmark::DoNotOptimize(tp);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(std::size(TIMESTAMPS)));
+}
+BENCHMARK(BM_ParseISO8601);
+
+}  // namespace
@@ -0,0 +1,132 @@
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/container_hash/hash.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace eventsub::messages;
+
+namespace {
+
+using SubscriptionKey = std::pair<std::string, std::string>;
+
+// The metadata of a stream of notifications, as owned by messages::Metadata
+const std::vector<SubscriptionKey> &notifications()
+{
+    static const std::vector<SubscriptionKey> keys{
+        {"channel.chat.message", "1"},
+        {"channel.chat.message", "1"},
+        {"channel.chat.notification", "1"},
+        {"channel.chat.message", "1"},
+        {"channel.ban", "1"},
+        {"channel.update", "1"},
+        {"stream.online", "1"},
+        {"stream.offline", "1"},
+        {"channel.follow", "2"},
+    };
+    return keys;
+}
+
+const std::vector<std::string> &messageTypes()
+{
+    static const std::vector<std::string> types{
+        "notification",      "notification",    "session_keepalive",
+        "notification",      "session_welcome", "session_reconnect",
+        "revocation",        "notification",    "unknown",
+        "session_keepalive",
+    };
+    return types;
+}
+
+// How subscriptions were looked up before the perfect hash tables: a hash map
+// keyed by a pair of strings built from the metadata
+const std::unordered_map<SubscriptionKey, Subscription,
+                         boost::hash<SubscriptionKey>>
+    OLD_SUBSCRIPTIONS{
+        {{"channel.ban", "1"}, Subscription::ChannelBanV1},
+        {{"stream.online", "1"}, Subscription::StreamOnlineV1},
+        {{"stream.offline", "1"}, Subscription::StreamOfflineV1},
+        {{"channel.chat.notification", "1"},
+         Subscription::ChannelChatNotificationV1},
+        {{"channel.update", "1"}, Subscription::ChannelUpdateV1},
+        {{"channel.chat.message", "1"}, Subscription::ChannelChatMessageV1},
+    };
+
+const std::unordered_map<std::string, MessageType> OLD_MESSAGE_TYPES{
+    {"session_welcome", MessageType::SessionWelcome},
+    {"session_keepalive", MessageType::SessionKeepalive},
+    {"session_reconnect", MessageType::SessionReconnect},
+    {"notification", MessageType::Notification},
+    {"revocation", MessageType::Revocation},
+};
+
+void BM_SubscriptionUnorderedMap(benchmark::State &state)
+{
+    const auto &keys = notifications();
+    for (auto _ : state)
+    {
+        for (const auto &[type, version] : keys)
+        {
+            auto it = OLD_SUBSCRIPTIONS.find({type, version});
+            benchmark::DoNotOptimize(it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(keys.size()));
+}
+BENCHMARK(BM_SubscriptionUnorderedMap);
+
+void BM_SubscriptionPerfectHash(benchmark::State &state)
+{
+    const auto &keys = notifications();
+    for (auto _ : state)
+    {
+        for (const auto &[type, version] : keys)
+        {
+            auto subscription = parseSubscription(type, version);
+            benchmark::DoNotOptimize(subscription);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(keys.size()));
+}
+BENCHMARK(BM_SubscriptionPerfectHash);
+
+void BM_MessageTypeUnorderedMap(benchmark::State &state)
+{
+    const auto &types = messageTypes();
+    for (auto _ : state)
+    {
+        for (const auto &type : types)
+        {
+            auto it = OLD_MESSAGE_TYPES.find(type);
+            benchmark::DoNotOptimize(it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(types.size()));
+}
+BENCHMARK(BM_MessageTypeUnorderedMap);
+
+void BM_MessageTypePerfectHash(benchmark::State &state)
+{
+    const auto &types = messageTypes();
+    for (auto _ : state)
+    {
+        for (const auto &type : types)
+        {
+            auto messageType = parseMessageType(type);
+            benchmark::DoNotOptimize(messageType);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(types.size()));
+}
+BENCHMARK(BM_MessageTypePerfectHash);
+
+}  // namespace
@@ -0,0 +1,138 @@
+#include "support/allocation-counter.hpp"
+#include "support/corpus.hpp"
+#include "support/listeners.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/legacy-listener.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * How many bytes are copied to hand each sample message to a listener.
+ *
+ * Copies are measured as the bytes allocated during the callback, since
+ * every deep copy of a payload allocates its strings & vectors
+ **/
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+
+namespace {
+
+struct Event {
+    messages::Metadata metadata;
+    chat::Payload payload;
+};
+
+const std::vector<Event> &events()
+{
+    static const auto corpus = [] {
+        std::vector<Event> events;
+        sax::Parser parser;
+        for (const auto &frame : test::loadChatMessageFrames())
+        {
+            messages::MetadataView metadata;
+            detail::readMetadata(frame, parser, metadata);
+            auto payload = detail::parsePayload<chat::Payload>(frame, parser);
+            events.push_back({metadata.toMetadata(), std::move(*payload)});
+        }
+        return events;
+    }();
+    return corpus;
+}
+
+// Keeps the last chat message it was given, like a real listener would
+class KeepingLegacyListener final : public test::NullLegacyListener
+{
+public:
+    void onChannelChatMessage(messages::Metadata metadata,
+                              chat::Payload payload) override
+    {
+        this->lastMetadata = std::move(metadata);
+        this->last = std::move(payload);
+    }
+
+    std::optional<messages::Metadata> lastMetadata;
+    std::optional<chat::Payload> last;
+};
+
+class KeepingListener final : public test::NullListener
+{
+public:
+    void onChannelChatMessage(const messages::Metadata & /*metadata*/,
+                              chat::Payload &&payload) override
+    {
+        this->last = std::move(payload);
+    }
+
+    std::optional<chat::Payload> last;
+};
+
+template <typename Deliver>
+void measureDelivery(benchmark::State &state, Deliver deliver)
+{
+    std::size_t bytes = 0;
+    std::size_t copies = 0;
+    std::size_t messages = 0;
+
+    for (auto _ : state)
+    {
+        // Fresh payloads to hand over, as if they had just been parsed
+        state.PauseTiming();
+        auto batch = events();
+        state.ResumeTiming();
+
+        for (auto &event : batch)
+        {
+            const test::AllocationCounter counter;
+            deliver(event);
+            bytes += counter.bytes();
+            copies += counter.allocations();
+            messages++;
+        }
+    }
+
+    state.counters["bytes_copied_per_message"] =
+        static_cast<double>(bytes) / static_cast<double>(messages);
+    state.counters["allocations_per_message"] =
+        static_cast<double>(copies) / static_cast<double>(messages);
+}
+
+// How the session called listeners before: everything by value, copied from
+// the session's own metadata & payload
+void BM_DeliverByValue(benchmark::State &state)
+{
+    KeepingLegacyListener listener;
+    measureDelivery(state, [&](const Event &event) {
+        listener.onChannelChatMessage(event.metadata, event.payload);
+    });
+}
+BENCHMARK(BM_DeliverByValue);
+
+// An old listener behind the adapter: the payload is moved, only the
+// metadata is copied
+void BM_DeliverLegacyAdapter(benchmark::State &state)
+{
+    LegacyListenerAdapter adapter(std::make_unique<KeepingLegacyListener>());
+    measureDelivery(state, [&](Event &event) {
+        adapter.onChannelChatMessage(event.metadata, std::move(event.payload));
+    });
+}
+BENCHMARK(BM_DeliverLegacyAdapter);
+
+void BM_DeliverByReference(benchmark::State &state)
+{
+    KeepingListener listener;
+    measureDelivery(state, [&](Event &event) {
+        listener.onChannelChatMessage(event.metadata, std::move(event.payload));
+    });
+}
+BENCHMARK(BM_DeliverByReference);
+
+}  // namespace
@@ -0,0 +1,73 @@
+#include "twitch-eventsub-ws/pipeline.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/corpus.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * How many notifications a session gets through with 1-8 workers.
+ *
+ * The chat messages of the corpus are replayed over a local WebSocket, with
+ * their condition spread across many broadcasters so every worker gets its
+ * share
+ **/
+
+using namespace eventsub;
+
+namespace {
+
+constexpr std::size_t BROADCASTERS = 64;
+constexpr std::size_t FRAMES_PER_ITERATION = 1024;
+
+void BM_PipelineThroughput(benchmark::State &state)
+{
+    const auto events = test::loadChatMessageEvents();
+
+    test::ConnectedSession<test::CountingListener> session;
+    session->setPipeline({
+        .threads = static_cast<std::size_t>(state.range(0)),
+        .queueCapacity = 256,
+        .overflow = OverflowPolicy::Block,
+    });
+    if (!session.connect())
+    {
+        state.SkipWithError("The session didn't connect");
+        return;
+    }
+
+    // Message IDs have to be unique, or the frames are dropped as duplicates
+    std::size_t sent = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < FRAMES_PER_ITERATION; i++, sent++)
+        {
+            session.connection->send(test::notificationFrame(
+                "bench-" + std::to_string(sent), "channel.chat.message",
+                std::to_string(1001 + (sent % BROADCASTERS)),
+                events[sent % events.size()]));
+        }
+        session.listener.waitFor(sent);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+    state.counters["dropped"] =
+        static_cast<double>(session->getPipelineStats().droppedFrames);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PipelineThroughput)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
@@ -0,0 +1,116 @@
+#include "twitch-eventsub-ws/broadcaster-router.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+struct Channel {
+    std::uint64_t broadcasterID;
+};
+
+using Router = BasicBroadcasterRouter<Channel>;
+
+constexpr std::uint64_t FIRST_ID = 11'148'817;
+
+// The broadcasters of the notifications, in a random order
+std::vector<std::uint64_t> lookups(std::size_t channels)
+{
+    std::vector<std::uint64_t> ids;
+    for (std::size_t i = 0; i < 4096; i++)
+    {
+        ids.push_back(FIRST_ID + (i * 7919) % channels);
+    }
+    std::shuffle(ids.begin(), ids.end(), std::minstd_rand{42});
+    return ids;
+}
+
+void BM_RouterFind(benchmark::State &state)
+{
+    const auto channels = static_cast<std::size_t>(state.range(0));
+
+    Router router{channels};
+    for (std::uint64_t i = 0; i < channels; i++)
+    {
+        router.add(FIRST_ID + i, std::make_unique<Channel>(FIRST_ID + i));
+    }
+    const auto ids = lookups(channels);
+
+    for (auto _ : state)
+    {
+        for (auto id : ids)
+        {
+            Router::Reader reader{router};
+            benchmark::DoNotOptimize(router.find(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(ids.size()));
+}
+BENCHMARK(BM_RouterFind)->Arg(100)->Arg(10'000)->Arg(100'000);
+
+// How listeners looked their channel up before the router: a hash map keyed
+// by the broadcasterUserID string of the payload
+void BM_StringMapFind(benchmark::State &state)
+{
+    const auto channels = static_cast<std::size_t>(state.range(0));
+
+    std::unordered_map<std::string, std::unique_ptr<Channel>> map;
+    for (std::uint64_t i = 0; i < channels; i++)
+    {
+        map.emplace(std::to_string(FIRST_ID + i),
+                    std::make_unique<Channel>(FIRST_ID + i));
+    }
+
+    std::vector<std::string> ids;
+    for (auto id : lookups(channels))
+    {
+        ids.push_back(std::to_string(id));
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto &id : ids)
+        {
+            benchmark::DoNotOptimize(map.find(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(ids.size()));
+}
+BENCHMARK(BM_StringMapFind)->Arg(100)->Arg(10'000)->Arg(100'000);
+
+// Channels joining & leaving a full router, including the rehashes that
+// reclaim the slots of the ones that left
+void BM_RouterChurn(benchmark::State &state)
+{
+    const auto channels = static_cast<std::size_t>(state.range(0));
+
+    Router router{channels};
+    for (std::uint64_t i = 0; i < channels / 2; i++)
+    {
+        router.add(FIRST_ID + i, std::make_unique<Channel>(FIRST_ID + i));
+    }
+
+    auto next = FIRST_ID + channels / 2;
+    for (auto _ : state)
+    {
+        router.add(next, std::make_unique<Channel>(next));
+        router.remove(next - channels / 2);
+        router.collect();
+        next++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RouterChurn)->Arg(100)->Arg(10'000)->Arg(100'000);
+
+}  // namespace
@@ -0,0 +1,137 @@
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include "support/corpus.hpp"
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-message-v1.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/json.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Parses the sample messages with the JSON parser the library was built with
+ * (see TWITCH_EVENTSUB_WS_USE_SIMDJSON)
+ **/
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+
+namespace {
+
+const std::vector<std::string> &frames()
+{
+    static const auto corpus = test::loadChatMessageFrames();
+    return corpus;
+}
+
+void setProcessed(benchmark::State &state)
+{
+    std::int64_t bytes = 0;
+    for (const auto &frame : frames())
+    {
+        bytes += static_cast<std::int64_t>(frame.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(frames().size()));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void BM_ReadMetadata(benchmark::State &state)
+{
+    sax::Parser parser;
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames())
+        {
+            messages::MetadataView metadata;
+            auto ok = detail::readMetadata(frame, parser, metadata);
+            benchmark::DoNotOptimize(ok);
+        }
+    }
+    setProcessed(state);
+}
+BENCHMARK(BM_ReadMetadata);
+
+void BM_ReadBroadcasterID(benchmark::State &state)
+{
+    sax::Parser parser;
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames())
+        {
+            auto id = readBroadcasterID(frame, parser);
+            benchmark::DoNotOptimize(id);
+        }
+    }
+    setProcessed(state);
+}
+BENCHMARK(BM_ReadBroadcasterID);
+
+void BM_ParsePayload(benchmark::State &state)
+{
+    sax::Parser parser;
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames())
+        {
+            auto payload = detail::parsePayload<chat::Payload>(frame, parser);
+            benchmark::DoNotOptimize(payload);
+        }
+    }
+    setProcessed(state);
+}
+BENCHMARK(BM_ParsePayload);
+
+// Everything a filtered session reads from each notification
+void BM_Frame(benchmark::State &state)
+{
+    sax::Parser parser;
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames())
+        {
+            messages::MetadataView metadata;
+            auto ok = detail::readMetadata(frame, parser, metadata);
+            benchmark::DoNotOptimize(ok);
+
+            auto id = readBroadcasterID(frame, parser);
+            benchmark::DoNotOptimize(id);
+
+            auto payload = detail::parsePayload<chat::Payload>(frame, parser);
+            benchmark::DoNotOptimize(payload);
+        }
+    }
+    setProcessed(state);
+}
+BENCHMARK(BM_Frame);
+
+// How messages were parsed before the SAX parsers
+void BM_FrameDOM(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames())
+        {
+            const auto jv = boost::json::parse(frame);
+            const auto &root = jv.as_object();
+
+            auto metadata = boost::json::try_value_to<messages::Metadata>(
+                root.at("metadata"));
+            benchmark::DoNotOptimize(metadata);
+
+            auto payload =
+                boost::json::try_value_to<chat::Payload>(root.at("payload"));
+            benchmark::DoNotOptimize(payload);
+        }
+    }
+    setProcessed(state);
+}
+BENCHMARK(BM_FrameDOM);
+
+}  // namespace
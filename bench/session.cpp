@@ -0,0 +1,68 @@
+#include "twitch-eventsub-ws/session.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/corpus.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+#include "twitch-eventsub-ws/coroutine-session.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * What each frame costs the callback-based Session compared to the
+ * CoroutineSession, with the corpus replayed over a local WebSocket
+ **/
+
+using namespace eventsub;
+
+namespace {
+
+constexpr std::size_t FRAMES_PER_ITERATION = 256;
+
+// Replay the corpus to a session of SessionT
+template <typename SessionT>
+void replay(benchmark::State &state)
+{
+    const auto events = test::loadChatMessageEvents();
+
+    test::ConnectedSession<test::CountingListener, SessionT> session;
+    if (!session.connect())
+    {
+        state.SkipWithError("The session didn't connect");
+        return;
+    }
+
+    // Like Twitch, give every notification an ID of its own
+    std::size_t sent = 0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < FRAMES_PER_ITERATION; i++, sent++)
+        {
+            session.connection->send(test::chatMessageFrame(
+                "bench-" + std::to_string(sent), events[sent % events.size()]));
+        }
+        session.listener.waitFor(sent);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(sent));
+}
+
+void BM_CallbackSession(benchmark::State &state)
+{
+    replay<Session>(state);
+}
+
+void BM_CoroutineSession(benchmark::State &state)
+{
+    replay<CoroutineSession>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_CallbackSession)->UseRealTime();
+BENCHMARK(BM_CoroutineSession)->UseRealTime();
@@ -0,0 +1,86 @@
+#include "support/corpus.hpp"
+#include "support/listeners.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/listener.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * What it costs to hand the sample messages to a listener through its vtable
+ * (handleMessage<Listener>), compared to calling a final listener directly
+ * (handleMessage<FinalListener>).
+ *
+ * Both go to the same listener object, only the type dispatch is templated
+ * on differs
+ **/
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+
+namespace {
+
+class FinalListener final : public test::NullListener
+{
+public:
+    explicit FinalListener(bool _wantsJSON)
+        : wantsJSON(_wantsJSON)
+    {
+    }
+
+    bool wantsNotificationJSON() const override
+    {
+        return this->wantsJSON;
+    }
+
+    void onChannelChatMessage(const messages::Metadata & /*metadata*/,
+                              chat::Payload &&payload) override
+    {
+        this->bytes += payload.event.message.text.size();
+    }
+
+    const bool wantsJSON;
+    std::size_t bytes = 0;
+};
+
+template <typename ListenerT>
+void measureDispatch(benchmark::State &state)
+{
+    static const auto frames = test::loadChatMessageFrames();
+
+    FinalListener listener{state.range(0) != 0};
+    ListenerT &target = listener;
+
+    std::size_t handled = 0;
+    for (auto _ : state)
+    {
+        for (const auto &frame : frames)
+        {
+            auto ec = handleMessage(target, frame);
+            benchmark::DoNotOptimize(ec);
+        }
+        handled += frames.size();
+    }
+
+    benchmark::DoNotOptimize(listener.bytes);
+    state.SetItemsProcessed(static_cast<std::int64_t>(handled));
+}
+
+void BM_DispatchVirtual(benchmark::State &state)
+{
+    measureDispatch<Listener>(state);
+}
+
+void BM_DispatchFinal(benchmark::State &state)
+{
+    measureDispatch<FinalListener>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_DispatchVirtual)->ArgName("json")->Arg(1)->Arg(0);
+BENCHMARK(BM_DispatchFinal)->ArgName("json")->Arg(1)->Arg(0);
@@ -54,12 +54,19 @@ class Eventsub(ConanFile):
         "openssl/[~3]",
     ]
     settings = "os", "compiler", "build_type", "arch"
+    options = {
+        "with_tests": [True, False],
+        "with_benchmarks": [True, False],
+        "with_simdjson": [True, False],
+    }
     default_options = {
         "openssl*:shared": True,
+        "with_tests": False,
+        "with_benchmarks": False,
+        "with_simdjson": False,
     }
     default_options.update({f"boost*:without_{opt}": True for opt in BOOST_DISABLED_OPTIONS})
 
-    options = {}
     generators = "CMakeDeps", "CMakeToolchain"
 
     def layout(self):
@@ -69,6 +76,14 @@ class Eventsub(ConanFile):
     def requirements(self):
         self.output.warning(BOOST_DISABLED_OPTIONS)
         self.output.warning(self.default_options)
+        if self.options.with_simdjson:
+            self.requires("simdjson/[~3]")
+
+    def build_requirements(self):
+        if self.options.with_tests:
+            self.test_requires("gtest/[~1.14]")
+        if self.options.with_benchmarks:
+            self.test_requires("benchmark/[~1.8]")
 
     def generate(self):
         for dep in self.dependencies.values():
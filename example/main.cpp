@@ -13,22 +13,22 @@ using namespace eventsub;
 class MyListener final : public Listener
 {
 public:
-    void onSessionWelcome(messages::Metadata metadata,
-                          payload::session_welcome::Payload payload) override
+    void onSessionWelcome(const messages::Metadata &metadata,
+                          payload::session_welcome::Payload &&payload) override
     {
         (void)metadata;
         std::cout << "ON session welcome " << payload.id << " XD\n";
     }
 
-    void onNotification(messages::Metadata metadata,
+    void onNotification(const messages::Metadata &metadata,
                         const boost::json::value &jv) override
     {
         (void)metadata;
         std::cout << "on notification: " << jv << '\n';
     }
 
-    void onChannelBan(messages::Metadata metadata,
-                      payload::channel_ban::v1::Payload payload) override
+    void onChannelBan(const messages::Metadata &metadata,
+                      payload::channel_ban::v1::Payload &&payload) override
     {
         (void)metadata;
         std::cout << "Channel ban occured in "
@@ -40,16 +40,17 @@ public:
                   << '\n';
     }
 
-    void onStreamOnline(messages::Metadata metadata,
-                        payload::stream_online::v1::Payload payload) override
+    void onStreamOnline(const messages::Metadata &metadata,
+                        payload::stream_online::v1::Payload &&payload) override
     {
         (void)metadata;
         (void)payload;
         std::cout << "ON STREAM ONLINE XD\n";
     }
 
-    void onStreamOffline(messages::Metadata metadata,
-                         payload::stream_offline::v1::Payload payload) override
+    void onStreamOffline(
+        const messages::Metadata &metadata,
+        payload::stream_offline::v1::Payload &&payload) override
     {
         (void)metadata;
         (void)payload;
@@ -57,16 +58,17 @@ public:
     }
 
     void onChannelChatNotification(
-        messages::Metadata metadata,
-        payload::channel_chat_notification::v1::Payload payload) override
+        const messages::Metadata &metadata,
+        payload::channel_chat_notification::v1::Payload &&payload) override
     {
         (void)metadata;
         (void)payload;
         std::cout << "Received channel.chat.notification v1\n";
     }
 
-    void onChannelUpdate(messages::Metadata metadata,
-                         payload::channel_update::v1::Payload payload) override
+    void onChannelUpdate(
+        const messages::Metadata &metadata,
+        payload::channel_update::v1::Payload &&payload) override
     {
         (void)metadata;
         (void)payload;
@@ -74,8 +76,8 @@ public:
     }
 
     void onChannelChatMessage(
-        messages::Metadata metadata,
-        payload::channel_chat_message::v1::Payload payload) override
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) override
     {
         (void)metadata;
         (void)payload;
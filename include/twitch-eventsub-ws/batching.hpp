@@ -0,0 +1,327 @@
+#pragma once
+
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/notification.hpp"
+
+#include <boost/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace eventsub {
+
+/**
+ * Batching trades latency for throughput: a notification can be held back
+ * for up to maxDelay (10ms by default) before the listener sees it, unless
+ * the batch fills up first. Under light traffic, most notifications wait the
+ * full maxDelay. Lower it if the listener needs them sooner
+ **/
+struct BatchOptions {
+    // Deliver the batch once it holds this many notifications
+    std::size_t maxNotifications = 64;
+
+    // Deliver the batch once its first notification has waited this long
+    std::chrono::milliseconds maxDelay{10};
+};
+
+}  // namespace eventsub
+
+namespace eventsub::detail {
+
+// Subscription types
+// Pass a batch of payloads to the listener's batch callback of their
+// subscription. Listener types without that callback get each notification
+// passed to their regular callback instead
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::channel_ban::v1::Payload>> batch)
+{
+    if constexpr (requires { listener.onChannelBans(batch); })
+    {
+        listener.onChannelBans(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::stream_online::v1::Payload>> batch)
+{
+    if constexpr (requires { listener.onStreamOnlines(batch); })
+    {
+        listener.onStreamOnlines(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::stream_offline::v1::Payload>> batch)
+{
+    if constexpr (requires { listener.onStreamOfflines(batch); })
+    {
+        listener.onStreamOfflines(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::channel_chat_notification::v1::Payload>>
+        batch)
+{
+    if constexpr (requires { listener.onChannelChatNotifications(batch); })
+    {
+        listener.onChannelChatNotifications(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::channel_update::v1::Payload>> batch)
+{
+    if constexpr (requires { listener.onChannelUpdates(batch); })
+    {
+        listener.onChannelUpdates(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+template <typename ListenerT>
+void callListener(
+    ListenerT &listener,
+    std::span<Notification<payload::channel_chat_message::v1::Payload>> batch)
+{
+    if constexpr (requires { listener.onChannelChatMessages(batch); })
+    {
+        listener.onChannelChatMessages(batch);
+    }
+    else
+    {
+        for (auto &notification : batch)
+        {
+            callListener(listener, std::move(notification.metadata),
+                         std::move(notification.payload));
+        }
+    }
+}
+
+// Add your new subscription types above this line
+
+/**
+ * Batcher is dispatched to in place of the listener when batching is enabled.
+ *
+ * It collects the deserialized payloads of notifications per subscription,
+ * and passes them to the listener's batch callbacks when flushed. Other
+ * messages (e.g. session_welcome) flush the batch first, so they aren't
+ * delivered ahead of notifications that were received before them. The JSON
+ * of notifications is passed to onNotification as soon as it's parsed, since
+ * it's only valid until the next frame.
+ *
+ * Within a batch, notifications are in the order they were received per
+ * subscription, but not across subscriptions.
+ **/
+template <typename ListenerT>
+class Batcher
+{
+public:
+    explicit Batcher(ListenerT &_listener)
+        : listener(_listener)
+    {
+    }
+
+    void onSessionWelcome(const messages::Metadata &metadata,
+                          payload::session_welcome::Payload &&payload)
+    {
+        this->flush();
+        this->listener.onSessionWelcome(metadata, std::move(payload));
+    }
+
+    void onSessionReconnect(const messages::Metadata &metadata,
+                            payload::session_reconnect::Payload &&payload)
+    {
+        this->flush();
+        if constexpr (requires {
+                          this->listener.onSessionReconnect(metadata,
+                                                            std::move(payload));
+                      })
+        {
+            this->listener.onSessionReconnect(metadata, std::move(payload));
+        }
+    }
+
+    void onRevocation(const messages::Metadata &metadata,
+                      const boost::json::value &jv)
+    {
+        this->flush();
+        if constexpr (requires { this->listener.onRevocation(metadata, jv); })
+        {
+            this->listener.onRevocation(metadata, jv);
+        }
+    }
+
+    bool wantsNotificationJSON() const
+    {
+        return this->listener.wantsNotificationJSON();
+    }
+
+    // The JSON is only valid during the call, so it can't wait for the batch.
+    // The typed payload of the notification (if any) is batched right after
+    void onNotification(const messages::Metadata &metadata,
+                        const boost::json::value &jv)
+    {
+        this->listener.onNotification(metadata, jv);
+    }
+
+    // Subscription types
+    void onChannelBan(messages::Metadata &&metadata,
+                      payload::channel_ban::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    void onStreamOnline(messages::Metadata &&metadata,
+                        payload::stream_online::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    void onStreamOffline(messages::Metadata &&metadata,
+                         payload::stream_offline::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    void onChannelChatNotification(
+        messages::Metadata &&metadata,
+        payload::channel_chat_notification::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    void onChannelUpdate(messages::Metadata &&metadata,
+                         payload::channel_update::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    void onChannelChatMessage(
+        messages::Metadata &&metadata,
+        payload::channel_chat_message::v1::Payload &&payload)
+    {
+        this->add(std::move(metadata), std::move(payload));
+    }
+
+    // Add your new subscription types above this line
+
+    // The number of notifications waiting to be delivered
+    std::size_t size() const
+    {
+        return this->count;
+    }
+
+    // Deliver all notifications in the batch to the listener
+    void flush()
+    {
+        if (this->count == 0)
+        {
+            return;
+        }
+        this->count = 0;
+
+        std::apply(
+            [this](auto &...batch) {
+                (this->deliver(batch), ...);
+            },
+            this->batches);
+    }
+
+private:
+    // The metadata is moved in rather than copied, since it differs for
+    // every notification anyway
+    template <typename Payload>
+    void add(messages::Metadata &&metadata, Payload &&payload)
+    {
+        std::get<std::vector<Notification<Payload>>>(this->batches)
+            .push_back({std::move(metadata), std::move(payload)});
+        this->count++;
+    }
+
+    template <typename Payload>
+    void deliver(std::vector<Notification<Payload>> &batch)
+    {
+        if (batch.empty())
+        {
+            return;
+        }
+
+        callListener(this->listener, std::span{batch});
+
+        // Keeps the capacity for the next batch
+        batch.clear();
+    }
+
+    ListenerT &listener;
+
+    // Subscription types
+    std::tuple<
+        std::vector<Notification<payload::channel_ban::v1::Payload>>,
+        std::vector<Notification<payload::stream_online::v1::Payload>>,
+        std::vector<Notification<payload::stream_offline::v1::Payload>>,
+        std::vector<
+            Notification<payload::channel_chat_notification::v1::Payload>>,
+        std::vector<Notification<payload::channel_update::v1::Payload>>,
+        std::vector<Notification<payload::channel_chat_message::v1::Payload>>
+        // Add your new subscription types above this line
+        >
+        batches;
+
+    std::size_t count = 0;
+};
+
+}  // namespace eventsub::detail
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace eventsub {
+
+// Twitch user IDs are numeric strings, so we store & compare them as integers.
+// Returns std::nullopt if id isn't a number
+std::optional<std::uint64_t> parseUserID(std::string_view id);
+
+/**
+ * Finds the broadcaster a notification is about, looking only at
+ * payload.subscription.condition.broadcaster_user_id, or at
+ * payload.event.broadcaster_user_id if the subscription comes after the event.
+ *
+ * Every other key is skipped without being deserialized, and parsing stops as
+ * soon as the ID has been read.
+ *
+ * Returns std::nullopt if the message has no (numeric) broadcaster ID
+ **/
+std::optional<std::uint64_t> readBroadcasterID(std::string_view message,
+                                               sax::Parser &parser);
+
+/**
+ * BroadcasterFilter decides whether a notification is about a broadcaster
+ * we want, before anything in its payload has been deserialized
+ **/
+class BroadcasterFilter
+{
+public:
+    // Only let notifications of these broadcasters through. Empty lets
+    // everything through. IDs that aren't numeric can't match anything
+    void setBroadcasters(const std::vector<std::string> &broadcasterIDs);
+
+    bool empty() const;
+
+    // Messages without a broadcaster ID (e.g. session_welcome) always pass.
+    // The ID is read with readBroadcasterID
+    bool wants(std::optional<std::uint64_t> broadcasterID) const;
+
+private:
+    std::unordered_set<std::uint64_t> broadcasters;
+    bool enabled = false;
+};
+
+}  // namespace eventsub
@@ -0,0 +1,467 @@
+#pragma once
+
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+
+namespace eventsub {
+
+class Listener;
+
+/**
+ * BasicBroadcasterRouter maps broadcaster IDs to the listener that handles
+ * their notifications, so a session serving many channels can hand each
+ * notification to its channel's listener instead of one listener looking the
+ * channel up itself.
+ *
+ * The IDs are stored as integers in a flat open-addressing table with linear
+ * probing, so lookups never allocate and never wait on a lock.
+ *
+ * Listeners can be added & removed from any thread while a session is
+ * delivering notifications. Only find() is lock-free: adding & removing
+ * take a mutex among themselves, since they may rehash the table, but
+ * find() never waits for them.
+ *
+ * A removed listener is only destroyed by collect(), once every Reader that
+ * could have found it is gone, so listeners found while holding a Reader
+ * can't be destroyed while they handle a notification. Readers are counted
+ * per epoch: collect() moves the Readers that show up after it to the next
+ * epoch, and destroys what was removed before it once the Readers of the
+ * previous epoch are gone. So removed listeners are destroyed even if there
+ * always is a Reader alive, as with a session delivering from several
+ * threads. The session collects between frames.
+ *
+ * Removing a broadcaster keeps its slot in the table, so adding it again
+ * reuses the slot. Once all slots have been used, the next new broadcaster
+ * moves the remaining ones into a new table of the same size, which leaves
+ * the slots of the removed ones behind. The old table is destroyed by
+ * collect(), like removed listeners.
+ *
+ * The table never grows: maxBroadcasters is a hard limit on the number of
+ * broadcasters that have a listener at the same time, beyond which add()
+ * fails. The table takes 32 to 64 bytes per broadcaster of that limit.
+ **/
+template <typename ListenerT>
+class BasicBroadcasterRouter
+{
+public:
+    explicit BasicBroadcasterRouter(std::size_t maxBroadcasters = 1024)
+        : capacity(maxBroadcasters)
+        , table(new Table(tableSizeFor(maxBroadcasters)))
+    {
+    }
+
+    ~BasicBroadcasterRouter()
+    {
+        auto *current = this->table.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < current->size; i++)
+        {
+            delete current->slots[i].entry.load(std::memory_order_relaxed);
+        }
+        delete current;
+
+        // No Reader is alive anymore
+        destroy(this->retired.load(std::memory_order_relaxed));
+        destroy(this->retiredTables.load(std::memory_order_relaxed));
+        destroy(this->closingEntries);
+        destroy(this->closingTables);
+    }
+
+    BasicBroadcasterRouter(const BasicBroadcasterRouter &) = delete;
+    BasicBroadcasterRouter &operator=(const BasicBroadcasterRouter &) = delete;
+
+    // Keeps the table used by find() and the listeners it returns alive
+    // while it exists
+    class Reader
+    {
+    public:
+        explicit Reader(const BasicBroadcasterRouter &_router)
+            : router(_router)
+        {
+            // If collect() moved on to the next epoch meanwhile, it may not
+            // have seen us in this one
+            for (;;)
+            {
+                const auto epoch = this->router.epoch.load();
+                this->readers = &this->router.readers[epoch % 2];
+                this->readers->fetch_add(1);
+                if (this->router.epoch.load() == epoch)
+                {
+                    break;
+                }
+                this->readers->fetch_sub(1);
+            }
+        }
+
+        ~Reader()
+        {
+            this->readers->fetch_sub(1);
+        }
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+    private:
+        const BasicBroadcasterRouter &router;
+
+        // The Readers of our epoch
+        std::atomic<std::size_t> *readers = nullptr;
+    };
+
+    // Returns false if the broadcaster already has a listener, or the router
+    // is full
+    bool add(std::uint64_t broadcasterID, std::unique_ptr<ListenerT> listener)
+    {
+        if (broadcasterID == 0)
+        {
+            return false;
+        }
+
+        std::lock_guard lock(this->mutex);
+
+        auto *slot = this->claim(broadcasterID);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        if (slot->entry.load(std::memory_order_relaxed) != nullptr)
+        {
+            return false;
+        }
+
+        slot->entry.store(new Entry{std::move(listener)});
+        this->live++;
+        return true;
+    }
+
+    // Returns false if the ID isn't a valid user ID
+    bool add(std::string_view broadcasterID,
+             std::unique_ptr<ListenerT> listener)
+    {
+        const auto id = parseUserID(broadcasterID);
+        return id && this->add(*id, std::move(listener));
+    }
+
+    // Returns false if the broadcaster had no listener
+    bool remove(std::uint64_t broadcasterID)
+    {
+        std::lock_guard lock(this->mutex);
+
+        auto *slot =
+            lookup(*this->table.load(std::memory_order_relaxed), broadcasterID);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        // Ordered with Reader & find(), see collect()
+        auto *entry = slot->entry.exchange(nullptr);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        this->live--;
+        retire(this->retired, entry);
+        return true;
+    }
+
+    bool remove(std::string_view broadcasterID)
+    {
+        const auto id = parseUserID(broadcasterID);
+        return id && this->remove(*id);
+    }
+
+    // Returns nullptr if the broadcaster has no listener. Hold a Reader
+    // while calling this & using the returned listener
+    ListenerT *find(std::uint64_t broadcasterID) const noexcept
+    {
+        const auto *slot = lookup(*this->table.load(), broadcasterID);
+        if (slot == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto *entry = slot->entry.load();
+        if (entry == nullptr)
+        {
+            return nullptr;
+        }
+
+        return entry->listener.get();
+    }
+
+    // Destroys the listeners removed and the tables replaced before the
+    // last call, once the Readers that were alive then are gone, and those
+    // removed since if no Reader is alive. Never waits: if another thread is
+    // collecting, or Readers are in the way, they're kept for a later call.
+    // Can be called from any thread
+    void collect()
+    {
+        if (this->collecting.test_and_set(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        this->destroyClosed();
+
+        if (this->closingEntries == nullptr && this->closingTables == nullptr)
+        {
+            auto *entries = this->retired.exchange(nullptr);
+            auto *tables = this->retiredTables.exchange(nullptr);
+            if (entries != nullptr || tables != nullptr)
+            {
+                this->closingEntries = entries;
+                this->closingTables = tables;
+
+                // Readers that show up after this can't find them anymore,
+                // since they were removed from their slots (or replaced)
+                // before being retired. So only the Readers of the current
+                // epoch need to be waited for
+                this->closingEpoch = this->epoch.fetch_add(1);
+                this->destroyClosed();
+            }
+        }
+
+        this->collecting.clear(std::memory_order_release);
+    }
+
+private:
+    struct Entry {
+        std::unique_ptr<ListenerT> listener;
+
+        // Next in the list of removed entries
+        Entry *next = nullptr;
+    };
+
+    struct Slot {
+        // 0 if the slot is unused. Never changes once it's set
+        std::atomic<std::uint64_t> key{0};
+
+        // nullptr if the broadcaster has been removed
+        std::atomic<Entry *> entry{nullptr};
+    };
+
+    // The slots don't own their entries, since a rehash moves them to the
+    // next table while readers may still find them in this one
+    struct Table {
+        explicit Table(std::size_t _size)
+            : size(_size)
+            , slots(std::make_unique<Slot[]>(_size))
+        {
+        }
+
+        const std::size_t size;
+        const std::unique_ptr<Slot[]> slots;
+
+        // Number of slots with a key
+        std::size_t used = 0;
+
+        // Next in the list of replaced tables
+        Table *next = nullptr;
+    };
+
+    // Keep the table at most half full so probe sequences stay short
+    static std::size_t tableSizeFor(std::size_t maxBroadcasters)
+    {
+        std::size_t size = 16;
+        while (size < maxBroadcasters * 2)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    // splitmix64 finalizer, since IDs are handed out sequentially
+    static std::size_t indexOf(const Table &table,
+                               std::uint64_t broadcasterID) noexcept
+    {
+        auto x = broadcasterID;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+
+        return static_cast<std::size_t>(x & (table.size - 1));
+    }
+
+    // The slot of the broadcaster, or nullptr if it was never added to the
+    // table
+    static Slot *lookup(const Table &table,
+                        std::uint64_t broadcasterID) noexcept
+    {
+        if (broadcasterID == 0)
+        {
+            return nullptr;
+        }
+
+        auto index = indexOf(table, broadcasterID);
+        for (std::size_t probes = 0; probes < table.size; probes++)
+        {
+            auto &slot = table.slots[index];
+            const auto key = slot.key.load(std::memory_order_acquire);
+            if (key == broadcasterID)
+            {
+                return &slot;
+            }
+            if (key == 0)
+            {
+                return nullptr;
+            }
+
+            index = (index + 1) & (table.size - 1);
+        }
+
+        return nullptr;
+    }
+
+    // The slot of the broadcaster, taking an unused one if it was never added.
+    // Returns nullptr if the router is full. Must hold the mutex
+    Slot *claim(std::uint64_t broadcasterID)
+    {
+        auto *current = this->table.load(std::memory_order_relaxed);
+        if (auto *slot = lookup(*current, broadcasterID))
+        {
+            return slot;
+        }
+
+        if (this->live >= this->capacity)
+        {
+            return nullptr;
+        }
+
+        if (current->used >= this->capacity)
+        {
+            // Only removed broadcasters are holding up the slots
+            current = this->rehash();
+        }
+
+        auto index = indexOf(*current, broadcasterID);
+        while (current->slots[index].key.load(std::memory_order_relaxed) != 0)
+        {
+            index = (index + 1) & (current->size - 1);
+        }
+
+        auto &slot = current->slots[index];
+        slot.key.store(broadcasterID, std::memory_order_release);
+        current->used++;
+        return &slot;
+    }
+
+    // Move the broadcasters that have a listener to a new table, and replace
+    // the current one with it. Must hold the mutex
+    Table *rehash()
+    {
+        auto *current = this->table.load(std::memory_order_relaxed);
+        auto *next = new Table(current->size);
+
+        for (std::size_t i = 0; i < current->size; i++)
+        {
+            const auto &slot = current->slots[i];
+            auto *entry = slot.entry.load(std::memory_order_relaxed);
+            if (entry == nullptr)
+            {
+                continue;
+            }
+
+            const auto key = slot.key.load(std::memory_order_relaxed);
+            auto index = indexOf(*next, key);
+            while (next->slots[index].key.load(std::memory_order_relaxed) != 0)
+            {
+                index = (index + 1) & (next->size - 1);
+            }
+
+            next->slots[index].key.store(key, std::memory_order_relaxed);
+            next->slots[index].entry.store(entry, std::memory_order_relaxed);
+            next->used++;
+        }
+
+        // Ordered with Reader & find(), see collect()
+        this->table.exchange(next);
+        retire(this->retiredTables, current);
+        return next;
+    }
+
+    // Destroys the entries & tables retired before the last epoch, if its
+    // Readers are gone. Must be collecting
+    void destroyClosed()
+    {
+        if (this->readers[this->closingEpoch % 2].load() != 0)
+        {
+            return;
+        }
+
+        destroy(std::exchange(this->closingEntries, nullptr));
+        destroy(std::exchange(this->closingTables, nullptr));
+    }
+
+    template <typename T>
+    static void destroy(T *items)
+    {
+        while (items != nullptr)
+        {
+            delete std::exchange(items, items->next);
+        }
+    }
+
+    // Adds a list of entries (or tables) to the retired ones
+    template <typename T>
+    static void retire(std::atomic<T *> &list, T *items)
+    {
+        if (items == nullptr)
+        {
+            return;
+        }
+
+        auto *last = items;
+        while (last->next != nullptr)
+        {
+            last = last->next;
+        }
+
+        last->next = list.load(std::memory_order_relaxed);
+        while (!list.compare_exchange_weak(last->next, items,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed))
+        {
+        }
+    }
+
+    const std::size_t capacity;
+
+    // Replaced by rehash(), but only ever read through a Reader
+    std::atomic<Table *> table;
+
+    // Serializes add() & remove(). Never taken by readers
+    std::mutex mutex;
+
+    // Number of broadcasters with a listener
+    std::size_t live = 0;
+
+    // Removed entries & replaced tables waiting for collect()
+    std::atomic<Entry *> retired{nullptr};
+    std::atomic<Table *> retiredTables{nullptr};
+
+    // Number of Readers alive that started in an even or odd epoch.
+    // collect() starts a new epoch whenever it has something to destroy
+    mutable std::atomic<std::uint64_t> epoch{0};
+    mutable std::atomic<std::size_t> readers[2]{};
+
+    // Held by the thread running collect()
+    std::atomic_flag collecting;
+
+    // Retired before closingEpoch ended, waiting for its Readers to be gone
+    std::uint64_t closingEpoch = 0;
+    Entry *closingEntries = nullptr;
+    Table *closingTables = nullptr;
+};
+
+using BroadcasterRouter = BasicBroadcasterRouter<Listener>;
+
+}  // namespace eventsub
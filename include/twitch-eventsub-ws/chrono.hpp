@@ -5,13 +5,24 @@
 #include <boost/json.hpp>
 
 #include <chrono>
+#include <optional>
 #include <sstream>
+#include <string_view>
 
 namespace eventsub {
 
 struct AsISO8601 {
 };
 
+// Parse an ISO 8601 timestamp like 2023-05-14T12:31:47.995298776Z
+std::chrono::system_clock::time_point parseISO8601(std::string_view raw);
+
+// Parse a timestamp in exactly the layout Twitch uses: UTC, with an optional
+// fraction of up to nine digits. Returns std::nullopt for anything else,
+// which parseISO8601 then hands to the slower, more lenient date::parse
+std::optional<std::chrono::system_clock::time_point> tryParseISO8601(
+    std::string_view raw);
+
 boost::json::result_for<std::chrono::system_clock::time_point,
                         boost::json::value>::type
     tag_invoke(
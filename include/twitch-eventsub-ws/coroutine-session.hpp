@@ -0,0 +1,596 @@
+#pragma once
+
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/frame-arena.hpp"
+#include "twitch-eventsub-ws/message-deduplicator.hpp"
+#include "twitch-eventsub-ws/reconnect.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+#include "twitch-eventsub-ws/session.hpp"
+
+#include <boost/asio.hpp>
+#include <boost/asio/experimental/awaitable_operators.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <boost/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace eventsub {
+
+/**
+ * BasicCoroutineSession is a Session written as a C++20 coroutine on asio
+ * awaitables, e.g.
+ *
+ *   boost::asio::co_spawn(boost::asio::make_strand(ioc),
+ *                         session.run(host, port, path, userAgent),
+ *                         boost::asio::detached);
+ *
+ * Instead of a chain of completion handlers that each keep the session alive
+ * through shared_from_this(), reading is a loop in a single coroutine frame.
+ * The session must outlive the coroutines it runs, so keep it around until
+ * the io_context has stopped. Spawn run() on a strand if the io_context runs
+ * on more than one thread, since the read loop, its keepalive watchdog and
+ * the connection left behind by a session_reconnect are read side by side.
+ *
+ * Like Session, it follows session_reconnect messages without dropping
+ * notifications, watches the keepalive timeout of session_welcome, and can
+ * reconnect with backoff (setReconnect). Filters, routers, batching, the
+ * pipeline and registered handlers are only available on Session.
+ **/
+template <typename ListenerT>
+class BasicCoroutineSession
+{
+public:
+    BasicCoroutineSession(boost::asio::ssl::context &_ctx,
+                          std::unique_ptr<ListenerT> _listener)
+        : ctx(_ctx)
+        , listener(std::move(_listener))
+    {
+    }
+
+    BasicCoroutineSession(const BasicCoroutineSession &) = delete;
+    BasicCoroutineSession &operator=(const BasicCoroutineSession &) = delete;
+
+    // Reconnect whenever the connection fails, see Session::setReconnect.
+    // Must be called before run()
+    void setReconnect(ReconnectOptions options)
+    {
+        this->reconnectOptions = options;
+    }
+
+    // The number of frames that couldn't be parsed or dispatched. They're
+    // logged & skipped, the connection keeps being read
+    std::size_t getMessageErrors() const
+    {
+        return this->messageErrors.load();
+    }
+
+    // Only returns once the session is over, i.e. the connection failed and
+    // we're not supposed to (or gave up trying to) reconnect
+    boost::asio::awaitable<void> run(std::string host, std::string port,
+                                     std::string path, std::string userAgent)
+    {
+        this->endpoint = {
+            .host = std::move(host),
+            .port = std::move(port),
+            .path = std::move(path),
+        };
+        this->userAgent = std::move(userAgent);
+
+        boost::asio::steady_timer backoff(
+            co_await boost::asio::this_coro::executor);
+        std::size_t attempts = 0;
+        for (;;)
+        {
+            // A connection we migrated to may have failed before its welcome,
+            // but this one starts a new Twitch session, whose welcome the
+            // listener has to see
+            this->migrating = false;
+            this->welcomed = false;
+
+            boost::system::error_code ec;
+            auto connection = co_await this->connect(this->endpoint, ec);
+            if (connection)
+            {
+                ec = co_await this->serve(std::move(connection));
+            }
+            detail::fail(ec, "session");
+
+            if constexpr (requires { this->listener->onDisconnected(ec); })
+            {
+                this->listener->onDisconnected(ec);
+            }
+
+            if (this->welcomed)
+            {
+                // The connection made it, so this is a new streak of failures
+                attempts = 0;
+            }
+
+            if (!this->reconnectOptions ||
+                (this->reconnectOptions->maxAttempts != 0 &&
+                 attempts >= this->reconnectOptions->maxAttempts))
+            {
+                co_return;
+            }
+
+            backoff.expires_after(reconnectDelay(*this->reconnectOptions,
+                                                 attempts++, this->random));
+            co_await backoff.async_wait(
+                boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+            if (ec)
+            {
+                co_return;
+            }
+        }
+    }
+
+private:
+    using Stream = boost::beast::websocket::stream<
+        boost::beast::ssl_stream<boost::beast::tcp_stream>>;
+
+    struct Connection {
+        Connection(const boost::asio::any_io_executor &executor,
+                   boost::asio::ssl::context &ctx)
+            : ws(executor, ctx)
+        {
+        }
+
+        Stream ws;
+        boost::beast::flat_buffer buffer;
+    };
+
+    // Resolve, connect & do both handshakes, giving up after
+    // CONNECT_TIMEOUT. Returns nullptr on failure
+    boost::asio::awaitable<std::unique_ptr<Connection>> connect(
+        const detail::WebSocketURL &url, boost::system::error_code &ec)
+    {
+        using namespace boost::asio::experimental::awaitable_operators;
+
+        boost::asio::steady_timer timeout(
+            co_await boost::asio::this_coro::executor);
+        timeout.expires_after(CONNECT_TIMEOUT);
+
+        boost::system::error_code timeoutError;
+        auto result = co_await (this->handshake(url, ec) ||
+                                timeout.async_wait(boost::asio::redirect_error(
+                                    boost::asio::use_awaitable, timeoutError)));
+        if (result.index() == 1)
+        {
+            static const error::ApplicationErrorCategory errorConnectTimeout{
+                "Connecting took too long"};
+            ec = boost::system::error_code{129, errorConnectTimeout};
+            co_return nullptr;
+        }
+
+        co_return std::move(std::get<0>(result));
+    }
+
+    boost::asio::awaitable<std::unique_ptr<Connection>> handshake(
+        const detail::WebSocketURL &url, boost::system::error_code &ec)
+    {
+        const auto executor = co_await boost::asio::this_coro::executor;
+        auto token =
+            boost::asio::redirect_error(boost::asio::use_awaitable, ec);
+
+        const bool isEndpoint =
+            url.host == this->endpoint.host && url.port == this->endpoint.port;
+        if (!isEndpoint || !this->resolvedEndpoint)
+        {
+            boost::asio::ip::tcp::resolver resolver(executor);
+            auto results =
+                co_await resolver.async_resolve(url.host, url.port, token);
+            if (ec)
+            {
+                co_return nullptr;
+            }
+            if (isEndpoint)
+            {
+                this->resolvedEndpoint = std::move(results);
+            }
+            else
+            {
+                this->resolvedOther = std::move(results);
+            }
+        }
+
+        auto connection = std::make_unique<Connection>(executor, this->ctx);
+        auto &ws = connection->ws;
+
+        const auto ep =
+            co_await boost::beast::get_lowest_layer(ws).async_connect(
+                isEndpoint ? *this->resolvedEndpoint : this->resolvedOther,
+                token);
+        if (ec)
+        {
+            if (isEndpoint)
+            {
+                // The addresses might be stale, look them up again next time
+                this->resolvedEndpoint.reset();
+            }
+            co_return nullptr;
+        }
+
+        // Set SNI Hostname (many hosts need this to handshake successfully)
+        if (!SSL_set_tlsext_host_name(ws.next_layer().native_handle(),
+                                      url.host.c_str()))
+        {
+            ec = boost::beast::error_code(
+                static_cast<int>(::ERR_get_error()),
+                boost::asio::error::get_ssl_category());
+            co_return nullptr;
+        }
+
+        co_await ws.next_layer().async_handshake(
+            boost::asio::ssl::stream_base::client, token);
+        if (ec)
+        {
+            co_return nullptr;
+        }
+
+        ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
+            boost::beast::role_type::client));
+        ws.set_option(boost::beast::websocket::stream_base::decorator(
+            [userAgent{this->userAgent}](
+                boost::beast::websocket::request_type &req) {
+                req.set(boost::beast::http::field::user_agent, userAgent);
+            }));
+
+        // See https://tools.ietf.org/html/rfc7230#section-5.4
+        co_await ws.async_handshake(url.host + ':' + std::to_string(ep.port()),
+                                    url.path, token);
+        if (ec)
+        {
+            co_return nullptr;
+        }
+
+        // Start with the buffer an earlier connection has grown
+        connection->buffer = std::exchange(this->spareBuffer, {});
+
+        co_return connection;
+    }
+
+    // Deliver the frames of a connection until it fails, following any
+    // session_reconnect on the way. Returns why it failed
+    boost::asio::awaitable<boost::system::error_code> serve(
+        std::unique_ptr<Connection> connection)
+    {
+        using namespace boost::asio::experimental::awaitable_operators;
+
+        for (;;)
+        {
+            this->keepaliveTimeout = WELCOME_TIMEOUT;
+            this->lastFrame = std::chrono::steady_clock::now();
+
+            auto result = co_await (this->readLoop(*connection, true) ||
+                                    this->watchKeepalive());
+            if (result.index() == 1)
+            {
+                this->recycle(*connection);
+                co_return keepaliveTimedOut();
+            }
+
+            auto ec = std::get<0>(result);
+            if (ec != reconnecting())
+            {
+                this->recycle(*connection);
+                co_return ec;
+            }
+
+            auto url = detail::parseWebSocketURL(this->reconnectURL);
+            if (!url)
+            {
+                this->recycle(*connection);
+                static const error::ApplicationErrorCategory
+                    errorInvalidReconnectURL{
+                        "Reconnect URL must be a wss:// URL"};
+                co_return boost::system::error_code{129,
+                                                    errorInvalidReconnectURL};
+            }
+
+            // Cancelling a WebSocket read closes the stream, so the old
+            // connection is read by its own coroutine until Twitch closes it,
+            // which it does once the new one has been welcomed.
+            // Notifications received on both are only delivered once
+            if (this->draining++ == 0)
+            {
+                this->deduplicator.clear();
+            }
+            boost::asio::co_spawn(co_await boost::asio::this_coro::executor,
+                                  this->drain(std::move(connection)),
+                                  boost::asio::detached);
+
+            connection = co_await this->connect(*url, ec);
+            if (!connection)
+            {
+                co_return ec;
+            }
+
+            // The new connection's session_welcome isn't delivered, since
+            // the subscriptions carried over
+            this->migrating = true;
+        }
+    }
+
+    // Deliver what's left on a connection we moved away from
+    boost::asio::awaitable<void> drain(std::unique_ptr<Connection> connection)
+    {
+        using namespace boost::asio::experimental::awaitable_operators;
+
+        boost::asio::steady_timer timeout(
+            co_await boost::asio::this_coro::executor);
+        timeout.expires_after(DRAIN_TIMEOUT);
+
+        boost::system::error_code ec;
+        co_await (this->readLoop(*connection, false) ||
+                  timeout.async_wait(boost::asio::redirect_error(
+                      boost::asio::use_awaitable, ec)));
+
+        this->recycle(*connection);
+        this->draining--;
+    }
+
+    // Read & deliver frames until the connection fails, or Twitch sends a
+    // session_reconnect on the current connection (returned as
+    // reconnecting())
+    boost::asio::awaitable<boost::system::error_code> readLoop(
+        Connection &connection, bool current)
+    {
+        boost::system::error_code ec;
+        for (;;)
+        {
+            co_await connection.ws.async_read(
+                connection.buffer,
+                boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+            if (ec)
+            {
+                co_return ec;
+            }
+
+            if (this->handleFrame(connection, current))
+            {
+                co_return reconnecting();
+            }
+        }
+    }
+
+    // Returns once nothing has been received for the keepalive timeout
+    boost::asio::awaitable<void> watchKeepalive()
+    {
+        boost::asio::steady_timer timer(
+            co_await boost::asio::this_coro::executor);
+        for (;;)
+        {
+            // Frames only record when they arrived, so the timer is armed once
+            // per timeout instead of once per frame
+            const auto deadline =
+                this->lastFrame + this->keepaliveTimeout + KEEPALIVE_SLACK;
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                co_return;
+            }
+
+            boost::system::error_code ec;
+            timer.expires_at(deadline);
+            co_await timer.async_wait(
+                boost::asio::redirect_error(boost::asio::use_awaitable, ec));
+            if (ec)
+            {
+                // The read loop finished first
+                co_return;
+            }
+        }
+    }
+
+    // Deliver the frame in the connection's buffer, unless it's about the
+    // connection itself. Returns true if it's a session_reconnect we follow.
+    // A frame that can't be delivered is logged & skipped
+    bool handleFrame(Connection &connection, bool current)
+    {
+        if (current)
+        {
+            this->lastFrame = std::chrono::steady_clock::now();
+        }
+
+        const auto data = connection.buffer.data();
+        const std::string_view message{static_cast<const char *>(data.data()),
+                                       data.size()};
+
+        bool reconnect = false;
+        bool deliver = current;
+        messages::MetadataView metadata;
+        const bool hasMetadata =
+            detail::readMetadata(message, this->saxParser, metadata);
+        if (hasMetadata)
+        {
+            switch (metadata.type)
+            {
+                case messages::MessageType::SessionWelcome:
+                    if (current)
+                    {
+                        this->watchWelcome(message);
+                        this->welcomed = true;
+                        deliver = !std::exchange(this->migrating, false);
+                    }
+                    break;
+
+                case messages::MessageType::SessionReconnect:
+                    if (current)
+                    {
+                        if (auto oPayload = detail::parsePayload<
+                                payload::session_reconnect::Payload>(
+                                message, this->saxParser))
+                        {
+                            this->reconnectURL =
+                                std::move(oPayload->reconnectURL);
+                            reconnect = true;
+                        }
+                    }
+                    break;
+
+                case messages::MessageType::Notification:
+                    deliver = this->draining == 0 ||
+                              this->deduplicator.insert(metadata.messageID);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        if (deliver)
+        {
+            if (auto ec = this->dispatchFrame(
+                    message, hasMetadata ? &metadata : nullptr))
+            {
+                this->messageErrors++;
+                detail::fail(ec, "handleMessage");
+            }
+        }
+        connection.buffer.clear();
+        return reconnect;
+    }
+
+    boost::json::error_code dispatchFrame(
+        std::string_view message, const messages::MetadataView *metadata)
+    {
+        static const HandlerRegistry noHandlers;
+        const detail::Consumers<ListenerT> consumers{*this->listener,
+                                                     noHandlers};
+
+        if (metadata != nullptr && !this->listener->wantsNotificationJSON())
+        {
+            if (auto ec = detail::dispatchNotificationDirectly(
+                    consumers, *metadata, message, this->saxParser))
+            {
+                return *ec;
+            }
+        }
+
+        boost::json::error_code ec;
+        this->parser.reset(&this->arena);
+        this->parser.write(message.data(), message.size(), ec);
+        if (!ec)
+        {
+            this->parser.finish(ec);
+        }
+
+        if (!ec)
+        {
+            // The document must be gone before the arena is reset
+            const auto jv = this->parser.release();
+            ec = detail::dispatchMessage(consumers, jv);
+        }
+
+        this->arena.reset();
+
+        return ec;
+    }
+
+    // Pick up the keepalive timeout of a session_welcome
+    void watchWelcome(std::string_view message)
+    {
+        auto oPayload = detail::parsePayload<payload::session_welcome::Payload>(
+            message, this->saxParser);
+        if (oPayload && oPayload->keepaliveTimeoutSeconds &&
+            *oPayload->keepaliveTimeoutSeconds > 0)
+        {
+            this->keepaliveTimeout =
+                std::chrono::seconds{*oPayload->keepaliveTimeoutSeconds};
+        }
+        else
+        {
+            this->keepaliveTimeout = NO_KEEPALIVE_TIMEOUT;
+        }
+    }
+
+    // Keep the read buffer of a connection we're done with for the next one
+    void recycle(Connection &connection)
+    {
+        if (connection.buffer.capacity() > this->spareBuffer.capacity())
+        {
+            connection.buffer.clear();
+            this->spareBuffer = std::move(connection.buffer);
+        }
+    }
+
+    // Returned by readLoop when Twitch asks us to move to another connection
+    static boost::system::error_code reconnecting()
+    {
+        static const error::ApplicationErrorCategory errorReconnecting{
+            "Reconnecting"};
+        return boost::system::error_code{129, errorReconnecting};
+    }
+
+    static boost::system::error_code keepaliveTimedOut()
+    {
+        static const error::ApplicationErrorCategory errorKeepaliveTimeout{
+            "No message received within the keepalive timeout"};
+        return boost::system::error_code{129, errorKeepaliveTimeout};
+    }
+
+    static constexpr std::chrono::seconds CONNECT_TIMEOUT{30};
+
+    // How long a new connection may take to be welcomed
+    static constexpr std::chrono::seconds WELCOME_TIMEOUT{30};
+
+    // How long we keep reading a connection we moved away from
+    static constexpr std::chrono::seconds DRAIN_TIMEOUT{30};
+
+    // Allowed on top of the keepalive timeout, since keepalives are due
+    // right at it
+    static constexpr std::chrono::seconds KEEPALIVE_SLACK{1};
+
+    // Used if session_welcome doesn't have a keepalive timeout
+    static constexpr std::chrono::hours NO_KEEPALIVE_TIMEOUT{24 * 365};
+
+    boost::asio::ssl::context &ctx;
+    std::unique_ptr<ListenerT> listener;
+
+    detail::WebSocketURL endpoint;
+    std::string userAgent;
+
+    // Kept across connections, so reconnecting doesn't start from scratch
+    std::optional<boost::asio::ip::tcp::resolver::results_type>
+        resolvedEndpoint;
+    boost::asio::ip::tcp::resolver::results_type resolvedOther;
+    boost::beast::flat_buffer spareBuffer;
+
+    FrameArena arena;
+    boost::json::stream_parser parser;
+    sax::Parser saxParser;
+
+    std::chrono::steady_clock::duration keepaliveTimeout{WELCOME_TIMEOUT};
+    std::chrono::steady_clock::time_point lastFrame;
+    bool welcomed = false;
+
+    // Set by session_reconnect
+    std::string reconnectURL;
+
+    // Set until the connection we moved to has been welcomed
+    bool migrating = false;
+
+    // The number of connections we moved away from that are still read
+    std::size_t draining = 0;
+    MessageDeduplicator deduplicator;
+
+    std::optional<ReconnectOptions> reconnectOptions;
+    std::minstd_rand random{std::random_device{}()};
+
+    std::atomic<std::size_t> messageErrors{0};
+};
+
+using CoroutineSession = BasicCoroutineSession<Listener>;
+
+}  // namespace eventsub
@@ -0,0 +1,491 @@
+#pragma once
+
+#include "twitch-eventsub-ws/errors.hpp"
+#include "twitch-eventsub-ws/handler-registry.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/payloads/channel-ban-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-message-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-notification-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-update-v1.hpp"
+#include "twitch-eventsub-ws/payloads/session-reconnect.hpp"
+#include "twitch-eventsub-ws/payloads/session-welcome.hpp"
+#include "twitch-eventsub-ws/payloads/stream-offline-v1.hpp"
+#include "twitch-eventsub-ws/payloads/stream-online-v1.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <utility>
+
+/**
+ * Dispatches messages to a listener of type ListenerT.
+ *
+ * ListenerT must have the same member functions as Listener, but they don't
+ * have to be virtual: every call to the listener is resolved at compile time,
+ * so the callbacks of a non-virtual (or final) listener can be inlined into
+ * the dispatch code. Listener itself is just one such listener type.
+ **/
+namespace eventsub::detail {
+
+// Report a failure
+void fail(boost::system::error_code ec, const char *what);
+
+// Who messages are delivered to
+template <typename ListenerT>
+struct Consumers {
+    ListenerT &listener;
+
+    // Once any handler is registered, notifications only go to the handlers
+    const HandlerRegistry &handlers;
+};
+
+// Where a deserialized payload goes: the handler registered for it if there
+// is one, otherwise the listener
+template <typename ListenerT>
+struct PayloadTarget {
+    ListenerT &listener;
+    const HandlerRegistry::Handler *handler = nullptr;
+};
+
+template <typename T>
+std::optional<T> parsePayload(const boost::json::value &jv)
+{
+    auto result = boost::json::try_value_to<T>(jv);
+    if (!result.has_value())
+    {
+        fail(result.error(), "parsing payload");
+        return std::nullopt;
+    }
+
+    return std::move(result.value());
+}
+
+// The envelope of a message, when we only want its payload
+template <typename T>
+const sax::Sink &payloadSink()
+{
+    static const sax::ObjectSink<T> sink{
+        [](T &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            if (key == "payload")
+            {
+                seen |= 1;
+                return sax::slot(out);
+            }
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            if ((seen & 1) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    errorRootMustContainPayload{
+                        "Payload root must contain a payload field"};
+                return boost::system::error_code{129,
+                                                 errorRootMustContainPayload};
+            }
+            return {};
+        },
+    };
+
+    return sink;
+}
+
+template <typename T>
+std::optional<T> parsePayload(std::string_view message, sax::Parser &parser)
+{
+    T payload;
+
+    auto ec = parser.parse(message, sax::Slot{&payload, &payloadSink<T>()});
+    if (ec)
+    {
+        fail(ec, "parsing payload");
+        return std::nullopt;
+    }
+
+    return payload;
+}
+
+/**
+ * Read only the metadata of a message, leaving the rest of it untouched.
+ *
+ * Returns false if the metadata could not be read before the payload, e.g.
+ * because the payload comes first, one of its strings had to be unescaped or
+ * the message is not valid.
+ **/
+bool readMetadata(std::string_view message, sax::Parser &parser,
+                  messages::MetadataView &metadata);
+
+// Subscription types
+// Pass a payload to the listener callback of its subscription. The metadata
+// is the frame's own copy, so a listener that keeps it (like the Batcher) can
+// move it
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::channel_ban::v1::Payload &&payload)
+{
+    listener.onChannelBan(std::move(metadata), std::move(payload));
+}
+
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::stream_online::v1::Payload &&payload)
+{
+    listener.onStreamOnline(std::move(metadata), std::move(payload));
+}
+
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::stream_offline::v1::Payload &&payload)
+{
+    listener.onStreamOffline(std::move(metadata), std::move(payload));
+}
+
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::channel_chat_notification::v1::Payload &&payload)
+{
+    listener.onChannelChatNotification(std::move(metadata), std::move(payload));
+}
+
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::channel_update::v1::Payload &&payload)
+{
+    listener.onChannelUpdate(std::move(metadata), std::move(payload));
+}
+
+template <typename ListenerT>
+void callListener(ListenerT &listener, messages::Metadata &&metadata,
+                  payload::channel_chat_message::v1::Payload &&payload)
+{
+    listener.onChannelChatMessage(std::move(metadata), std::move(payload));
+}
+
+// Add your new subscription types above this line
+
+// Deserialize a payload from source (the JSON document of the payload, or the
+// message and a parser) and deliver it
+template <typename Payload, typename ListenerT, typename... Source>
+void deliverPayload(const PayloadTarget<ListenerT> &target,
+                    messages::Metadata &&metadata, Source &...source)
+{
+    auto oPayload = parsePayload<Payload>(source...);
+    if (!oPayload)
+    {
+        return;
+    }
+
+    if (target.handler != nullptr)
+    {
+        (*target.handler)(metadata, &*oPayload);
+        return;
+    }
+
+    callListener(target.listener, std::move(metadata), std::move(*oPayload));
+}
+
+// Subscription types
+// Returns false for subscriptions we don't support
+template <typename ListenerT, typename... Source>
+bool dispatchNotification(const PayloadTarget<ListenerT> &target,
+                          messages::Subscription subscription,
+                          messages::Metadata &&metadata, Source &...source)
+{
+    switch (subscription)
+    {
+        case messages::Subscription::ChannelBanV1:
+            deliverPayload<payload::channel_ban::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+        case messages::Subscription::StreamOnlineV1:
+            deliverPayload<payload::stream_online::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+        case messages::Subscription::StreamOfflineV1:
+            deliverPayload<payload::stream_offline::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+        case messages::Subscription::ChannelChatNotificationV1:
+            deliverPayload<payload::channel_chat_notification::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+        case messages::Subscription::ChannelUpdateV1:
+            deliverPayload<payload::channel_update::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+        case messages::Subscription::ChannelChatMessageV1:
+            deliverPayload<payload::channel_chat_message::v1::Payload>(
+                target, std::move(metadata), source...);
+            return true;
+            // Add your new subscription types above this line
+
+        case messages::Subscription::Unknown:
+            break;
+    }
+
+    return false;
+}
+
+/**
+ * Returns false if nothing consumes notifications of the given subscription,
+ * i.e. handlers are registered but none of them for this subscription.
+ **/
+template <typename ListenerT>
+bool findPayloadTarget(const Consumers<ListenerT> &consumers,
+                       messages::Subscription subscription,
+                       PayloadTarget<ListenerT> &target)
+{
+    if (consumers.handlers.empty())
+    {
+        return true;
+    }
+
+    target.handler = consumers.handlers.find(subscription);
+    return target.handler != nullptr;
+}
+
+template <typename ListenerT>
+void handleSessionWelcome(const messages::MetadataView &metadata,
+                          const boost::json::value &jv,
+                          const Consumers<ListenerT> &consumers)
+{
+    auto oPayload = parsePayload<payload::session_welcome::Payload>(jv);
+    if (!oPayload)
+    {
+        // TODO: error handling
+        return;
+    }
+    consumers.listener.onSessionWelcome(metadata.toMetadata(),
+                                        std::move(*oPayload));
+}
+
+template <typename ListenerT>
+void handleSessionReconnect(const messages::MetadataView &metadata,
+                            const boost::json::value &jv,
+                            const Consumers<ListenerT> &consumers)
+{
+    // Listener types don't have to care about reconnects, the session handles
+    // them
+    if constexpr (requires(payload::session_reconnect::Payload && payload) {
+                      consumers.listener.onSessionReconnect(
+                          metadata.toMetadata(), std::move(payload));
+                  })
+    {
+        auto oPayload = parsePayload<payload::session_reconnect::Payload>(jv);
+        if (!oPayload)
+        {
+            // TODO: error handling
+            return;
+        }
+        consumers.listener.onSessionReconnect(metadata.toMetadata(),
+                                              std::move(*oPayload));
+    }
+}
+
+template <typename ListenerT>
+void handleSessionKeepalive(const messages::MetadataView &metadata,
+                            const boost::json::value &jv,
+                            const Consumers<ListenerT> &consumers)
+{
+    // TODO: should we do something here?
+}
+
+template <typename ListenerT>
+void handleRevocation(const messages::MetadataView &metadata,
+                      const boost::json::value &jv,
+                      const Consumers<ListenerT> &consumers)
+{
+    // Listener types don't have to care about revocations, Twitch just stops
+    // sending the subscription's notifications
+    if constexpr (requires {
+                      consumers.listener.onRevocation(metadata.toMetadata(),
+                                                      jv);
+                  })
+    {
+        consumers.listener.onRevocation(metadata.toMetadata(), jv);
+    }
+}
+
+template <typename ListenerT>
+void handleNotification(const messages::MetadataView &metadataView,
+                        const boost::json::value &jv,
+                        const Consumers<ListenerT> &consumers)
+{
+    auto metadata = metadataView.toMetadata();
+
+    if (consumers.handlers.empty())
+    {
+        consumers.listener.onNotification(metadata, jv);
+    }
+
+    if (!metadata.subscriptionType || !metadata.subscriptionVersion)
+    {
+        // TODO: error handling
+        return;
+    }
+
+    PayloadTarget<ListenerT> target{consumers.listener};
+    if (!findPayloadTarget(consumers, metadataView.subscription, target))
+    {
+        return;
+    }
+
+    if (!dispatchNotification(target, metadataView.subscription,
+                              std::move(metadata), jv))
+    {
+        // TODO: error handling
+        return;
+    }
+}
+
+template <typename ListenerT>
+boost::json::error_code dispatchMessage(const Consumers<ListenerT> &consumers,
+                                        const boost::json::value &jv)
+{
+    const auto *jvObject = jv.if_object();
+    if (jvObject == nullptr)
+    {
+        static const error::ApplicationErrorCategory errorRootMustBeObject{
+            "Payload root must be an object"};
+        return boost::system::error_code{129, errorRootMustBeObject};
+    }
+
+    const auto *metadataV = jvObject->if_contains("metadata");
+    if (metadataV == nullptr)
+    {
+        static const error::ApplicationErrorCategory
+            errorRootMustContainMetadata{
+                "Payload root must contain a metadata field"};
+        return boost::system::error_code{129, errorRootMustContainMetadata};
+    }
+    auto metadataResult = try_value_to<messages::MetadataView>(*metadataV);
+    if (metadataResult.has_error())
+    {
+        // TODO: wrap error?
+        return metadataResult.error();
+    }
+
+    const auto &metadata = metadataResult.value();
+
+    const auto *payloadV = jvObject->if_contains("payload");
+    if (payloadV == nullptr)
+    {
+        static const error::ApplicationErrorCategory
+            errorRootMustContainPayload{
+                "Payload root must contain a payload field"};
+        return boost::system::error_code{129, errorRootMustContainPayload};
+    }
+
+    switch (metadata.type)
+    {
+        case messages::MessageType::SessionWelcome:
+            handleSessionWelcome(metadata, *payloadV, consumers);
+            return {};
+        case messages::MessageType::SessionKeepalive:
+            handleSessionKeepalive(metadata, *payloadV, consumers);
+            return {};
+        case messages::MessageType::SessionReconnect:
+            handleSessionReconnect(metadata, *payloadV, consumers);
+            return {};
+        case messages::MessageType::Notification:
+            handleNotification(metadata, *payloadV, consumers);
+            return {};
+
+        case messages::MessageType::Revocation:
+            handleRevocation(metadata, *payloadV, consumers);
+            return {};
+
+        case messages::MessageType::Unknown:
+            break;
+    }
+
+    std::stringstream ss;
+    ss << "No message handler found for message type: ";
+    ss << metadata.messageType;
+    error::ApplicationErrorCategory errorNoMessageHandlerForMessageType{
+        ss.str()};
+    return boost::system::error_code{129, errorNoMessageHandlerForMessageType};
+}
+
+/**
+ * Deserialize a notification straight into its payload, without building the
+ * JSON document of the message first.
+ *
+ * Returns std::nullopt if the message must be handled by dispatchMessage
+ * instead, e.g. because it's not a notification we have a handler for
+ **/
+template <typename ListenerT>
+std::optional<boost::json::error_code> dispatchNotificationDirectly(
+    const Consumers<ListenerT> &consumers,
+    const messages::MetadataView &metadata, std::string_view message,
+    sax::Parser &parser)
+{
+    if (metadata.type != messages::MessageType::Notification)
+    {
+        return std::nullopt;
+    }
+
+    PayloadTarget<ListenerT> target{consumers.listener};
+    if (!findPayloadTarget(consumers, metadata.subscription, target))
+    {
+        // Nothing consumes it, so there's no need to parse it
+        return boost::json::error_code{};
+    }
+
+    if (!dispatchNotification(target, metadata.subscription,
+                              metadata.toMetadata(), message, parser))
+    {
+        return std::nullopt;
+    }
+
+    return boost::json::error_code{};
+}
+
+}  // namespace eventsub::detail
+
+namespace eventsub {
+
+/**
+ * handleMessage parses the given message as JSON then forwards it to the
+ * listener, if applicable.
+ *
+ * The message is parsed in place, so callers with their own buffers can hand
+ * us a view into them without copying the message into a string first
+ **/
+template <typename ListenerT>
+boost::json::error_code handleMessage(ListenerT &listener,
+                                      std::string_view message)
+{
+    static const HandlerRegistry noHandlers;
+    const detail::Consumers<ListenerT> consumers{listener, noHandlers};
+
+    if (!listener.wantsNotificationJSON())
+    {
+        sax::Parser parser;
+        messages::MetadataView metadata;
+        if (detail::readMetadata(message, parser, metadata))
+        {
+            if (auto ec = detail::dispatchNotificationDirectly(
+                    consumers, metadata, message, parser))
+            {
+                return *ec;
+            }
+        }
+    }
+
+    boost::json::error_code parseError;
+    auto jv = boost::json::parse(
+        boost::json::string_view{message.data(), message.size()}, parseError);
+    if (parseError)
+    {
+        // TODO: wrap error?
+        return parseError;
+    }
+
+    return detail::dispatchMessage(consumers, jv);
+}
+
+}  // namespace eventsub
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <boost/json.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace eventsub {
+
+/**
+ * FrameArena is a bump allocator for the JSON document of a single frame.
+ *
+ * Deallocating is a no-op; everything allocated for a frame is released at
+ * once by calling reset() after the frame has been dispatched.
+ *
+ * If a frame does not fit in the arena's block, the rest is allocated from the
+ * heap and the block is grown on the next reset, so after a few frames the
+ * arena is sized for the frames we actually receive and no allocations happen.
+ **/
+class FrameArena final : public boost::json::memory_resource
+{
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+    // Frames bigger than this will always be partially allocated on the heap,
+    // so a single huge frame can't pin a huge block for the rest of the session
+    static constexpr std::size_t MAX_BLOCK_SIZE = 1024 * 1024;
+
+    explicit FrameArena(std::size_t initialBlockSize = DEFAULT_BLOCK_SIZE);
+
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // Release everything that has been allocated since the last reset.
+    // Nothing allocated from this arena may be used after this call.
+    void reset();
+
+    // The most bytes a single frame has allocated from this arena
+    std::size_t highWaterMark() const noexcept;
+
+    // The size of the block frames are allocated from
+    std::size_t blockSize() const noexcept;
+
+private:
+    void *do_allocate(std::size_t n, std::size_t align) override;
+    void do_deallocate(void *p, std::size_t n, std::size_t align) override;
+    bool do_is_equal(
+        const boost::json::memory_resource &mr) const noexcept override;
+
+    std::unique_ptr<unsigned char[]> block;
+    std::size_t size;
+
+    // Number of bytes used in the block
+    std::size_t used = 0;
+
+    // Allocations that did not fit in the block
+    std::vector<std::unique_ptr<unsigned char[]>> overflow;
+
+    // Number of bytes requested since the last reset
+    std::size_t frameBytes = 0;
+
+    std::size_t highWater = 0;
+};
+
+}  // namespace eventsub
+
+namespace boost::json {
+
+// Lets Boost.JSON skip destroying & deallocating values stored in the arena
+template <>
+struct is_deallocate_trivial<eventsub::FrameArena> : std::true_type {
+};
+
+}  // namespace boost::json
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/payloads/channel-ban-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-message-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-notification-v1.hpp"
+#include "twitch-eventsub-ws/payloads/channel-update-v1.hpp"
+#include "twitch-eventsub-ws/payloads/stream-offline-v1.hpp"
+#include "twitch-eventsub-ws/payloads/stream-online-v1.hpp"
+#include "twitch-eventsub-ws/shared-payload.hpp"
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eventsub {
+
+// The subscription whose notifications carry the given payload
+template <typename Payload>
+struct PayloadSubscription;
+
+// Subscription types
+template <>
+struct PayloadSubscription<payload::channel_ban::v1::Payload> {
+    static constexpr auto VALUE = messages::Subscription::ChannelBanV1;
+};
+
+template <>
+struct PayloadSubscription<payload::stream_online::v1::Payload> {
+    static constexpr auto VALUE = messages::Subscription::StreamOnlineV1;
+};
+
+template <>
+struct PayloadSubscription<payload::stream_offline::v1::Payload> {
+    static constexpr auto VALUE = messages::Subscription::StreamOfflineV1;
+};
+
+template <>
+struct PayloadSubscription<payload::channel_chat_notification::v1::Payload> {
+    static constexpr auto VALUE =
+        messages::Subscription::ChannelChatNotificationV1;
+};
+
+template <>
+struct PayloadSubscription<payload::channel_update::v1::Payload> {
+    static constexpr auto VALUE = messages::Subscription::ChannelUpdateV1;
+};
+
+template <>
+struct PayloadSubscription<payload::channel_chat_message::v1::Payload> {
+    static constexpr auto VALUE = messages::Subscription::ChannelChatMessageV1;
+};
+
+// Add your new subscription types above this line
+
+/**
+ * HandlerRegistry maps subscriptions to the handlers registered for them at
+ * runtime, e.g.
+ *
+ *   registry.on<payload::channel_ban::v1::Payload>(
+ *       [](const messages::Metadata &metadata, auto &&payload) { ... });
+ *
+ * Handlers registered with on() are called with the metadata and the
+ * deserialized payload as an rvalue, so they can take the payload by value,
+ * const reference or rvalue reference. Each payload has at most one of them.
+ *
+ * Handlers registered with share() take a SharedPayload<Payload> instead:
+ * any number of them can be registered for the same payload, and they're all
+ * given a handle to the same immutable payload, e.g.
+ *
+ *   registry.share<payload::channel_chat_message::v1::Payload>(
+ *       [](const messages::Metadata &metadata,
+ *          SharedPayload<payload::channel_chat_message::v1::Payload> payload) {
+ *           ...
+ *       });
+ *
+ * A payload either has a handler of its own or shared handlers, so
+ * registering the other kind for it fails.
+ **/
+class HandlerRegistry
+{
+public:
+    // payload points to the payload type of the subscription the handler was
+    // registered for
+    using Handler =
+        std::function<void(const messages::Metadata &metadata, void *payload)>;
+
+    // Registers fn for notifications carrying Payload, replacing the handler
+    // registered for it before. Returns false, without registering fn, if
+    // handlers sharing the payload have been registered for it
+    template <typename Payload, typename Fn>
+    bool on(Fn &&fn)
+    {
+        static_assert(
+            std::is_invocable_v<Fn &, const messages::Metadata &, Payload &&>,
+            "Handlers must take the metadata & the payload. Register handlers "
+            "taking a SharedPayload with share()");
+
+        const auto subscription = PayloadSubscription<Payload>::VALUE;
+        auto handler = [fn = std::forward<Fn>(fn)](
+                           const messages::Metadata &metadata,
+                           void *payload) mutable {
+            fn(metadata, std::move(*static_cast<Payload *>(payload)));
+        };
+
+        if (auto *existing = this->lookup(subscription))
+        {
+            if (existing->template target<Fanout<Payload>>() != nullptr)
+            {
+                return false;
+            }
+
+            *existing = std::move(handler);
+            return true;
+        }
+
+        this->handlers.emplace_back(subscription, std::move(handler));
+        return true;
+    }
+
+    // Adds fn to the handlers sharing notifications carrying Payload.
+    // Returns false, without registering fn, if a handler has been registered
+    // for the payload with on()
+    template <typename Payload, typename Fn>
+    bool share(Fn &&fn)
+    {
+        static_assert(std::is_invocable_v<Fn &, const messages::Metadata &,
+                                          SharedPayload<Payload>>,
+                      "Shared handlers must take the metadata & a "
+                      "SharedPayload. Register other handlers with on()");
+
+        const auto subscription = PayloadSubscription<Payload>::VALUE;
+        if (auto *existing = this->lookup(subscription))
+        {
+            auto *fanout = existing->template target<Fanout<Payload>>();
+            if (fanout == nullptr)
+            {
+                return false;
+            }
+
+            fanout->add(std::forward<Fn>(fn));
+            return true;
+        }
+
+        Fanout<Payload> fanout;
+        fanout.add(std::forward<Fn>(fn));
+        this->handlers.emplace_back(subscription, std::move(fanout));
+        return true;
+    }
+
+    // Returns nullptr if no handler has been registered for the subscription
+    const Handler *find(messages::Subscription subscription) const
+    {
+        for (const auto &[registered, handler] : this->handlers)
+        {
+            if (registered == subscription)
+            {
+                return &handler;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool empty() const
+    {
+        return this->handlers.empty();
+    }
+
+private:
+    // Moves the payload into a SharedPayload once, and hands a copy of that
+    // handle to each consumer
+    template <typename Payload>
+    class Fanout
+    {
+    public:
+        using Consumer = std::function<void(const messages::Metadata &metadata,
+                                            SharedPayload<Payload> payload)>;
+
+        void add(Consumer consumer)
+        {
+            this->consumers.push_back(std::move(consumer));
+        }
+
+        void operator()(const messages::Metadata &metadata, void *payload)
+        {
+            const auto shared = SharedPayload<Payload>::make(
+                std::move(*static_cast<Payload *>(payload)));
+            for (auto &consumer : this->consumers)
+            {
+                consumer(metadata, shared);
+            }
+        }
+
+    private:
+        std::vector<Consumer> consumers;
+    };
+
+    Handler *lookup(messages::Subscription subscription)
+    {
+        for (auto &[registered, handler] : this->handlers)
+        {
+            if (registered == subscription)
+            {
+                return &handler;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // There are only a handful of subscription types, so this is faster to
+    // search than a map
+    std::vector<std::pair<messages::Subscription, Handler>> handlers;
+};
+
+}  // namespace eventsub
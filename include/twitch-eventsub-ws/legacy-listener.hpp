@@ -0,0 +1,138 @@
+#pragma once
+
+#include "twitch-eventsub-ws/listener.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace eventsub {
+
+/**
+ * The old Listener interface, which takes the metadata & payloads by value.
+ *
+ * Existing listeners can keep implementing this, and be handed to a Session
+ * wrapped in a LegacyListenerAdapter.
+ **/
+class LegacyListener
+{
+public:
+    virtual ~LegacyListener() = default;
+
+    virtual void onSessionWelcome(
+        messages::Metadata metadata,
+        payload::session_welcome::Payload payload) = 0;
+
+    virtual bool wantsNotificationJSON() const
+    {
+        return true;
+    }
+
+    virtual void onNotification(messages::Metadata metadata,
+                                const boost::json::value &jv) = 0;
+
+    // Subscription types
+    virtual void onChannelBan(messages::Metadata metadata,
+                              payload::channel_ban::v1::Payload payload) = 0;
+
+    virtual void onStreamOnline(
+        messages::Metadata metadata,
+        payload::stream_online::v1::Payload payload) = 0;
+
+    virtual void onStreamOffline(
+        messages::Metadata metadata,
+        payload::stream_offline::v1::Payload payload) = 0;
+
+    virtual void onChannelChatNotification(
+        messages::Metadata metadata,
+        payload::channel_chat_notification::v1::Payload payload) = 0;
+
+    virtual void onChannelUpdate(
+        messages::Metadata metadata,
+        payload::channel_update::v1::Payload payload) = 0;
+
+    virtual void onChannelChatMessage(
+        messages::Metadata metadata,
+        payload::channel_chat_message::v1::Payload payload) = 0;
+
+    // Add your new subscription types above this line
+};
+
+/**
+ * Adapts a LegacyListener to the Listener interface.
+ *
+ * Payloads are moved into the legacy callbacks, so this only costs a copy of
+ * the metadata per event.
+ **/
+class LegacyListenerAdapter final : public Listener
+{
+public:
+    explicit LegacyListenerAdapter(std::unique_ptr<LegacyListener> _inner)
+        : inner(std::move(_inner))
+    {
+    }
+
+    void onSessionWelcome(const messages::Metadata &metadata,
+                          payload::session_welcome::Payload &&payload) override
+    {
+        this->inner->onSessionWelcome(metadata, std::move(payload));
+    }
+
+    bool wantsNotificationJSON() const override
+    {
+        return this->inner->wantsNotificationJSON();
+    }
+
+    void onNotification(const messages::Metadata &metadata,
+                        const boost::json::value &jv) override
+    {
+        this->inner->onNotification(metadata, jv);
+    }
+
+    // Subscription types
+    void onChannelBan(const messages::Metadata &metadata,
+                      payload::channel_ban::v1::Payload &&payload) override
+    {
+        this->inner->onChannelBan(metadata, std::move(payload));
+    }
+
+    void onStreamOnline(const messages::Metadata &metadata,
+                        payload::stream_online::v1::Payload &&payload) override
+    {
+        this->inner->onStreamOnline(metadata, std::move(payload));
+    }
+
+    void onStreamOffline(
+        const messages::Metadata &metadata,
+        payload::stream_offline::v1::Payload &&payload) override
+    {
+        this->inner->onStreamOffline(metadata, std::move(payload));
+    }
+
+    void onChannelChatNotification(
+        const messages::Metadata &metadata,
+        payload::channel_chat_notification::v1::Payload &&payload) override
+    {
+        this->inner->onChannelChatNotification(metadata, std::move(payload));
+    }
+
+    void onChannelUpdate(
+        const messages::Metadata &metadata,
+        payload::channel_update::v1::Payload &&payload) override
+    {
+        this->inner->onChannelUpdate(metadata, std::move(payload));
+    }
+
+    void onChannelChatMessage(
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) override
+    {
+        this->inner->onChannelChatMessage(metadata, std::move(payload));
+    }
+
+    // Add your new subscription types above this line
+
+private:
+    std::unique_ptr<LegacyListener> inner;
+};
+
+}  // namespace eventsub
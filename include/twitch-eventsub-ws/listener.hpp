@@ -1,53 +1,171 @@
 #pragma once
 
 #include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/notification.hpp"
 #include "twitch-eventsub-ws/payloads/channel-ban-v1.hpp"
 #include "twitch-eventsub-ws/payloads/channel-chat-message-v1.hpp"
 #include "twitch-eventsub-ws/payloads/channel-chat-notification-v1.hpp"
 #include "twitch-eventsub-ws/payloads/channel-update-v1.hpp"
+#include "twitch-eventsub-ws/payloads/session-reconnect.hpp"
 #include "twitch-eventsub-ws/payloads/session-welcome.hpp"
 #include "twitch-eventsub-ws/payloads/stream-offline-v1.hpp"
 #include "twitch-eventsub-ws/payloads/stream-online-v1.hpp"
 
+#include <span>
+#include <utility>
+
 namespace eventsub {
 
+/**
+ * The metadata & payloads are only passed by reference. Payloads are handed
+ * over as rvalues, so move from them if you want to keep them around; the
+ * session doesn't use them after the callback returns.
+ *
+ * Listeners written against the old interface, which took everything by
+ * value, can be wrapped in a LegacyListenerAdapter (legacy-listener.hpp).
+ **/
 class Listener
 {
 public:
     virtual ~Listener() = default;
 
     virtual void onSessionWelcome(
-        messages::Metadata metadata,
-        payload::session_welcome::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::session_welcome::Payload &&payload) = 0;
+
+    // Twitch is about to move us to another connection. The session connects
+    // to it by itself, and keeps reading from this one until the new one has
+    // been welcomed, so nothing needs to be done here
+    virtual void onSessionReconnect(
+        const messages::Metadata & /*metadata*/,
+        payload::session_reconnect::Payload && /*payload*/)
+    {
+    }
+
+    // The session lost its connection, and with it its Twitch session and
+    // subscriptions. If the session reconnects (see Session::setReconnect),
+    // onSessionWelcome is called again for the new Twitch session.
+    // In pipeline mode, this is called from the I/O thread, not a worker
+    virtual void onDisconnected(const boost::system::error_code & /*ec*/)
+    {
+    }
 
-    virtual void onNotification(messages::Metadata metadata,
+    // Twitch revoked a subscription, e.g. because the user it was made for
+    // removed the authorization. jv is the payload, which has the revoked
+    // subscription, and is only valid for the duration of this call
+    virtual void onRevocation(const messages::Metadata & /*metadata*/,
+                              const boost::json::value & /*jv*/)
+    {
+    }
+
+    // Return false if you only need the typed subscription callbacks below.
+    // Notifications for subscription types we know about are then
+    // deserialized straight into their payloads without building their JSON
+    // document first, and onNotification is only called for the other ones
+    virtual bool wantsNotificationJSON() const
+    {
+        return true;
+    }
+
+    // jv is only valid for the duration of this call, since the session
+    // reuses its memory for the next frame. To hold on to it, copy it into
+    // storage you own, e.g. boost::json::value(jv, boost::json::storage_ptr())
+    virtual void onNotification(const messages::Metadata &metadata,
                                 const boost::json::value &jv) = 0;
 
     // Subscription types
-    virtual void onChannelBan(messages::Metadata metadata,
-                              payload::channel_ban::v1::Payload payload) = 0;
+    virtual void onChannelBan(const messages::Metadata &metadata,
+                              payload::channel_ban::v1::Payload &&payload) = 0;
 
     virtual void onStreamOnline(
-        messages::Metadata metadata,
-        payload::stream_online::v1::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::stream_online::v1::Payload &&payload) = 0;
 
     virtual void onStreamOffline(
-        messages::Metadata metadata,
-        payload::stream_offline::v1::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::stream_offline::v1::Payload &&payload) = 0;
 
     virtual void onChannelChatNotification(
-        messages::Metadata metadata,
-        payload::channel_chat_notification::v1::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::channel_chat_notification::v1::Payload &&payload) = 0;
 
     virtual void onChannelUpdate(
-        messages::Metadata metadata,
-        payload::channel_update::v1::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::channel_update::v1::Payload &&payload) = 0;
 
     virtual void onChannelChatMessage(
-        messages::Metadata metadata,
-        payload::channel_chat_message::v1::Payload payload) = 0;
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) = 0;
 
     // Add your new subscription types above this line
+
+    // Batches of notifications, only used when the session batches its
+    // deliveries (Session::setBatching). By default, each notification of the
+    // batch is passed to the callback of its subscription above.
+    // The payloads may be moved from, the session clears the batch afterwards
+    virtual void onChannelBans(
+        std::span<Notification<payload::channel_ban::v1::Payload>> batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onChannelBan(notification.metadata,
+                               std::move(notification.payload));
+        }
+    }
+
+    virtual void onStreamOnlines(
+        std::span<Notification<payload::stream_online::v1::Payload>> batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onStreamOnline(notification.metadata,
+                                 std::move(notification.payload));
+        }
+    }
+
+    virtual void onStreamOfflines(
+        std::span<Notification<payload::stream_offline::v1::Payload>> batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onStreamOffline(notification.metadata,
+                                  std::move(notification.payload));
+        }
+    }
+
+    virtual void onChannelChatNotifications(
+        std::span<Notification<payload::channel_chat_notification::v1::Payload>>
+            batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onChannelChatNotification(notification.metadata,
+                                            std::move(notification.payload));
+        }
+    }
+
+    virtual void onChannelUpdates(
+        std::span<Notification<payload::channel_update::v1::Payload>> batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onChannelUpdate(notification.metadata,
+                                  std::move(notification.payload));
+        }
+    }
+
+    virtual void onChannelChatMessages(
+        std::span<Notification<payload::channel_chat_message::v1::Payload>>
+            batch)
+    {
+        for (auto &notification : batch)
+        {
+            this->onChannelChatMessage(notification.metadata,
+                                       std::move(notification.payload));
+        }
+    }
+
+    // Add your new subscription types' batch callbacks above this line
 };
 
 }  // namespace eventsub
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace eventsub {
+
+/**
+ * MessageDeduplicator remembers the IDs of the most recent messages, so a
+ * message that's received twice (e.g. on both connections while a session
+ * moves to a new one) is only delivered once.
+ *
+ * Only the last maxMessages IDs are remembered.
+ **/
+class MessageDeduplicator
+{
+public:
+    explicit MessageDeduplicator(std::size_t _maxMessages = 4096)
+        : maxMessages(_maxMessages)
+    {
+    }
+
+    // Returns false if the ID has been seen before
+    bool insert(std::string_view messageID)
+    {
+        if (this->seen.contains(messageID))
+        {
+            return false;
+        }
+
+        if (this->order.size() >= this->maxMessages)
+        {
+            this->seen.erase(this->order.front());
+            this->order.pop_front();
+        }
+
+        // Elements of a deque don't move when adding or removing at its ends,
+        // so the set can point into them
+        this->seen.insert(this->order.emplace_back(messageID));
+        return true;
+    }
+
+    void clear()
+    {
+        this->seen.clear();
+        this->order.clear();
+    }
+
+private:
+    const std::size_t maxMessages;
+
+    // Oldest first
+    std::deque<std::string> order;
+    std::unordered_set<std::string_view> seen;
+};
+
+}  // namespace eventsub
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "twitch-eventsub-ws/errors.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+#include "twitch-eventsub-ws/timestamp.hpp"
 
 #include <boost/json.hpp>
 
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace eventsub::messages {
 
@@ -24,18 +28,75 @@ namespace eventsub::messages {
 
 /// json_transform=snake_case
 struct Metadata {
-    const std::string messageID;
-    const std::string messageType;
-    // TODO: should this be chronofied?
-    const std::string messageTimestamp;
+    std::string messageID;
+    std::string messageType;
+    Timestamp messageTimestamp;
 
-    const std::optional<std::string> subscriptionType;
-    const std::optional<std::string> subscriptionVersion;
+    std::optional<std::string> subscriptionType;
+    std::optional<std::string> subscriptionVersion;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Metadata, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Metadata>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Metadata> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
+enum class MessageType : std::uint8_t {
+    Unknown,
+    SessionWelcome,
+    SessionKeepalive,
+    SessionReconnect,
+    Notification,
+    Revocation,
+};
+
+// Subscription type + subscription version of the subscriptions we support
+enum class Subscription : std::uint8_t {
+    Unknown,
+    ChannelBanV1,
+    StreamOnlineV1,
+    StreamOfflineV1,
+    ChannelChatNotificationV1,
+    ChannelUpdateV1,
+    ChannelChatMessageV1,
+    // Add your new subscription types above this line
+};
+
+MessageType parseMessageType(std::string_view messageType);
+Subscription parseSubscription(std::string_view subscriptionType,
+                               std::string_view subscriptionVersion);
+
+/**
+ * MetadataView is the metadata of a message, pointing into the message (or
+ * its JSON document) instead of owning its strings, so it's only valid for as
+ * long as that is.
+ *
+ * The message & subscription types are decoded when the view is read, so
+ * they can be dispatched on without comparing strings
+ **/
+class MetadataView
+{
+public:
+    std::string_view messageID;
+    std::string_view messageType;
+    std::string_view messageTimestamp;
+
+    std::optional<std::string_view> subscriptionType;
+    std::optional<std::string_view> subscriptionVersion;
+
+    MessageType type = MessageType::Unknown;
+    Subscription subscription = Subscription::Unknown;
+
+    // Copy the metadata into strings we own
+    Metadata toMetadata() const;
+};
+
+boost::json::result_for<MetadataView, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<MetadataView>,
+    const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<MetadataView> /*tag*/);
+
 }  // namespace eventsub::messages
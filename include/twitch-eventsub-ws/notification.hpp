@@ -0,0 +1,14 @@
+#pragma once
+
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+
+namespace eventsub {
+
+// A notification that is handed over together with others, e.g. in a batch
+template <typename Payload>
+struct Notification {
+    messages::Metadata metadata;
+    Payload payload;
+};
+
+}  // namespace eventsub
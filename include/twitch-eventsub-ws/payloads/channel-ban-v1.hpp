@@ -92,17 +92,21 @@ struct Event {
 };
 
 struct Payload {
-    const subscription::Subscription subscription;
+    subscription::Subscription subscription;
 
-    const Event event;
+    Event event;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/);
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::channel_ban::v1
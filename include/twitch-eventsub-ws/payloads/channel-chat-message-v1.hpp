@@ -144,42 +144,62 @@ struct Event {
 };
 
 struct Payload {
-    const subscription::Subscription subscription;
+    subscription::Subscription subscription;
 
-    const Event event;
+    Event event;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Badge>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Badge> /*tag*/);
+
 boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Cheermote>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Cheermote> /*tag*/);
+
 boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Emote>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Emote> /*tag*/);
+
 boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Mention>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Mention> /*tag*/);
+
 boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<MessageFragment>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<MessageFragment> /*tag*/);
+
 boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Message>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Message> /*tag*/);
+
 boost::json::result_for<Cheer, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Cheer>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Cheer> /*tag*/);
+
 boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Reply>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Reply> /*tag*/);
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/);
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::channel_chat_message::v1
@@ -182,86 +182,128 @@ struct Event {
 };
 
 struct Payload {
-    const subscription::Subscription subscription;
+    subscription::Subscription subscription;
 
-    const Event event;
+    Event event;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Badge>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Badge> /*tag*/);
+
 boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Cheermote>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Cheermote> /*tag*/);
+
 boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Emote>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Emote> /*tag*/);
+
 boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Mention>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Mention> /*tag*/);
+
 boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<MessageFragment>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<MessageFragment> /*tag*/);
+
 boost::json::result_for<Subcription, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Subcription>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Subcription> /*tag*/);
+
 boost::json::result_for<Resubscription, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Resubscription>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Resubscription> /*tag*/);
+
 boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<GiftSubscription>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<GiftSubscription> /*tag*/);
+
 boost::json::result_for<CommunityGiftSubscription, boost::json::value>::type
     tag_invoke(boost::json::try_value_to_tag<CommunityGiftSubscription>,
                const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<CommunityGiftSubscription> /*tag*/);
+
 boost::json::result_for<GiftPaidUpgrade, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<GiftPaidUpgrade>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<GiftPaidUpgrade> /*tag*/);
+
 boost::json::result_for<PrimePaidUpgrade, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<PrimePaidUpgrade>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<PrimePaidUpgrade> /*tag*/);
+
 boost::json::result_for<Raid, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Raid>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Raid> /*tag*/);
+
 boost::json::result_for<Unraid, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Unraid>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Unraid> /*tag*/);
+
 boost::json::result_for<PayItForward, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<PayItForward>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<PayItForward> /*tag*/);
+
 boost::json::result_for<Announcement, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Announcement>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Announcement> /*tag*/);
+
 boost::json::result_for<CharityDonationAmount, boost::json::value>::type
     tag_invoke(boost::json::try_value_to_tag<CharityDonationAmount>,
                const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<CharityDonationAmount> /*tag*/);
+
 boost::json::result_for<CharityDonation, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<CharityDonation>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<CharityDonation> /*tag*/);
+
 boost::json::result_for<BitsBadgeTier, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<BitsBadgeTier>,
     const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<BitsBadgeTier> /*tag*/);
+
 boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Message>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Message> /*tag*/);
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/);
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::channel_chat_notification::v1
@@ -11,39 +11,43 @@ namespace eventsub::payload::channel_update::v1 {
 /// json_transform=snake_case
 struct Event {
     // The broadcaster's user ID
-    const std::string broadcasterUserID;
+    std::string broadcasterUserID;
     // The broadcaster's user login
-    const std::string broadcasterUserLogin;
+    std::string broadcasterUserLogin;
     // The broadcaster's user display name
-    const std::string broadcasterUserName;
+    std::string broadcasterUserName;
 
     // The channel's stream title
-    const std::string title;
+    std::string title;
 
     // The channel's broadcast language
-    const std::string language;
+    std::string language;
 
     // The channels category ID
-    const std::string categoryID;
+    std::string categoryID;
     // The category name
-    const std::string categoryName;
+    std::string categoryName;
 
     // A boolean identifying whether the channel is flagged as mature
-    const bool isMature;
+    bool isMature;
 };
 
 struct Payload {
-    const subscription::Subscription subscription;
+    subscription::Subscription subscription;
 
-    const Event event;
+    Event event;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/);
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::channel_update::v1
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "twitch-eventsub-ws/errors.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+
+#include <string>
+
+namespace eventsub::payload::session_reconnect {
+
+/*
+{
+  "metadata": ...
+  "payload": {
+    "session": {
+      "id": "AQoQexAWVYKSTIu4ec_2VAxyuhAB",
+      "status": "reconnecting",
+      "keepalive_timeout_seconds": null,
+      "reconnect_url": "wss://eventsub.wss.twitch.tv?...",
+      "connected_at": "2022-11-16T10:11:12.634234626Z"
+    }
+  }
+}
+*/
+
+/// json_inner=session
+/// json_transform=snake_case
+struct Payload {
+    std::string id;
+
+    // Where to connect to before Twitch closes this connection. Subscriptions
+    // carry over to the new connection
+    std::string reconnectURL;
+};
+
+// DESERIALIZATION DEFINITION START
+boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
+// DESERIALIZATION DEFINITION END
+
+}  // namespace eventsub::payload::session_reconnect
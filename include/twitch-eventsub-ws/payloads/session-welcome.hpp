@@ -1,9 +1,11 @@
 #pragma once
 
 #include "twitch-eventsub-ws/errors.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
 
 #include <boost/json.hpp>
 
+#include <optional>
 #include <string>
 
 namespace eventsub::payload::session_welcome {
@@ -24,13 +26,20 @@ namespace eventsub::payload::session_welcome {
 */
 
 /// json_inner=session
+/// json_transform=snake_case
 struct Payload {
-    const std::string id;
+    std::string id;
+
+    // If no message arrives for this long, the connection should be assumed
+    // to be dead
+    std::optional<int> keepaliveTimeoutSeconds;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::session_welcome
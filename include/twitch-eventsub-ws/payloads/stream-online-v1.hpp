@@ -1,6 +1,7 @@
 #pragma once
 
 #include "twitch-eventsub-ws/payloads/subscription.hpp"
+#include "twitch-eventsub-ws/timestamp.hpp"
 
 #include <boost/json.hpp>
 
@@ -11,35 +12,38 @@ namespace eventsub::payload::stream_online::v1 {
 /// json_transform=snake_case
 struct Event {
     // The ID of the stream
-    const std::string id;
+    std::string id;
 
     // The broadcaster's user ID
-    const std::string broadcasterUserID;
+    std::string broadcasterUserID;
     // The broadcaster's user login
-    const std::string broadcasterUserLogin;
+    std::string broadcasterUserLogin;
     // The broadcaster's user display name
-    const std::string broadcasterUserName;
+    std::string broadcasterUserName;
 
     // The stream type (e.g. live, playlist, watch_party)
-    const std::string type;
+    std::string type;
 
     // The timestamp at which the stream went online
-    // TODO: chronofy?
-    const std::string startedAt;
+    Timestamp startedAt;
 };
 
 struct Payload {
-    const subscription::Subscription subscription;
+    subscription::Subscription subscription;
 
-    const Event event;
+    Event event;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/);
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::stream_online::v1
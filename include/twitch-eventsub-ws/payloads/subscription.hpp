@@ -1,6 +1,7 @@
 #pragma once
 
-#include "twitch-eventsub-ws/payloads/subscription.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+#include "twitch-eventsub-ws/timestamp.hpp"
 
 #include <boost/json.hpp>
 
@@ -34,33 +35,36 @@ namespace eventsub::payload::subscription {
 
 /// json_transform=snake_case
 struct Transport {
-    const std::string method;
-    const std::string sessionID;
+    std::string method;
+    std::string sessionID;
 };
 
 /// json_transform=snake_case
 struct Subscription {
-    const std::string id;
-    const std::string status;
-    const std::string type;
-    const std::string version;
+    std::string id;
+    std::string status;
+    std::string type;
+    std::string version;
 
     // TODO: How do we map condition here? vector of key/value pairs?
 
-    const Transport transport;
+    Transport transport;
 
-    // TODO: chronofy?
-    const std::string createdAt;
-    const int cost;
+    Timestamp createdAt;
+    int cost;
 };
 
 // DESERIALIZATION DEFINITION START
 boost::json::result_for<Transport, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Transport>, const boost::json::value &jvRoot);
 
+const sax::Sink &saxSink(sax::SinkTag<Transport> /*tag*/);
+
 boost::json::result_for<Subscription, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Subscription>,
     const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Subscription> /*tag*/);
 // DESERIALIZATION DEFINITION END
 
 }  // namespace eventsub::payload::subscription
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace eventsub {
+
+template <typename Value>
+struct PerfectHashEntry {
+    std::string_view first;
+    std::string_view second;
+    Value value;
+};
+
+/**
+ * PerfectHashMap is a constant lookup table from one or two strings to a value,
+ * e.g. from a subscription type & version to its handler.
+ *
+ * The hash function is seeded at compile time so that none of the keys
+ * collide, so a lookup hashes the given strings once, then compares them to
+ * the single entry they can match. No keys are built and nothing is allocated.
+ **/
+template <typename Value, std::size_t N>
+class PerfectHashMap
+{
+public:
+    using Entry = PerfectHashEntry<Value>;
+
+    // Four slots per key make it cheap to find a seed without collisions
+    static constexpr std::size_t TABLE_SIZE = [] {
+        std::size_t size = 1;
+        while (size < N * 4)
+        {
+            size *= 2;
+        }
+        return size;
+    }();
+
+    constexpr explicit PerfectHashMap(const std::array<Entry, N> &_entries)
+        : entries(_entries)
+    {
+        std::array<std::uint64_t, N> hashes{};
+        for (std::size_t i = 0; i < N; i++)
+        {
+            hashes[i] =
+                hashKey(this->entries[i].first, this->entries[i].second);
+        }
+
+        for (std::uint64_t candidate = 0; candidate < MAX_SEED; candidate++)
+        {
+            if (this->tryBuild(hashes, candidate))
+            {
+                return;
+            }
+        }
+
+        // Not a constant expression, so this fails to compile instead
+        throw "No seed maps these keys to distinct slots";
+    }
+
+    // Returns nullptr if there's no entry for the given key
+    constexpr const Value *find(std::string_view first,
+                                std::string_view second = {}) const noexcept
+    {
+        const auto slot = this->slots[this->slotOf(hashKey(first, second))];
+        if (slot == EMPTY)
+        {
+            return nullptr;
+        }
+
+        const auto &entry = this->entries[slot];
+        if (entry.first != first || entry.second != second)
+        {
+            return nullptr;
+        }
+
+        return &entry.value;
+    }
+
+    constexpr const std::array<Entry, N> &getEntries() const noexcept
+    {
+        return this->entries;
+    }
+
+private:
+    static constexpr std::uint64_t MAX_SEED = 1 << 16;
+    static constexpr std::size_t EMPTY =
+        std::numeric_limits<std::size_t>::max();
+
+    // FNV-1a over both strings, with a separator so ("ab", "c") != ("a", "bc")
+    static constexpr std::uint64_t hashKey(std::string_view first,
+                                           std::string_view second) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        const auto add = [&hash](unsigned char c) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        };
+
+        for (auto c : first)
+        {
+            add(static_cast<unsigned char>(c));
+        }
+        add(0xff);
+        for (auto c : second)
+        {
+            add(static_cast<unsigned char>(c));
+        }
+
+        return hash;
+    }
+
+    constexpr std::size_t slotOf(std::uint64_t hash) const noexcept
+    {
+        // splitmix64 finalizer
+        auto x = hash + (this->seed * 0x9e3779b97f4a7c15ULL);
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+
+        return static_cast<std::size_t>(x & (TABLE_SIZE - 1));
+    }
+
+    constexpr bool tryBuild(const std::array<std::uint64_t, N> &hashes,
+                            std::uint64_t candidate)
+    {
+        this->seed = candidate;
+        for (auto &slot : this->slots)
+        {
+            slot = EMPTY;
+        }
+
+        for (std::size_t i = 0; i < N; i++)
+        {
+            auto &slot = this->slots[this->slotOf(hashes[i])];
+            if (slot != EMPTY)
+            {
+                return false;
+            }
+            slot = i;
+        }
+
+        return true;
+    }
+
+    std::array<Entry, N> entries;
+    std::array<std::size_t, TABLE_SIZE> slots{};
+    std::uint64_t seed = 0;
+};
+
+// Builds a PerfectHashMap from a list of entries, deducing its size
+template <typename Value, std::size_t N>
+constexpr PerfectHashMap<Value, N> makePerfectHashMap(
+    const PerfectHashEntry<Value> (&entries)[N])
+{
+    std::array<PerfectHashEntry<Value>, N> array{};
+    for (std::size_t i = 0; i < N; i++)
+    {
+        array[i] = entries[i];
+    }
+
+    return PerfectHashMap<Value, N>{array};
+}
+
+}  // namespace eventsub
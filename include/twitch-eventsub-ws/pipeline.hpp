@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eventsub {
+
+// What the reading thread does when the worker's queue is full
+enum class OverflowPolicy : std::uint8_t {
+    // Stop reading from the connection until the worker has made room. The
+    // frame is kept until then, and the I/O thread carries on with other
+    // work (e.g. timers, or other sessions running on it)
+    Block,
+
+    // Drop the oldest frame in the queue to make room
+    DropOldest,
+
+    // Drop the new frame if it's a notification. Other messages (e.g.
+    // session_keepalive) wait for room like with Block
+    DropNotifications,
+};
+
+/**
+ * The workers parse & deliver frames, but spreading frames across them is
+ * left to the I/O thread: it reads the metadata of every frame, and then the
+ * broadcaster ID of every notification, which is a second pass over the frame
+ * (with simdjson, each pass indexes the frame anew). So more workers only
+ * help until the I/O thread is busy reading frames that way.
+ *
+ * All notifications of a broadcaster go to the same worker, so a single busy
+ * broadcaster can't be delivered faster than one worker can deliver it
+ **/
+struct PipelineOptions {
+    // The number of worker threads. Frames are spread across them by
+    // broadcaster, so each broadcaster's notifications are still delivered
+    // in order
+    std::size_t threads = 1;
+
+    // The most frames waiting for a worker at once
+    std::size_t queueCapacity = 1024;
+
+    OverflowPolicy overflow = OverflowPolicy::Block;
+};
+
+struct PipelineStats {
+    // Frames waiting for the workers
+    std::size_t queueDepth = 0;
+
+    // The most frames that were waiting for a worker at once
+    std::size_t queueHighWaterMark = 0;
+
+    // Frames dropped because the queue was full
+    std::size_t droppedFrames = 0;
+};
+
+}  // namespace eventsub
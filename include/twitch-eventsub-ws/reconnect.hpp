@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+namespace eventsub {
+
+struct ReconnectOptions {
+    // The first attempt is made after a random delay of up to this, so
+    // sessions that lost their connections at the same time don't all
+    // reconnect at the same time
+    std::chrono::milliseconds initialDelay{500};
+
+    // The limit of the random delay doubles with every failed attempt, up to
+    // this
+    std::chrono::milliseconds maxDelay{30000};
+
+    // Give up after this many attempts in a row. 0 never gives up
+    std::size_t maxAttempts = 0;
+};
+
+struct ReconnectStats {
+    // Lost connections that were replaced by a welcomed one
+    std::size_t reconnects = 0;
+
+    // Attempts that failed before the new connection was welcomed
+    std::size_t failedAttempts = 0;
+
+    // From losing the connection until the new one was welcomed
+    std::chrono::milliseconds lastDuration{0};
+    std::chrono::milliseconds longestDuration{0};
+    std::chrono::milliseconds totalDuration{0};
+
+    // Lookups of the session's host. Reconnecting reuses the addresses of
+    // the last one, until connecting to them fails
+    std::size_t resolves = 0;
+};
+
+/**
+ * The delay before the given reconnect attempt (counting from 0), picked at
+ * random between 0 and initialDelay * 2^attempt, capped at maxDelay
+ * ("full jitter")
+ **/
+std::chrono::milliseconds reconnectDelay(const ReconnectOptions &options,
+                                         std::size_t attempt,
+                                         std::minstd_rand &random);
+
+}  // namespace eventsub
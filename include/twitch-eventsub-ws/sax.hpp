@@ -0,0 +1,316 @@
+#pragma once
+
+#include "twitch-eventsub-ws/chrono.hpp"
+
+#include <boost/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Deserializes JSON straight into our structs from the parser callbacks,
+ * without building a boost::json::value first.
+ *
+ * Every type we can deserialize has a Sink, which knows how to write JSON
+ * values into an object of that type. The sinks for our structs are generated
+ * alongside their tag_invoke implementations, and are looked up through
+ * saxSink(SinkTag<T>) the same way tag_invoke is looked up.
+ **/
+namespace eventsub::sax {
+
+template <typename T>
+struct SinkTag {
+};
+
+class Sink;
+
+// Where the next value in the document will be written to
+struct Slot {
+    void *target = nullptr;
+
+    // If this is nullptr, the value will be skipped
+    const Sink *sink = nullptr;
+};
+
+class Sink
+{
+public:
+    enum class Kind : std::uint8_t {
+        Value,
+        Object,
+        Array,
+        Optional,
+    };
+
+    virtual ~Sink() = default;
+
+    virtual Kind kind() const
+    {
+        return Kind::Value;
+    }
+
+    // Objects: Figure out where the value for the given key goes.
+    // seen is the set of members that have been read so far
+    virtual boost::json::error_code onKey(void *target, std::string_view key,
+                                          std::uint64_t &seen,
+                                          Slot &next) const;
+    virtual boost::json::error_code onObjectEnd(void *target,
+                                                std::uint64_t seen) const;
+
+    // Arrays: Add a new element and return its slot
+    virtual void onArrayBegin(void *target) const;
+    virtual Slot onElement(void *target) const;
+
+    // Optionals: Construct the contained value and return its slot
+    virtual Slot emplace(void *target) const;
+
+    virtual boost::json::error_code onString(void *target,
+                                             std::string_view value) const;
+    virtual boost::json::error_code onInt64(void *target,
+                                            std::int64_t value) const;
+    virtual boost::json::error_code onBool(void *target, bool value) const;
+    virtual boost::json::error_code onNull(void *target) const;
+};
+
+// Returned when a JSON value doesn't match the type it is deserialized into
+boost::json::error_code unexpectedType();
+
+template <typename T>
+class ObjectSink final : public Sink
+{
+public:
+    using MemberFunction = Slot (*)(T &out, std::string_view key,
+                                    std::uint64_t &seen);
+    using MissingFunction = boost::json::error_code (*)(std::uint64_t seen);
+
+    ObjectSink(MemberFunction _member, MissingFunction _missing)
+        : member(_member)
+        , missing(_missing)
+    {
+    }
+
+    Kind kind() const override
+    {
+        return Kind::Object;
+    }
+
+    boost::json::error_code onKey(void *target, std::string_view key,
+                                  std::uint64_t &seen,
+                                  Slot &next) const override
+    {
+        next = this->member(*static_cast<T *>(target), key, seen);
+        return {};
+    }
+
+    boost::json::error_code onObjectEnd(void * /*target*/,
+                                        std::uint64_t seen) const override
+    {
+        return this->missing(seen);
+    }
+
+private:
+    const MemberFunction member;
+    const MissingFunction missing;
+};
+
+template <typename T>
+class VectorSink final : public Sink
+{
+public:
+    explicit VectorSink(const Sink &_element)
+        : element(_element)
+    {
+    }
+
+    Kind kind() const override
+    {
+        return Kind::Array;
+    }
+
+    void onArrayBegin(void *target) const override
+    {
+        static_cast<std::vector<T> *>(target)->clear();
+    }
+
+    Slot onElement(void *target) const override
+    {
+        auto &value = static_cast<std::vector<T> *>(target)->emplace_back();
+        return {&value, &this->element};
+    }
+
+private:
+    const Sink &element;
+};
+
+template <typename T>
+class OptionalSink final : public Sink
+{
+public:
+    explicit OptionalSink(const Sink &_inner)
+        : inner(_inner)
+    {
+    }
+
+    Kind kind() const override
+    {
+        return Kind::Optional;
+    }
+
+    Slot emplace(void *target) const override
+    {
+        auto &value = static_cast<std::optional<T> *>(target)->emplace();
+        return {&value, &this->inner};
+    }
+
+    boost::json::error_code onNull(void *target) const override
+    {
+        static_cast<std::optional<T> *>(target)->reset();
+        return {};
+    }
+
+private:
+    const Sink &inner;
+};
+
+const Sink &saxSink(SinkTag<std::string> /*tag*/);
+// The view points into the document being parsed, unless the string had to be
+// unescaped or was split across writes, in which case it points into the
+// parser's own buffer and is only valid until the next callback
+const Sink &saxSink(SinkTag<std::string_view> /*tag*/);
+const Sink &saxSink(SinkTag<int> /*tag*/);
+const Sink &saxSink(SinkTag<bool> /*tag*/);
+const Sink &saxSink(SinkTag<std::chrono::system_clock::time_point> /*tag*/,
+                    const AsISO8601 & /*tag*/);
+
+template <typename T, typename... Tag>
+const Sink &saxSink(SinkTag<std::optional<T>> /*tag*/, const Tag &...tag)
+{
+    static const OptionalSink<T> sink{saxSink(SinkTag<T>{}, tag...)};
+    return sink;
+}
+
+template <typename T>
+const Sink &saxSink(SinkTag<std::vector<T>> /*tag*/)
+{
+    static const VectorSink<T> sink{saxSink(SinkTag<T>{})};
+    return sink;
+}
+
+// The slot that deserializes into target, using any JSON tags (e.g. AsISO8601)
+template <typename T, typename... Tag>
+Slot slot(T &target, const Tag &...tag)
+{
+    return {&target, &saxSink(SinkTag<T>{}, tag...)};
+}
+
+/**
+ * Handler for boost::json::basic_parser which forwards the parser callbacks
+ * to the sinks, starting at the root slot given to reset().
+ *
+ * Keys and members that have no sink are skipped.
+ **/
+class Handler
+{
+public:
+    static constexpr std::size_t max_object_size =
+        std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t max_array_size =
+        std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t max_key_size =
+        std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t max_string_size =
+        std::numeric_limits<std::size_t>::max();
+
+    // Prepare for a new document, which will be written into root
+    void reset(Slot root);
+
+    bool on_document_begin(boost::json::error_code &ec);
+    bool on_document_end(boost::json::error_code &ec);
+    bool on_object_begin(boost::json::error_code &ec);
+    bool on_object_end(std::size_t n, boost::json::error_code &ec);
+    bool on_array_begin(boost::json::error_code &ec);
+    bool on_array_end(std::size_t n, boost::json::error_code &ec);
+    bool on_key_part(boost::json::string_view s, std::size_t n,
+                     boost::json::error_code &ec);
+    bool on_key(boost::json::string_view s, std::size_t n,
+                boost::json::error_code &ec);
+    bool on_string_part(boost::json::string_view s, std::size_t n,
+                        boost::json::error_code &ec);
+    bool on_string(boost::json::string_view s, std::size_t n,
+                   boost::json::error_code &ec);
+    bool on_number_part(boost::json::string_view s,
+                        boost::json::error_code &ec);
+    bool on_int64(std::int64_t i, boost::json::string_view s,
+                  boost::json::error_code &ec);
+    bool on_uint64(std::uint64_t u, boost::json::string_view s,
+                   boost::json::error_code &ec);
+    bool on_double(double d, boost::json::string_view s,
+                   boost::json::error_code &ec);
+    bool on_bool(bool b, boost::json::error_code &ec);
+    bool on_null(boost::json::error_code &ec);
+    bool on_comment_part(boost::json::string_view s,
+                         boost::json::error_code &ec);
+    bool on_comment(boost::json::string_view s, boost::json::error_code &ec);
+
+private:
+    // The slot of the value that is starting
+    Slot nextSlot();
+
+    // Same as nextSlot, but constructs the value if it's optional
+    Slot nextValueSlot();
+
+    // Returns the full key or string, joining it with any previous parts
+    std::string_view joinParts(boost::json::string_view s);
+
+    struct Frame {
+        Slot slot;
+        std::uint64_t seen = 0;
+    };
+
+    std::vector<Frame> stack;
+    Slot next;
+
+    // How deep we are in an object or array we are skipping
+    std::size_t skipDepth = 0;
+
+    // Keys & strings that were split into multiple parts
+    std::string parts;
+};
+
+/**
+ * Parses a whole JSON document into a slot.
+ *
+ * Which JSON parser does the work is picked at build time: Boost.JSON's
+ * basic_parser (with the Handler above) by default, or simdjson's On Demand
+ * parser if TWITCH_EVENTSUB_WS_USE_SIMDJSON is enabled. Both drive the same
+ * sinks, so the generated deserializers don't care which one is used.
+ *
+ * Parsing stops at the first error, including errors returned by a sink.
+ * The parser's buffers are reused for every document. With simdjson, parsing
+ * the same document again (e.g. a message's payload after its metadata)
+ * reuses its index instead of building it again.
+ **/
+class Parser
+{
+public:
+    Parser();
+    ~Parser();
+
+    Parser(const Parser &) = delete;
+    Parser &operator=(const Parser &) = delete;
+
+    boost::json::error_code parse(std::string_view json, Slot root);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+}  // namespace eventsub::sax
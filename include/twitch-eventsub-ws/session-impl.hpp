@@ -0,0 +1,1246 @@
+#pragma once
+
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/session.hpp"
+
+#include <boost/asio.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <boost/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+/**
+ * The implementation of BasicSession.
+ *
+ * BasicSession<Listener> (i.e. Session) is compiled into the library, so this
+ * only needs to be included to use a BasicSession with your own listener type.
+ **/
+namespace eventsub {
+
+// Resolver and socket require an io_context
+template <typename ListenerT>
+BasicSession<ListenerT>::BasicSession(boost::asio::io_context &ioc,
+                                      boost::asio::ssl::context &ctx,
+                                      std::unique_ptr<ListenerT> listener)
+    : strand(boost::asio::make_strand(ioc))
+    , ctx(ctx)
+    , listener(std::move(listener))
+    , keepaliveTimer(this->strand)
+    , reconnectTimer(this->strand)
+    , batchTimer(this->strand)
+{
+}
+
+template <typename ListenerT>
+BasicSession<ListenerT>::BasicSession(boost::asio::io_context &ioc,
+                                      boost::asio::ssl::context &ctx)
+    : BasicSession(ioc, ctx, makeDefaultListener<ListenerT>())
+{
+}
+
+template <typename ListenerT>
+BasicSession<ListenerT>::~BasicSession()
+{
+    for (auto &shard : this->shards)
+    {
+        if (shard->thread.joinable())
+        {
+            shard->frames.interrupt();
+            shard->thread.join();
+        }
+    }
+}
+
+// Start the asynchronous operation
+template <typename ListenerT>
+void BasicSession<ListenerT>::run(std::string _host, std::string _port,
+                                  std::string _path, std::string _userAgent)
+{
+    // Save these for later
+    this->userAgent = std::move(_userAgent);
+
+    this->endpoint = {
+        .host = std::move(_host),
+        .port = std::move(_port),
+        .path = std::move(_path),
+    };
+
+    this->connection = std::make_shared<Connection>(this->strand, this->ctx);
+    this->connection->host = this->endpoint.host;
+    this->connection->port = this->endpoint.port;
+    this->connection->path = this->endpoint.path;
+
+    for (auto &shard : this->shards)
+    {
+        shard->thread = std::thread([this, worker = shard.get()] {
+            this->runWorker(*worker);
+        });
+    }
+
+    this->connect(this->connection);
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::connect(std::shared_ptr<Connection> connection)
+{
+    if (this->resolvedEndpoint && connection->host == this->endpoint.host &&
+        connection->port == this->endpoint.port)
+    {
+        // We've looked it up before
+        return this->onResolve(std::move(connection), {},
+                               *this->resolvedEndpoint);
+    }
+
+    if (connection->host == this->endpoint.host &&
+        connection->port == this->endpoint.port)
+    {
+        this->resolves++;
+    }
+
+    // Look up the domain name
+    auto &resolver = connection->resolver;
+    resolver.async_resolve(
+        connection->host, connection->port,
+        boost::beast::bind_front_handler(&BasicSession::onResolve,
+                                         this->shared_from_this(),
+                                         std::move(connection)));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onResolve(
+    std::shared_ptr<Connection> connection, boost::beast::error_code ec,
+    boost::asio::ip::tcp::resolver::results_type results)
+{
+    if (this->isAbandoned(connection))
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        return this->connectionFailed(connection, ec, "resolve");
+    }
+
+    if (connection->host == this->endpoint.host &&
+        connection->port == this->endpoint.port)
+    {
+        this->resolvedEndpoint = results;
+    }
+
+    // Set a timeout on the operation
+    boost::beast::get_lowest_layer(connection->ws)
+        .expires_after(std::chrono::seconds(30));
+
+    // Make the connection on the IP address we get from a lookup
+    auto &ws = connection->ws;
+    boost::beast::get_lowest_layer(ws).async_connect(
+        results, boost::beast::bind_front_handler(&BasicSession::onConnect,
+                                                  this->shared_from_this(),
+                                                  std::move(connection)));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onConnect(
+    std::shared_ptr<Connection> connection, boost::beast::error_code ec,
+    boost::asio::ip::tcp::resolver::results_type::endpoint_type ep)
+{
+    if (this->isAbandoned(connection))
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        // The addresses might be stale, look them up again next time
+        this->resolvedEndpoint.reset();
+        return this->connectionFailed(connection, ec, "connect");
+    }
+
+    // Set a timeout on the operation
+    boost::beast::get_lowest_layer(connection->ws)
+        .expires_after(std::chrono::seconds(30));
+
+    // Set SNI Hostname (many hosts need this to handshake successfully)
+    if (!SSL_set_tlsext_host_name(connection->ws.next_layer().native_handle(),
+                                  connection->host.c_str()))
+    {
+        ec = boost::beast::error_code(static_cast<int>(::ERR_get_error()),
+                                      boost::asio::error::get_ssl_category());
+        return this->connectionFailed(connection, ec, "connect");
+    }
+
+    // Update the host_ string. This will provide the value of the
+    // Host HTTP header during the WebSocket handshake.
+    // See https://tools.ietf.org/html/rfc7230#section-5.4
+    connection->host += ':' + std::to_string(ep.port());
+
+    // Perform the SSL handshake
+    auto &ws = connection->ws;
+    ws.next_layer().async_handshake(
+        boost::asio::ssl::stream_base::client,
+        boost::beast::bind_front_handler(&BasicSession::onSSLHandshake,
+                                         this->shared_from_this(),
+                                         std::move(connection)));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onSSLHandshake(
+    std::shared_ptr<Connection> connection, boost::beast::error_code ec)
+{
+    if (this->isAbandoned(connection))
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        return this->connectionFailed(connection, ec, "ssl_handshake");
+    }
+
+    auto &ws = connection->ws;
+
+    // Turn off the timeout on the tcp_stream, because
+    // the websocket stream has its own timeout system.
+    boost::beast::get_lowest_layer(ws).expires_never();
+
+    // Set suggested timeout settings for the websocket
+    ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
+        boost::beast::role_type::client));
+
+    // Set a decorator to change the User-Agent of the handshake
+    ws.set_option(boost::beast::websocket::stream_base::decorator(
+        [userAgent{this->userAgent}](
+            boost::beast::websocket::request_type &req) {
+            req.set(boost::beast::http::field::user_agent, userAgent);
+        }));
+
+    // Perform the websocket handshake
+    ws.async_handshake(connection->host, connection->path,
+                       boost::beast::bind_front_handler(
+                           &BasicSession::onHandshake, this->shared_from_this(),
+                           std::move(connection)));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onHandshake(
+    std::shared_ptr<Connection> connection, boost::beast::error_code ec)
+{
+    if (this->isAbandoned(connection))
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        return this->connectionFailed(connection, ec, "handshake");
+    }
+
+    // Start with the buffer an earlier connection has grown, if there is one
+    if (this->spareBuffer.capacity() > connection->buffer.capacity())
+    {
+        connection->buffer = std::exchange(this->spareBuffer, {});
+    }
+
+    this->read(std::move(connection));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::read(std::shared_ptr<Connection> connection)
+{
+    auto &ws = connection->ws;
+    auto &buffer = connection->buffer;
+    ws.async_read(buffer, boost::beast::bind_front_handler(
+                              &BasicSession::onRead, this->shared_from_this(),
+                              std::move(connection)));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onRead(std::shared_ptr<Connection> connection,
+                                     boost::beast::error_code ec,
+                                     std::size_t bytes_transferred)
+{
+    boost::ignore_unused(bytes_transferred);
+
+    if (this->isAbandoned(connection))
+    {
+        this->recycle(*connection);
+        return;
+    }
+
+    if (ec)
+    {
+        this->recycle(*connection);
+
+        if (connection == this->previousConnection)
+        {
+            // Twitch closes the old connection once the new one is welcomed,
+            // so every notification has been received on the new one by now
+            this->previousConnection.reset();
+            this->deduplicator.clear();
+            return;
+        }
+
+        return this->connectionFailed(connection, ec, "read");
+    }
+
+    if (connection == this->connection)
+    {
+        this->lastFrame = std::chrono::steady_clock::now();
+    }
+
+    auto &buffer = connection->buffer;
+    const auto data = buffer.data();
+    const std::string_view message{static_cast<const char *>(data.data()),
+                                   data.size()};
+
+    // If the metadata can't be read up front, the frame can't be a
+    // session_reconnect or session_welcome sent by Twitch, which always put
+    // the metadata first
+    messages::MetadataView metadata;
+    const bool hasMetadata =
+        detail::readMetadata(message, this->dispatcher.saxParser, metadata);
+    if (hasMetadata && !this->admitFrame(connection, message, metadata))
+    {
+        buffer.clear();
+        return this->read(std::move(connection));
+    }
+
+    if (!this->shards.empty())
+    {
+        if (!this->enqueueFrame(connection, hasMetadata ? &metadata : nullptr))
+        {
+            return;
+        }
+    }
+    else
+    {
+        if (auto ec = this->handleFrame(this->dispatcher, message,
+                                        hasMetadata ? &metadata : nullptr))
+        {
+            // Only this frame is lost, the connection is fine
+            this->messageErrors++;
+            detail::fail(ec, "handleMessage");
+        }
+
+        if (this->router)
+        {
+            // No routed listener is in use between frames
+            this->router->collect();
+        }
+
+        if (this->dispatcher.batcher)
+        {
+            this->scheduleBatch();
+        }
+
+        buffer.clear();
+    }
+
+    this->read(std::move(connection));
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::admitFrame(
+    const std::shared_ptr<Connection> &connection, std::string_view message,
+    const messages::MetadataView &metadata)
+{
+    const bool isCurrent = connection == this->connection;
+
+    switch (metadata.type)
+    {
+        case messages::MessageType::SessionReconnect:
+            if (!isCurrent)
+            {
+                return false;
+            }
+            this->startReconnect(message);
+            return true;
+
+        case messages::MessageType::SessionWelcome:
+            if (connection != this->nextConnection)
+            {
+                if (isCurrent)
+                {
+                    this->watchKeepalive(message);
+                    if (this->reconnectStartedAt)
+                    {
+                        this->reconnected();
+                    }
+                }
+                return isCurrent;
+            }
+
+            // The subscriptions carried over to the new connection, so the
+            // listener doesn't need to know. From now on, the old connection
+            // only delivers what the new one hasn't
+            this->previousConnection = std::exchange(
+                this->connection, std::exchange(this->nextConnection, nullptr));
+            this->watchKeepalive(message);
+            return false;
+
+        case messages::MessageType::Notification:
+            if ((this->nextConnection || this->previousConnection) &&
+                !this->deduplicator.insert(metadata.messageID))
+            {
+                this->duplicateNotifications++;
+                return false;
+            }
+            return true;
+
+        case messages::MessageType::SessionKeepalive:
+        case messages::MessageType::Revocation:
+        case messages::MessageType::Unknown:
+            // Keepalives of the connection we're moving to aren't interesting
+            // until it's the current one
+            return isCurrent || connection == this->previousConnection;
+    }
+
+    return true;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::startReconnect(std::string_view message)
+{
+    if (this->nextConnection)
+    {
+        // Already on our way
+        return;
+    }
+
+    auto oPayload = detail::parsePayload<payload::session_reconnect::Payload>(
+        message, this->dispatcher.saxParser);
+    if (!oPayload)
+    {
+        return;
+    }
+
+    auto url = detail::parseWebSocketURL(oPayload->reconnectURL);
+    if (!url)
+    {
+        static const error::ApplicationErrorCategory errorInvalidReconnectURL{
+            "Reconnect URL must be a wss:// URL"};
+        return detail::fail(
+            boost::system::error_code{129, errorInvalidReconnectURL},
+            "reconnect");
+    }
+
+    // Keep reading from the current connection while we connect, so nothing
+    // sent to it in the meantime is missed
+    this->nextConnection =
+        std::make_shared<Connection>(this->strand, this->ctx);
+    this->nextConnection->host = std::move(url->host);
+    this->nextConnection->port = std::move(url->port);
+    this->nextConnection->path = std::move(url->path);
+
+    this->deduplicator.clear();
+    this->connect(this->nextConnection);
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::connectionFailed(
+    const std::shared_ptr<Connection> &connection, boost::beast::error_code ec,
+    const char *what)
+{
+    detail::fail(ec, what);
+
+    if (connection == this->nextConnection)
+    {
+        // Stay on the current connection until Twitch closes it
+        this->nextConnection.reset();
+        return;
+    }
+
+    // In pipeline mode, the workers deliver their batch once they run dry
+    if (this->dispatcher.batcher && this->shards.empty())
+    {
+        this->dispatcher.batcher->flush();
+    }
+
+    this->reportDisconnect(ec);
+
+    if (this->reconnectOptions)
+    {
+        return this->scheduleReconnect();
+    }
+
+    // The session is over, there's nothing left to watch
+    this->keepaliveTimeout = std::chrono::seconds{0};
+    if (this->reconnectStartedAt)
+    {
+        this->failedReconnectAttempts++;
+        this->reconnectStartedAt.reset();
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::reportDisconnect(boost::beast::error_code ec)
+{
+    if constexpr (requires { this->listener->onDisconnected(ec); })
+    {
+        this->listener->onDisconnected(ec);
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::scheduleReconnect()
+{
+    if (this->reconnectTimerArmed)
+    {
+        return;
+    }
+
+    if (this->reconnectStartedAt)
+    {
+        // The previous attempt didn't make it to a session_welcome
+        this->failedReconnectAttempts++;
+    }
+    else
+    {
+        this->reconnectStartedAt = std::chrono::steady_clock::now();
+        this->reconnectAttempts = 0;
+    }
+
+    // Nothing is delivered from the old connections while we wait
+    this->abandon(this->connection);
+    this->abandon(this->nextConnection);
+    this->abandon(this->previousConnection);
+    this->connection.reset();
+    this->nextConnection.reset();
+    this->previousConnection.reset();
+    this->deduplicator.clear();
+
+    // Until the new connection is welcomed
+    this->keepaliveTimeout = std::chrono::seconds{0};
+
+    const auto options = this->reconnectOptions.value_or(ReconnectOptions{
+        .initialDelay = std::chrono::milliseconds{0},
+        .maxDelay = std::chrono::milliseconds{0},
+        .maxAttempts = 1,
+    });
+    if (options.maxAttempts != 0 &&
+        this->reconnectAttempts >= options.maxAttempts)
+    {
+        static const error::ApplicationErrorCategory errorGaveUpReconnecting{
+            "Gave up reconnecting"};
+        detail::fail(boost::system::error_code{129, errorGaveUpReconnecting},
+                     "reconnect");
+        this->reconnectStartedAt.reset();
+        return;
+    }
+
+    this->reconnectTimerArmed = true;
+    this->reconnectTimer.expires_after(
+        reconnectDelay(options, this->reconnectAttempts++, this->random));
+    this->reconnectTimer.async_wait(boost::beast::bind_front_handler(
+        &BasicSession::onReconnectTimer, this->shared_from_this()));
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onReconnectTimer(boost::beast::error_code ec)
+{
+    this->reconnectTimerArmed = false;
+
+    if (ec)
+    {
+        return;
+    }
+
+    this->reconnect();
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::reconnect()
+{
+    this->connection = std::make_shared<Connection>(this->strand, this->ctx);
+    this->connection->host = this->endpoint.host;
+    this->connection->port = this->endpoint.port;
+    this->connection->path = this->endpoint.path;
+    this->connect(this->connection);
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::reconnected()
+{
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - *this->reconnectStartedAt)
+            .count();
+    this->reconnectStartedAt.reset();
+    this->reconnectAttempts = 0;
+
+    // Only written on the strand
+    this->reconnects++;
+    this->lastReconnectDuration.store(duration);
+    this->totalReconnectDuration.fetch_add(duration);
+    if (duration > this->longestReconnectDuration.load())
+    {
+        this->longestReconnectDuration.store(duration);
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::recycle(Connection &connection)
+{
+    if (connection.buffer.capacity() > this->spareBuffer.capacity())
+    {
+        connection.buffer.clear();
+        this->spareBuffer = std::move(connection.buffer);
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::abandon(
+    const std::shared_ptr<Connection> &connection)
+{
+    if (!connection)
+    {
+        return;
+    }
+
+    // Whatever is in flight completes with an error, which is ignored since
+    // the connection isn't ours anymore
+    connection->resolver.cancel();
+    boost::beast::get_lowest_layer(connection->ws).close();
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::isAbandoned(
+    const std::shared_ptr<Connection> &connection) const
+{
+    return connection != this->connection &&
+           connection != this->nextConnection &&
+           connection != this->previousConnection;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::watchKeepalive(std::string_view message)
+{
+    auto oPayload = detail::parsePayload<payload::session_welcome::Payload>(
+        message, this->dispatcher.saxParser);
+    if (!oPayload || !oPayload->keepaliveTimeoutSeconds ||
+        *oPayload->keepaliveTimeoutSeconds <= 0)
+    {
+        this->keepaliveTimeout = std::chrono::seconds{0};
+        return;
+    }
+
+    this->keepaliveTimeout =
+        std::chrono::seconds{*oPayload->keepaliveTimeoutSeconds};
+    this->lastFrame = std::chrono::steady_clock::now();
+
+    // An armed timer picks up the new timeout when it expires
+    if (!this->keepaliveTimerArmed)
+    {
+        this->armKeepaliveTimer();
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::armKeepaliveTimer()
+{
+    this->keepaliveTimerArmed = true;
+    this->keepaliveTimer.expires_at(this->keepaliveDeadline());
+    this->keepaliveTimer.async_wait(boost::beast::bind_front_handler(
+        &BasicSession::onKeepaliveTimer, this->shared_from_this()));
+}
+
+template <typename ListenerT>
+std::chrono::steady_clock::time_point
+    BasicSession<ListenerT>::keepaliveDeadline() const
+{
+    return this->lastFrame + this->keepaliveTimeout + KEEPALIVE_SLACK;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onKeepaliveTimer(boost::beast::error_code ec)
+{
+    this->keepaliveTimerArmed = false;
+
+    if (ec || this->keepaliveTimeout.count() == 0)
+    {
+        return;
+    }
+
+    if (std::chrono::steady_clock::now() < this->keepaliveDeadline())
+    {
+        // Frames arrived since the timer was armed
+        this->armKeepaliveTimer();
+        return;
+    }
+
+    if (this->isBlocked(this->connection))
+    {
+        // We stopped reading from it ourselves, with a frame in hand
+        this->lastFrame = std::chrono::steady_clock::now();
+        this->armKeepaliveTimer();
+        return;
+    }
+
+    static const error::ApplicationErrorCategory errorKeepaliveTimeout{
+        "No message received within the keepalive timeout"};
+    const boost::system::error_code timeoutError{129, errorKeepaliveTimeout};
+    detail::fail(timeoutError, "keepalive");
+
+    this->reportDisconnect(timeoutError);
+    this->scheduleReconnect();
+}
+
+template <typename ListenerT>
+boost::json::error_code BasicSession<ListenerT>::handleFrame(
+    Dispatcher &dispatcher, std::string_view message,
+    const messages::MetadataView *knownMetadata)
+{
+    // The session's listener, unless the router has one for the broadcaster
+    ListenerT *listener = this->listener.get();
+
+    messages::MetadataView metadata;
+    bool hasMetadata = false;
+
+    // Keeps the routed listener alive until it has handled the frame
+    const bool routing = this->router != nullptr;
+    std::optional<typename BasicBroadcasterRouter<ListenerT>::Reader>
+        routerReader;
+    if (knownMetadata != nullptr)
+    {
+        metadata = *knownMetadata;
+        hasMetadata = true;
+    }
+    else if (!this->listener->wantsNotificationJSON() ||
+             !this->handlers.empty() || !this->interests.empty() ||
+             !this->broadcasterFilter.empty() || routing)
+    {
+        hasMetadata =
+            detail::readMetadata(message, dispatcher.saxParser, metadata);
+    }
+
+    if (hasMetadata)
+    {
+        if (!this->isInterestedIn(metadata))
+        {
+            // Nothing after the metadata has been parsed
+            this->droppedNotifications++;
+            return {};
+        }
+
+        if (metadata.type == messages::MessageType::Notification &&
+            (!this->broadcasterFilter.empty() || routing))
+        {
+            const auto broadcasterID =
+                readBroadcasterID(message, dispatcher.saxParser);
+            if (!this->broadcasterFilter.wants(broadcasterID))
+            {
+                // Nothing but the broadcaster ID has been parsed
+                this->filteredFrames++;
+                return {};
+            }
+
+            if (routing && broadcasterID)
+            {
+                routerReader.emplace(*this->router);
+                if (auto *routed = this->router->find(*broadcasterID))
+                {
+                    listener = routed;
+                }
+            }
+        }
+    }
+
+    this->deliveredFrames++;
+
+    const auto *frameMetadata = hasMetadata ? &metadata : nullptr;
+    if (dispatcher.batcher && listener == this->listener.get())
+    {
+        return this->dispatchFrame(dispatcher, *dispatcher.batcher, message,
+                                   frameMetadata);
+    }
+
+    return this->dispatchFrame(dispatcher, *listener, message, frameMetadata);
+}
+
+template <typename ListenerT>
+template <typename Target>
+boost::json::error_code BasicSession<ListenerT>::dispatchFrame(
+    Dispatcher &dispatcher, Target &target, std::string_view message,
+    const messages::MetadataView *metadata)
+{
+    const detail::Consumers<Target> consumers{target, this->handlers};
+
+    // Registered handlers only ever want the typed payloads
+    if (metadata != nullptr &&
+        (!target.wantsNotificationJSON() || !this->handlers.empty()))
+    {
+        if (auto ec = detail::dispatchNotificationDirectly(
+                consumers, *metadata, message, dispatcher.saxParser))
+        {
+            return *ec;
+        }
+    }
+
+    boost::json::error_code ec;
+    dispatcher.parser.reset(&dispatcher.arena);
+    dispatcher.parser.write(message.data(), message.size(), ec);
+    if (!ec)
+    {
+        dispatcher.parser.finish(ec);
+    }
+
+    if (!ec)
+    {
+        // The document must be gone before the arena is reset
+        const auto jv = dispatcher.parser.release();
+        ec = detail::dispatchMessage(consumers, jv);
+    }
+
+    dispatcher.arena.reset();
+
+    return ec;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::scheduleBatch()
+{
+    if (this->dispatcher.batcher->size() >= this->batchOptions.maxNotifications)
+    {
+        this->dispatcher.batcher->flush();
+        if (this->batchTimerArmed)
+        {
+            // A handler that's already queued can't be cancelled anymore, so
+            // it's told apart by its generation
+            this->batchTimer.cancel();
+            this->batchTimerArmed = false;
+            this->batchGeneration++;
+        }
+        return;
+    }
+
+    if (this->dispatcher.batcher->size() > 0 && !this->batchTimerArmed)
+    {
+        this->batchTimerArmed = true;
+        this->batchTimer.expires_after(this->batchOptions.maxDelay);
+        this->batchTimer.async_wait(boost::beast::bind_front_handler(
+            &BasicSession::onBatchTimer, this->shared_from_this(),
+            this->batchGeneration));
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::onBatchTimer(std::size_t generation,
+                                           boost::beast::error_code ec)
+{
+    if (ec || generation != this->batchGeneration)
+    {
+        // The batch filled up before the timer expired. Its notifications
+        // were delivered, and the timer may have been armed for the next one
+        return;
+    }
+
+    this->batchTimerArmed = false;
+    this->dispatcher.batcher->flush();
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::enqueueFrame(
+    const std::shared_ptr<Connection> &connection,
+    const messages::MetadataView *metadata)
+{
+    auto &buffer = connection->buffer;
+    const auto data = buffer.data();
+    auto &shard = this->shardOf(
+        {static_cast<const char *>(data.data()), data.size()}, metadata);
+
+    if (!shard.frames.tryPush(std::move(buffer)))
+    {
+        if (!this->makeRoom(shard, buffer))
+        {
+            this->droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            buffer.clear();
+            return true;
+        }
+
+        if (!shard.frames.tryPush(std::move(buffer)))
+        {
+            // Waiting for room here would block the I/O thread, and with it
+            // our timers and any other session running on it. Stop reading
+            // instead, until the worker has made room
+            shard.readerBlocked.store(true, std::memory_order_relaxed);
+
+            // Pairs with the fence in runWorker, so either the worker sees
+            // readerBlocked after popping, or we see the room it made
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!shard.frames.tryPush(std::move(buffer)))
+            {
+                this->blockedConnections.push_back(connection);
+                return false;
+            }
+        }
+    }
+
+    const auto depth = shard.frames.size();
+    if (depth > this->queueHighWaterMark.load(std::memory_order_relaxed))
+    {
+        this->queueHighWaterMark.store(depth, std::memory_order_relaxed);
+    }
+
+    // Read the next frame into a buffer the worker is done with, so reading
+    // doesn't allocate once we have enough of them
+    if (!shard.spareBuffers.tryPop(buffer))
+    {
+        buffer = boost::beast::flat_buffer{};
+    }
+
+    return true;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::resumeReading()
+{
+    auto blocked = std::exchange(this->blockedConnections, {});
+    for (auto &connection : blocked)
+    {
+        if (this->isAbandoned(connection))
+        {
+            this->recycle(*connection);
+            continue;
+        }
+
+        // Blocks again if another connection took the room first. The frame
+        // goes to the same worker as before, its metadata is just read again
+        if (this->enqueueFrame(connection, nullptr))
+        {
+            this->read(std::move(connection));
+        }
+    }
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::isBlocked(
+    const std::shared_ptr<Connection> &connection) const
+{
+    return std::find(this->blockedConnections.begin(),
+                     this->blockedConnections.end(),
+                     connection) != this->blockedConnections.end();
+}
+
+template <typename ListenerT>
+typename BasicSession<ListenerT>::Shard &BasicSession<ListenerT>::shardOf(
+    std::string_view message, const messages::MetadataView *metadata)
+{
+    if (this->shards.size() == 1)
+    {
+        return *this->shards.front();
+    }
+
+    // Only notifications are about a broadcaster, so the rest of the frame
+    // isn't read again for the others (e.g. session_keepalive)
+    if (metadata != nullptr &&
+        metadata->type != messages::MessageType::Notification)
+    {
+        return *this->shards.front();
+    }
+
+    const auto broadcasterID =
+        readBroadcasterID(message, this->dispatcher.saxParser);
+    if (!broadcasterID)
+    {
+        return *this->shards.front();
+    }
+
+    return *this->shards[*broadcasterID % this->shards.size()];
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::makeRoom(Shard &shard,
+                                       const boost::beast::flat_buffer &buffer)
+{
+    switch (this->pipelineOptions.overflow)
+    {
+        case OverflowPolicy::Block:
+            return true;
+
+        case OverflowPolicy::DropOldest: {
+            // If this finds the queue empty, the worker just made room
+            boost::beast::flat_buffer oldest;
+            if (shard.frames.tryPop(oldest))
+            {
+                this->droppedFrames.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        case OverflowPolicy::DropNotifications: {
+            const auto data = buffer.data();
+            messages::MetadataView metadata;
+            return !detail::readMetadata(
+                       {static_cast<const char *>(data.data()), data.size()},
+                       this->dispatcher.saxParser, metadata) ||
+                   metadata.type != messages::MessageType::Notification;
+        }
+    }
+
+    return true;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::runWorker(Shard &shard)
+{
+    auto &batcher = shard.dispatcher.batcher;
+
+    boost::beast::flat_buffer frame;
+    for (;;)
+    {
+        if (!shard.frames.tryPop(frame))
+        {
+            // Nothing else has arrived for the batch
+            if (batcher)
+            {
+                batcher->flush();
+            }
+
+            if (!shard.frames.waitForItems())
+            {
+                return;
+            }
+            continue;
+        }
+
+        const auto data = frame.data();
+        if (auto ec = this->handleFrame(
+                shard.dispatcher,
+                {static_cast<const char *>(data.data()), data.size()}))
+        {
+            this->messageErrors++;
+            detail::fail(ec, "handleMessage");
+        }
+
+        if (this->router)
+        {
+            this->router->collect();
+        }
+
+        if (batcher && batcher->size() >= this->batchOptions.maxNotifications)
+        {
+            batcher->flush();
+        }
+
+        // Hand the buffer back to the reader. If it has enough spare buffers,
+        // we keep it for the next frame instead
+        frame.clear();
+        shard.spareBuffers.tryPush(std::move(frame));
+
+        // We made room for a frame the reader is holding on to. The session
+        // is only gone if it's being destroyed, which waits for us
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (shard.readerBlocked.load(std::memory_order_relaxed) &&
+            shard.readerBlocked.exchange(false))
+        {
+            // Only lock the session on the strand: if the worker held the
+            // last reference, the session would be destroyed here, and join
+            // this very thread
+            boost::asio::post(this->strand, [weak = this->weak_from_this()] {
+                if (auto self = weak.lock())
+                {
+                    self->resumeReading();
+                }
+            });
+        }
+    }
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::arenaHighWaterMark() const
+{
+    auto highWaterMark = this->dispatcher.arena.highWaterMark();
+    for (const auto &shard : this->shards)
+    {
+        highWaterMark =
+            std::max(highWaterMark, shard->dispatcher.arena.highWaterMark());
+    }
+    return highWaterMark;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setInterests(
+    std::vector<EventSubSubscription> subscriptions)
+{
+    this->interests = std::move(subscriptions);
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setBatching(BatchOptions options)
+{
+    this->batchOptions = options;
+    this->dispatcher.batcher =
+        std::make_unique<detail::Batcher<ListenerT>>(*this->listener);
+    for (auto &shard : this->shards)
+    {
+        shard->dispatcher.batcher =
+            std::make_unique<detail::Batcher<ListenerT>>(*this->listener);
+    }
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setPipeline(PipelineOptions options)
+{
+    this->pipelineOptions = options;
+
+    // The workers are started by run()
+    this->shards.clear();
+    for (std::size_t i = 0; i < std::max<std::size_t>(options.threads, 1); i++)
+    {
+        auto shard = std::make_unique<Shard>(options.queueCapacity);
+        if (this->dispatcher.batcher)
+        {
+            shard->dispatcher.batcher =
+                std::make_unique<detail::Batcher<ListenerT>>(*this->listener);
+        }
+        this->shards.push_back(std::move(shard));
+    }
+}
+
+template <typename ListenerT>
+PipelineStats BasicSession<ListenerT>::getPipelineStats() const
+{
+    PipelineStats stats;
+    for (const auto &shard : this->shards)
+    {
+        stats.queueDepth += shard->frames.size();
+    }
+    stats.queueHighWaterMark =
+        this->queueHighWaterMark.load(std::memory_order_relaxed);
+    stats.droppedFrames = this->droppedFrames.load(std::memory_order_relaxed);
+    return stats;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setReconnect(ReconnectOptions options)
+{
+    this->reconnectOptions = options;
+}
+
+template <typename ListenerT>
+ReconnectStats BasicSession<ListenerT>::getReconnectStats() const
+{
+    ReconnectStats stats;
+    stats.reconnects = this->reconnects.load();
+    stats.failedAttempts = this->failedReconnectAttempts.load();
+    stats.lastDuration =
+        std::chrono::milliseconds{this->lastReconnectDuration.load()};
+    stats.longestDuration =
+        std::chrono::milliseconds{this->longestReconnectDuration.load()};
+    stats.totalDuration =
+        std::chrono::milliseconds{this->totalReconnectDuration.load()};
+    stats.resolves = this->resolves.load();
+    return stats;
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setRouter(
+    std::shared_ptr<BasicBroadcasterRouter<ListenerT>> _router)
+{
+    this->router = std::move(_router);
+}
+
+template <typename ListenerT>
+void BasicSession<ListenerT>::setBroadcasterFilter(
+    const std::vector<std::string> &broadcasterIDs)
+{
+    this->broadcasterFilter.setBroadcasters(broadcasterIDs);
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::getDroppedNotifications() const
+{
+    return this->droppedNotifications.load();
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::getFilteredFrames() const
+{
+    return this->filteredFrames.load();
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::getDeliveredFrames() const
+{
+    return this->deliveredFrames.load();
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::getDuplicateNotifications() const
+{
+    return this->duplicateNotifications.load();
+}
+
+template <typename ListenerT>
+std::size_t BasicSession<ListenerT>::getMessageErrors() const
+{
+    return this->messageErrors.load();
+}
+
+template <typename ListenerT>
+bool BasicSession<ListenerT>::isInterestedIn(
+    const messages::MetadataView &metadata) const
+{
+    if (metadata.type != messages::MessageType::Notification)
+    {
+        return true;
+    }
+
+    if (!this->handlers.empty() &&
+        this->handlers.find(metadata.subscription) == nullptr)
+    {
+        return false;
+    }
+
+    if (this->interests.empty())
+    {
+        return true;
+    }
+
+    if (!metadata.subscriptionType || !metadata.subscriptionVersion)
+    {
+        return true;
+    }
+
+    return std::any_of(
+        this->interests.begin(), this->interests.end(),
+        [&metadata](const auto &interest) {
+            return interest.first == *metadata.subscriptionType &&
+                   interest.second == *metadata.subscriptionVersion;
+        });
+}
+
+/**
+    this->ws_.async_close(
+        boost::beast::websocket::close_code::normal,
+        boost::beast::bind_front_handler(&BasicSession::onClose, this->shared_from_this()));
+        */
+template <typename ListenerT>
+void BasicSession<ListenerT>::onClose(boost::beast::error_code ec)
+{
+    if (ec)
+    {
+        return detail::fail(ec, "close");
+    }
+
+    // If we get here then the connection is closed gracefully
+
+    // The make_printable() function helps print a ConstBufferSequence
+    if (this->connection)
+    {
+        std::cout << boost::beast::make_printable(
+                         this->connection->buffer.data())
+                  << std::endl;
+    }
+}
+
+}  // namespace eventsub
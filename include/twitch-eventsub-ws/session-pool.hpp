@@ -0,0 +1,174 @@
+#pragma once
+
+#include "twitch-eventsub-ws/reconnect.hpp"
+#include "twitch-eventsub-ws/session.hpp"
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/json.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace eventsub {
+
+class Listener;
+
+// A subscription the pool places on one of its sessions
+struct SubscriptionRequest {
+    // e.g. "channel.chat.message"
+    std::string type;
+
+    // e.g. "1"
+    std::string version;
+
+    // e.g. {"broadcaster_user_id": "11148817", "user_id": "117166826"}
+    boost::json::object condition;
+
+    // What the subscription counts against the limits of its session
+    std::size_t cost = 1;
+};
+
+struct SessionPoolOptions {
+    // The number of WebSocket connections
+    std::size_t sessions = 3;
+
+    // The number of threads running the sessions
+    std::size_t threads = 1;
+
+    // Twitch doesn't allow more than this many subscriptions per connection
+    std::size_t maxSubscriptionsPerSession = 300;
+
+    // The most cost placed on one session. 0 doesn't limit it
+    std::size_t maxCostPerSession = 0;
+
+    // How sessions reconnect when their connection fails
+    ReconnectOptions reconnect;
+};
+
+struct SessionLoad {
+    // Empty while the session isn't connected
+    std::string sessionID;
+
+    std::size_t subscriptions = 0;
+    std::size_t cost = 0;
+
+    // Frames delivered by the session so far
+    std::size_t deliveredFrames = 0;
+};
+
+/**
+ * SessionPool spreads subscriptions across several sessions, since Twitch
+ * limits the number of subscriptions per WebSocket connection.
+ *
+ * The pool owns its sessions and the threads they run on. Every session
+ * delivers to the same listener, so the listener sees one stream of messages
+ * no matter which connection they arrived on. With more than one thread,
+ * the listener may be called from several threads at once.
+ *
+ * The pool doesn't talk to the Helix API itself: once a subscription has been
+ * placed on a connected session, the subscriber passed to setSubscriber is
+ * called with that session's ID, and is expected to create the subscription.
+ *
+ * Subscriptions go to the connected session with the lowest cost that still
+ * has room. When a session loses its connection, Twitch drops its
+ * subscriptions, so the pool places them on the other sessions again (and
+ * calls the subscriber for them). Subscriptions that don't fit anywhere wait
+ * until a session (re)connects.
+ **/
+class SessionPool
+{
+public:
+    using Subscriber = std::function<void(std::string_view sessionID,
+                                          const SubscriptionRequest &request)>;
+
+    SessionPool(boost::asio::ssl::context &ctx,
+                std::unique_ptr<Listener> listener,
+                SessionPoolOptions options = {});
+    ~SessionPool();
+
+    SessionPool(const SessionPool &) = delete;
+    SessionPool &operator=(const SessionPool &) = delete;
+
+    // Called from the pool's threads. Must be called before run()
+    void setSubscriber(Subscriber _subscriber);
+
+    // Connect all sessions & start the threads
+    void run(std::string host, std::string port, std::string path,
+             std::string userAgent);
+
+    /**
+     * Place a subscription on the least loaded session.
+     *
+     * Returns false if no connected session has room for it right now; it's
+     * then placed once a session connects. Can be called from any thread
+     **/
+    bool subscribe(SubscriptionRequest request);
+
+    // The number of sessions that are currently connected
+    std::size_t getConnectionCount() const;
+
+    // The load of each session, in the order they were created
+    std::vector<SessionLoad> getSessionLoads() const;
+
+    // The number of subscriptions waiting for a session with room
+    std::size_t getPendingSubscriptions() const;
+
+private:
+    class SlotListener;
+
+    struct Slot {
+        std::shared_ptr<Session> session;
+
+        // Empty while the session isn't connected
+        std::string sessionID;
+
+        std::vector<SubscriptionRequest> subscriptions;
+        std::size_t cost = 0;
+    };
+
+    // A subscription to create on a session, collected while holding the
+    // lock and handed to the subscriber after releasing it
+    struct Placement {
+        std::string sessionID;
+        SubscriptionRequest request;
+    };
+
+    void onSessionWelcome(std::size_t index, std::string_view sessionID);
+    void onDisconnected(std::size_t index);
+
+    // The connected slot with the lowest cost that has room for request.
+    // Must hold the lock
+    std::optional<std::size_t> findSlot(const SubscriptionRequest &request,
+                                        std::size_t excluded) const;
+
+    // Place request on a slot, or add it to the pending ones. Must hold the
+    // lock
+    void place(SubscriptionRequest &&request, std::size_t excluded,
+               std::vector<Placement> &placements);
+
+    void callSubscriber(std::vector<Placement> &placements);
+
+    const SessionPoolOptions options;
+    std::unique_ptr<Listener> listener;
+    Subscriber subscriber;
+
+    boost::asio::io_context ioc;
+    std::optional<boost::asio::executor_work_guard<
+        boost::asio::io_context::executor_type>>
+        work;
+    std::vector<std::thread> threads;
+
+    mutable std::mutex mutex;
+    std::vector<Slot> slots;
+    std::vector<SubscriptionRequest> pending;
+};
+
+}  // namespace eventsub
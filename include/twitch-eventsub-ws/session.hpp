@@ -1,5 +1,16 @@
 #pragma once
 
+#include "twitch-eventsub-ws/batching.hpp"
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+#include "twitch-eventsub-ws/broadcaster-router.hpp"
+#include "twitch-eventsub-ws/frame-arena.hpp"
+#include "twitch-eventsub-ws/handler-registry.hpp"
+#include "twitch-eventsub-ws/message-deduplicator.hpp"
+#include "twitch-eventsub-ws/pipeline.hpp"
+#include "twitch-eventsub-ws/reconnect.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+#include "twitch-eventsub-ws/spsc-queue.hpp"
+
 #include <boost/asio.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -7,10 +18,42 @@
 #include <boost/beast/websocket/ssl.hpp>
 #include <boost/json.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace eventsub {
 
 class Listener;
 
+namespace messages {
+class MetadataView;
+}  // namespace messages
+
+// Subscription Type + Subscription Version
+using EventSubSubscription = std::pair<std::string, std::string>;
+
+namespace detail {
+
+struct WebSocketURL {
+    std::string host;
+    std::string port;
+    std::string path;
+};
+
+// Splits a wss:// URL (e.g. the reconnect_url of session_reconnect) into what
+// we connect to. Returns std::nullopt if it's not a wss:// URL
+std::optional<WebSocketURL> parseWebSocketURL(std::string_view url);
+
+}  // namespace detail
+
 /**
  * handleMessage takes the incoming message in the buffer, parses it
  * as JSON then forwards it to the listener, if applicable.
@@ -21,45 +64,516 @@ class Listener;
 boost::json::error_code handleMessage(std::unique_ptr<Listener> &listener,
                                       const boost::beast::flat_buffer &buffer);
 
-// Sends a WebSocket message and prints the response
-class Session : public std::enable_shared_from_this<Session>
+/**
+ * handleMessage parses the given message as JSON then forwards it to the
+ * listener, if applicable.
+ *
+ * The message is parsed in place, so callers with their own buffers can hand
+ * us a view into them without copying the message into a string first.
+ *
+ * To dispatch to your own listener type without virtual calls, use the
+ * handleMessage template in dispatch.hpp
+ **/
+boost::json::error_code handleMessage(Listener &listener,
+                                      std::string_view message);
+
+// The listener of sessions constructed without one
+template <typename ListenerT>
+std::unique_ptr<ListenerT> makeDefaultListener()
 {
-    boost::asio::ip::tcp::resolver resolver;
-    boost::beast::websocket::stream<
-        boost::beast::ssl_stream<boost::beast::tcp_stream>>
-        ws;
-    boost::beast::flat_buffer buffer;
-    std::string host;
-    std::string port;
-    std::string path;
+    return std::make_unique<ListenerT>();
+}
+
+template <>
+std::unique_ptr<Listener> makeDefaultListener<Listener>();
+
+/**
+ * Sends a WebSocket message and prints the response.
+ *
+ * ListenerT is the type of the listener messages are dispatched to. It must
+ * have the same member functions as Listener, but they are called directly
+ * instead of through virtual calls, so with a final or non-virtual listener
+ * type the callbacks can be inlined into the dispatch code.
+ *
+ * When Twitch sends a session_reconnect, the session connects to its
+ * reconnect_url while it keeps reading from the current connection, and only
+ * switches over once the new connection has been welcomed. Notifications
+ * received on both connections in the meantime are only delivered once, by
+ * their message ID.
+ *
+ * If the current connection goes silent for more than a second longer than
+ * the keepalive_timeout_seconds of its session_welcome, the session assumes
+ * it's dead and reconnects, which starts a new Twitch session (and delivers a
+ * new session_welcome to the listener). With setReconnect, the session also
+ * reconnects when its connection fails in any other way.
+ *
+ * Session (BasicSession<Listener>) is compiled into the library. For other
+ * listener types, include session-impl.hpp
+ **/
+template <typename ListenerT>
+class BasicSession
+    : public std::enable_shared_from_this<BasicSession<ListenerT>>
+{
+    using Strand = boost::asio::strand<boost::asio::io_context::executor_type>;
+
+    // All connections & timers of the session run on this strand
+    Strand strand;
+    boost::asio::ssl::context &ctx;
+
+    // One WebSocket connection to Twitch. While the session moves to the
+    // reconnect_url of a session_reconnect message, it has two of them
+    struct Connection {
+        Connection(const Strand &strand, boost::asio::ssl::context &ctx)
+            : resolver(strand)
+            , ws(strand, ctx)
+        {
+        }
+
+        boost::asio::ip::tcp::resolver resolver;
+        boost::beast::websocket::stream<
+            boost::beast::ssl_stream<boost::beast::tcp_stream>>
+            ws;
+        boost::beast::flat_buffer buffer;
+        std::string host;
+        std::string port;
+        std::string path;
+    };
+
+    // Where run() connected to, for when we have to start over
+    detail::WebSocketURL endpoint;
+
+    // The connection messages are delivered from
+    std::shared_ptr<Connection> connection;
+
+    // The connection to the reconnect_url, until it has been welcomed
+    std::shared_ptr<Connection> nextConnection;
+
+    // The connection we moved away from, until Twitch closes it
+    std::shared_ptr<Connection> previousConnection;
+
+    // Notifications received on both connections while moving to the next
+    // one are only delivered once
+    MessageDeduplicator deduplicator;
+    std::atomic<std::size_t> duplicateNotifications{0};
+
     std::string userAgent;
-    std::unique_ptr<Listener> listener;
+    std::unique_ptr<ListenerT> listener;
+
+    // Set from the keepalive_timeout_seconds of session_welcome. Frames only
+    // record when they arrived, and the timer checks that when it expires,
+    // so it's armed once per timeout instead of once per frame
+    std::chrono::seconds keepaliveTimeout{0};
+    std::chrono::steady_clock::time_point lastFrame;
+    boost::asio::steady_timer keepaliveTimer;
+    bool keepaliveTimerArmed = false;
+
+    // Twitch sends its keepalives right at the timeout, so a little network
+    // jitter mustn't be taken for a dead connection
+    static constexpr std::chrono::seconds KEEPALIVE_SLACK{1};
+
+    // Set by setReconnect. Without it, only the keepalive watchdog
+    // reconnects, once and right away
+    std::optional<ReconnectOptions> reconnectOptions;
+    boost::asio::steady_timer reconnectTimer;
+    bool reconnectTimerArmed = false;
+    std::minstd_rand random{std::random_device{}()};
+
+    // When we lost the connection we're reconnecting for, and how many
+    // attempts we've made since
+    std::optional<std::chrono::steady_clock::time_point> reconnectStartedAt;
+    std::size_t reconnectAttempts = 0;
+
+    std::atomic<std::size_t> reconnects{0};
+    std::atomic<std::size_t> failedReconnectAttempts{0};
+    std::atomic<std::chrono::milliseconds::rep> lastReconnectDuration{0};
+    std::atomic<std::chrono::milliseconds::rep> longestReconnectDuration{0};
+    std::atomic<std::chrono::milliseconds::rep> totalReconnectDuration{0};
+    std::atomic<std::size_t> resolves{0};
+
+    // Kept from earlier connections, so reconnecting doesn't start from
+    // scratch: the addresses of the endpoint of run(), and the biggest read
+    // buffer a closed connection left behind
+    std::optional<boost::asio::ip::tcp::resolver::results_type>
+        resolvedEndpoint;
+    boost::beast::flat_buffer spareBuffer;
+
+    // Everything one thread needs to parse & dispatch frames
+    struct Dispatcher {
+        // Reused for every frame we read, so parsing a frame doesn't allocate
+        // once the arena has grown to fit the frames we receive
+        FrameArena arena;
+        boost::json::stream_parser parser;
+
+        // Used instead of the stream parser when the listener doesn't want
+        // the JSON of notifications
+        sax::Parser saxParser;
+
+        // Set by setBatching
+        std::unique_ptr<detail::Batcher<ListenerT>> batcher;
+    };
+
+    // Dispatches frames on the I/O strand, unless we're in pipeline mode
+    Dispatcher dispatcher;
+
+    // Notifications for subscriptions not in here are dropped, unless it's empty
+    std::vector<EventSubSubscription> interests;
+    std::atomic<std::size_t> droppedNotifications{0};
+
+    BroadcasterFilter broadcasterFilter;
+    std::atomic<std::size_t> filteredFrames{0};
+    std::atomic<std::size_t> deliveredFrames{0};
+
+    // Frames that couldn't be parsed or dispatched
+    std::atomic<std::size_t> messageErrors{0};
+
+    std::shared_ptr<BasicBroadcasterRouter<ListenerT>> router;
+
+    // Set by setBatching
+    BatchOptions batchOptions;
+    boost::asio::steady_timer batchTimer;
+    bool batchTimerArmed = false;
+
+    // Bumped whenever the timer is cancelled, so a handler that was queued
+    // before can tell that it's stale
+    std::size_t batchGeneration = 0;
+
+    // A worker thread in pipeline mode. Frames are read into buffers from
+    // spareBuffers and handed to the worker through frames, which hands the
+    // buffers back
+    struct Shard {
+        explicit Shard(std::size_t queueCapacity)
+            : frames(queueCapacity)
+            , spareBuffers(queueCapacity)
+        {
+        }
+
+        SpscQueue<boost::beast::flat_buffer> frames;
+        SpscQueue<boost::beast::flat_buffer> spareBuffers;
+        Dispatcher dispatcher;
+        std::thread thread;
+
+        // Set when a frame is waiting for room in frames, for the worker to
+        // resume reading once it has made room
+        std::atomic<bool> readerBlocked{false};
+    };
+
+    // Set by setPipeline
+    PipelineOptions pipelineOptions;
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    // Connections we stopped reading from because their frame didn't fit
+    // into its worker's queue. The frame waits in the connection's buffer
+    std::vector<std::shared_ptr<Connection>> blockedConnections;
+    std::atomic<std::size_t> queueHighWaterMark{0};
+    std::atomic<std::size_t> droppedFrames{0};
+
+    HandlerRegistry handlers;
 
 public:
     // Resolver and socket require an io_context
-    explicit Session(boost::asio::io_context &ioc,
-                     boost::asio::ssl::context &ctx,
-                     std::unique_ptr<Listener> listener);
+    explicit BasicSession(boost::asio::io_context &ioc,
+                          boost::asio::ssl::context &ctx,
+                          std::unique_ptr<ListenerT> listener);
+
+    // For sessions that only deliver notifications to handlers registered
+    // with on()
+    BasicSession(boost::asio::io_context &ioc, boost::asio::ssl::context &ctx);
+
+    ~BasicSession();
 
     // Start the asynchronous operation
     void run(std::string _host, std::string _port, std::string _path,
              std::string _userAgent);
 
+    // The most bytes the JSON document of a single frame has needed so far.
+    // Can be used to pick a better initial size for the frame arena
+    std::size_t arenaHighWaterMark() const;
+
+    /**
+     * Only forward notifications of the given subscriptions to the listener,
+     * e.g. {{"stream.online", "1"}, {"channel.ban", "1"}}
+     *
+     * Other notifications are dropped as soon as their metadata has been read,
+     * so their payload is never parsed and the listener never sees them.
+     * By default, all notifications are forwarded.
+     *
+     * Must be called before run()
+     **/
+    void setInterests(std::vector<EventSubSubscription> subscriptions);
+
+    /**
+     * Only forward notifications about the given broadcasters (by user ID)
+     *
+     * The broadcaster ID is read from the subscription condition (or the
+     * event) before the payload is deserialized, and every other key of the
+     * message is skipped, so notifications about other broadcasters are cheap
+     * to drop. Messages that aren't about a broadcaster are always forwarded.
+     * By default, all notifications are forwarded.
+     *
+     * Must be called before run()
+     **/
+    void setBroadcasterFilter(const std::vector<std::string> &broadcasterIDs);
+
+    /**
+     * Parse & dispatch frames on a worker thread instead of the I/O strand,
+     * so a slow listener doesn't hold up reading from the socket (and
+     * answering keepalives).
+     *
+     * The I/O strand only reads frames into pooled buffers and pushes them
+     * onto a bounded lock-free queue. Everything else, including all
+     * listener & handler callbacks, happens on the worker thread. What
+     * happens when the queue is full is up to options.overflow.
+     *
+     * With more than one worker (options.threads), each worker has its own
+     * queue, and frames are spread across them by the broadcaster they're
+     * about. A broadcaster's notifications always go to the same worker, so
+     * they're delivered in the order they were received; notifications of
+     * different broadcasters may be delivered concurrently, so the listener
+     * must be thread-safe. Messages that aren't about a broadcaster go to the
+     * first worker.
+     *
+     * With batching, each worker delivers its batch when it's full or its
+     * queue runs dry; maxDelay isn't used.
+     *
+     * Must be called before run()
+     **/
+    void setPipeline(PipelineOptions options);
+
+    // Only meaningful after setPipeline. Can be called from any thread
+    PipelineStats getPipelineStats() const;
+
+    /**
+     * Reconnect whenever the connection fails (resolving, connecting, the
+     * handshakes, reading, or the keepalive watchdog), instead of ending the
+     * session.
+     *
+     * Each attempt waits for a random delay that grows with the number of
+     * failed attempts (see reconnectDelay), so that many sessions losing
+     * their connections at once don't all reconnect at the same moment.
+     * Reconnecting reuses the resolved addresses of the endpoint, the SSL
+     * context, the read buffer and the parsing arenas of the session.
+     *
+     * Reconnecting starts a new Twitch session, so the listener receives a
+     * new session_welcome and has to subscribe again.
+     *
+     * Must be called before run()
+     **/
+    void setReconnect(ReconnectOptions options);
+
+    // Can be called from any thread
+    ReconnectStats getReconnectStats() const;
+
+    /**
+     * Deliver notifications to the listener in batches, through its batch
+     * callbacks (e.g. onChannelChatMessages) instead of one call per
+     * notification.
+     *
+     * The session keeps reading frames while a batch is being collected, so
+     * frames that have already arrived are parsed back to back. The batch is
+     * delivered once it holds options.maxNotifications notifications, or
+     * options.maxDelay after its first notification arrived, whichever
+     * happens first. Other messages (e.g. session_welcome) deliver the batch
+     * before they are delivered themselves.
+     *
+     * Notifications delivered to registered handlers or routed to another
+     * listener aren't batched. Neither is the JSON of notifications, if the
+     * listener wants it: onNotification is still called for each of them as
+     * it arrives.
+     *
+     * Must be called before run()
+     **/
+    void setBatching(BatchOptions options);
+
+    /**
+     * Hand notifications about the broadcasters in the router to their own
+     * listener. Notifications about other broadcasters, and all other
+     * messages, still go to the session's listener.
+     *
+     * Listeners can be added to & removed from the router while the session
+     * is running, from any thread.
+     *
+     * Must be called before run()
+     **/
+    void setRouter(std::shared_ptr<BasicBroadcasterRouter<ListenerT>> _router);
+
+    /**
+     * Deliver notifications carrying Payload to fn, e.g.
+     *
+     *   session->on<payload::channel_ban::v1::Payload>(
+     *       [](const messages::Metadata &metadata, auto &&payload) { ... });
+     *
+     * Replaces the handler registered for Payload before. Returns false if
+     * handlers sharing the payload have been registered for it with share().
+     *
+     * Once any handler is registered, notifications only go to the handlers:
+     * the listener's onNotification & subscription callbacks aren't called,
+     * and notifications without a handler are dropped without parsing their
+     * payload. The listener still receives the other messages, like
+     * session_welcome.
+     *
+     * Must be called before run()
+     **/
+    template <typename Payload, typename Fn>
+    bool on(Fn &&fn)
+    {
+        return this->handlers.on<Payload>(std::forward<Fn>(fn));
+    }
+
+    /**
+     * Like on(), but for handlers taking a SharedPayload<Payload>: any number
+     * of them can be registered per payload, and each gets a handle to the
+     * same immutable payload (see HandlerRegistry).
+     *
+     * Returns false if a handler has been registered for the payload with
+     * on().
+     *
+     * Must be called before run()
+     **/
+    template <typename Payload, typename Fn>
+    bool share(Fn &&fn)
+    {
+        return this->handlers.share<Payload>(std::forward<Fn>(fn));
+    }
+
+    // The number of notifications that were dropped by setInterests or
+    // because no handler was registered for them
+    std::size_t getDroppedNotifications() const;
+
+    // The number of notifications dropped by setBroadcasterFilter
+    std::size_t getFilteredFrames() const;
+
+    // The number of frames that made it past all filters to be dispatched
+    std::size_t getDeliveredFrames() const;
+
+    // The number of notifications received on both connections while moving
+    // to a new one, and only delivered once
+    std::size_t getDuplicateNotifications() const;
+
+    // The number of frames that couldn't be parsed or dispatched. They're
+    // logged & skipped, the connection keeps being read
+    std::size_t getMessageErrors() const;
+
 private:
-    void onResolve(boost::beast::error_code ec,
+    // Resolve, connect & handshake, then start reading from the connection
+    void connect(std::shared_ptr<Connection> connection);
+
+    void onResolve(std::shared_ptr<Connection> connection,
+                   boost::beast::error_code ec,
                    boost::asio::ip::tcp::resolver::results_type results);
 
     void onConnect(
-        boost::beast::error_code ec,
+        std::shared_ptr<Connection> connection, boost::beast::error_code ec,
         boost::asio::ip::tcp::resolver::results_type::endpoint_type ep);
 
-    void onSSLHandshake(boost::beast::error_code ec);
+    void onSSLHandshake(std::shared_ptr<Connection> connection,
+                        boost::beast::error_code ec);
+
+    void onHandshake(std::shared_ptr<Connection> connection,
+                     boost::beast::error_code ec);
+
+    void read(std::shared_ptr<Connection> connection);
 
-    void onHandshake(boost::beast::error_code ec);
+    void onRead(std::shared_ptr<Connection> connection,
+                boost::beast::error_code ec, std::size_t bytes_transferred);
 
-    void onRead(boost::beast::error_code ec, std::size_t bytes_transferred);
+    // Handle the messages that are about the connection itself (e.g.
+    // session_reconnect) and drop duplicate notifications. Returns false if
+    // the frame must not be delivered
+    bool admitFrame(const std::shared_ptr<Connection> &connection,
+                    std::string_view message,
+                    const messages::MetadataView &metadata);
+
+    // Start connecting to the reconnect_url of a session_reconnect message
+    void startReconnect(std::string_view message);
+
+    // The connection failed. Reconnect if we're supposed to, otherwise the
+    // session ends here
+    void connectionFailed(const std::shared_ptr<Connection> &connection,
+                          boost::beast::error_code ec, const char *what);
+
+    // Tell the listener the current connection is gone
+    void reportDisconnect(boost::beast::error_code ec);
+
+    // Close all our connections, and connect to the endpoint of run() again
+    // after the backoff delay
+    void scheduleReconnect();
+
+    void onReconnectTimer(boost::beast::error_code ec);
+
+    // Connect to the endpoint of run() again, which starts a new session
+    void reconnect();
+
+    // The current connection has been welcomed after reconnecting
+    void reconnected();
+
+    // Keep the read buffer of a connection we're done with for the next one
+    void recycle(Connection &connection);
+
+    // Stop all operations of a connection we're done with
+    void abandon(const std::shared_ptr<Connection> &connection);
+
+    // True if the connection is none of our current, next or previous one
+    bool isAbandoned(const std::shared_ptr<Connection> &connection) const;
+
+    // Start watching the current connection with the keepalive timeout of
+    // its session_welcome
+    void watchKeepalive(std::string_view message);
+
+    // Wake up once the current connection has been silent for the keepalive
+    // timeout, unless a frame arrives before then
+    void armKeepaliveTimer();
+
+    // When the current connection counts as dead if nothing else arrives
+    std::chrono::steady_clock::time_point keepaliveDeadline() const;
+
+    void onKeepaliveTimer(boost::beast::error_code ec);
+
+    // Parse a frame into the dispatcher's arena and dispatch it.
+    // knownMetadata is the frame's metadata, if the caller has already read it
+    boost::json::error_code handleFrame(
+        Dispatcher &dispatcher, std::string_view message,
+        const messages::MetadataView *knownMetadata = nullptr);
+
+    // Dispatch a frame that made it past our filters to target. metadata is
+    // nullptr if it couldn't be read without parsing the whole frame
+    template <typename Target>
+    boost::json::error_code dispatchFrame(
+        Dispatcher &dispatcher, Target &target, std::string_view message,
+        const messages::MetadataView *metadata);
+
+    // Deliver the batch if it's full, or make sure it's delivered in time
+    void scheduleBatch();
+
+    void onBatchTimer(std::size_t generation, boost::beast::error_code ec);
+
+    // Hand the frame in the connection's buffer over to its worker. Returns
+    // false if the frame has to wait for the worker to make room, in which
+    // case reading from the connection is resumed by resumeReading.
+    // metadata is the frame's, if it has been read already
+    bool enqueueFrame(const std::shared_ptr<Connection> &connection,
+                      const messages::MetadataView *metadata);
+
+    // A worker made room for the frames of the blocked connections
+    void resumeReading();
+
+    bool isBlocked(const std::shared_ptr<Connection> &connection) const;
+
+    // The worker of the broadcaster the frame is about
+    Shard &shardOf(std::string_view message,
+                   const messages::MetadataView *metadata);
+
+    // Returns false if the frame in the buffer should be dropped instead
+    bool makeRoom(Shard &shard, const boost::beast::flat_buffer &buffer);
+
+    void runWorker(Shard &shard);
+
+    bool isInterestedIn(const messages::MetadataView &metadata) const;
 
     void onClose(boost::beast::error_code ec);
 };
 
+extern template class BasicSession<Listener>;
+
+using Session = BasicSession<Listener>;
+
 }  // namespace eventsub
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace eventsub {
+
+/**
+ * SharedPayload is a reference-counted handle to an immutable payload, so
+ * several consumers can hold on to the same payload without copying it.
+ *
+ * The reference count is stored next to the payload in a single allocation,
+ * and the handle is just a pointer to it, so copying a handle is one atomic
+ * increment. The payload's strings are moved into it, not copied.
+ **/
+template <typename T>
+class SharedPayload
+{
+public:
+    SharedPayload() = default;
+
+    // Takes over payload
+    static SharedPayload make(T &&payload)
+    {
+        return SharedPayload{new Block{std::move(payload)}};
+    }
+
+    SharedPayload(const SharedPayload &other) noexcept
+        : block(other.block)
+    {
+        if (this->block != nullptr)
+        {
+            this->block->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    SharedPayload(SharedPayload &&other) noexcept
+        : block(std::exchange(other.block, nullptr))
+    {
+    }
+
+    SharedPayload &operator=(SharedPayload other) noexcept
+    {
+        std::swap(this->block, other.block);
+        return *this;
+    }
+
+    ~SharedPayload()
+    {
+        if (this->block != nullptr && this->block->references.fetch_sub(
+                                          1, std::memory_order_acq_rel) == 1)
+        {
+            delete this->block;
+        }
+    }
+
+    const T &operator*() const noexcept
+    {
+        return this->block->payload;
+    }
+
+    const T *operator->() const noexcept
+    {
+        return &this->block->payload;
+    }
+
+    const T *get() const noexcept
+    {
+        return this->block != nullptr ? &this->block->payload : nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return this->block != nullptr;
+    }
+
+    // The number of handles to the payload
+    std::size_t useCount() const noexcept
+    {
+        return this->block != nullptr
+                   ? this->block->references.load(std::memory_order_relaxed)
+                   : 0;
+    }
+
+private:
+    struct Block {
+        explicit Block(T &&_payload)
+            : payload(std::move(_payload))
+        {
+        }
+
+        const T payload;
+        std::atomic<std::size_t> references{1};
+    };
+
+    explicit SharedPayload(Block *_block) noexcept
+        : block(_block)
+    {
+    }
+
+    Block *block = nullptr;
+};
+
+}  // namespace eventsub
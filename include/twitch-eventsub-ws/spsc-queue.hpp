@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace eventsub {
+
+/**
+ * SpscQueue is a bounded lock-free ring buffer between one producer thread
+ * and one consumer thread.
+ *
+ * Every slot carries a sequence number (as in Dmitry Vyukov's bounded queue),
+ * so a slot is only reused once whoever popped it is done moving its value
+ * out. That makes it safe for the producer to pop as well, which it does to
+ * drop the oldest entry when the queue is full.
+ *
+ * tryPush & tryPop never block. push & waitForItems block until they can make
+ * progress, sleeping on the counters of the other side instead of spinning.
+ **/
+template <typename T>
+class SpscQueue
+{
+public:
+    // The capacity is rounded up to a power of two
+    explicit SpscQueue(std::size_t minCapacity)
+        : capacity(capacityFor(minCapacity))
+        , cells(std::make_unique<Cell[]>(this->capacity))
+    {
+        for (std::size_t i = 0; i < this->capacity; i++)
+        {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    // Producer only. value is left untouched if the queue is full
+    bool tryPush(T &&value)
+    {
+        const auto pos = this->pushPos.load(std::memory_order_relaxed);
+        auto &cell = this->cells[pos & (this->capacity - 1)];
+        if (cell.sequence.load(std::memory_order_acquire) != pos)
+        {
+            return false;
+        }
+
+        cell.value = std::move(value);
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        this->pushPos.store(pos + 1, std::memory_order_relaxed);
+
+        this->pushes.fetch_add(1, std::memory_order_release);
+        this->pushes.notify_one();
+        return true;
+    }
+
+    // Producer only. Blocks until there's room
+    void push(T &&value)
+    {
+        for (;;)
+        {
+            const auto seen = this->pops.load(std::memory_order_acquire);
+            if (this->tryPush(std::move(value)))
+            {
+                return;
+            }
+            this->pops.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    // Returns false if the queue is empty
+    bool tryPop(T &out)
+    {
+        auto pos = this->popPos.load(std::memory_order_relaxed);
+        Cell *cell = nullptr;
+        for (;;)
+        {
+            cell = &this->cells[pos & (this->capacity - 1)];
+            const auto sequence =
+                cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) -
+                              static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (this->popPos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = this->popPos.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = std::move(cell->value);
+        cell->sequence.store(pos + this->capacity, std::memory_order_release);
+
+        this->pops.fetch_add(1, std::memory_order_release);
+        this->pops.notify_one();
+        return true;
+    }
+
+    // Consumer only. Blocks until there's something to pop. Returns false if
+    // interrupt() has been called
+    bool waitForItems()
+    {
+        for (;;)
+        {
+            const auto seen = this->pushes.load(std::memory_order_acquire);
+            if (this->interrupted.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            if (this->size() > 0)
+            {
+                return true;
+            }
+            this->pushes.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    // Wakes up the consumer for good, e.g. to shut it down
+    void interrupt()
+    {
+        this->interrupted.store(true, std::memory_order_release);
+        this->pushes.fetch_add(1, std::memory_order_release);
+        this->pushes.notify_all();
+    }
+
+    // The number of entries in the queue. Only a snapshot if the other thread
+    // is pushing or popping at the same time
+    std::size_t size() const
+    {
+        const auto popped = this->popPos.load(std::memory_order_relaxed);
+        const auto pushed = this->pushPos.load(std::memory_order_relaxed);
+        return pushed > popped ? pushed - popped : 0;
+    }
+
+    std::size_t getCapacity() const
+    {
+        return this->capacity;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    static std::size_t capacityFor(std::size_t minCapacity)
+    {
+        std::size_t capacity = 2;
+        while (capacity < minCapacity)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    const std::size_t capacity;
+    const std::unique_ptr<Cell[]> cells;
+
+    // On separate cache lines, since they're written by different threads
+    alignas(64) std::atomic<std::size_t> pushPos{0};
+    alignas(64) std::atomic<std::size_t> popPos{0};
+
+    // Bumped on every push & pop, for the other side to wait on
+    alignas(64) std::atomic<std::uint32_t> pushes{0};
+    alignas(64) std::atomic<std::uint32_t> pops{0};
+
+    std::atomic<bool> interrupted{false};
+};
+
+}  // namespace eventsub
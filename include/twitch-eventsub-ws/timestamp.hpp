@@ -0,0 +1,63 @@
+#pragma once
+
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace eventsub {
+
+/**
+ * Timestamp is an ISO 8601 timestamp the way we received it.
+ *
+ * It's only parsed the first time timePoint() is called, so code that never
+ * looks at a timestamp doesn't pay for parsing it, and code that does only
+ * pays once.
+ **/
+class Timestamp
+{
+public:
+    Timestamp() = default;
+    explicit Timestamp(std::string _raw);
+
+    Timestamp(const Timestamp &other);
+    Timestamp(Timestamp &&other) noexcept;
+    Timestamp &operator=(const Timestamp &other);
+    Timestamp &operator=(Timestamp &&other) noexcept;
+
+    // The timestamp as we received it, e.g. 2023-05-14T12:31:47.995298776Z
+    const std::string &raw() const noexcept;
+
+    // Safe to call from multiple threads at once. A timestamp that can't be
+    // parsed is the epoch
+    std::chrono::system_clock::time_point timePoint() const;
+
+    // Whether timePoint() has parsed the timestamp yet
+    bool isParsed() const noexcept;
+
+    void assign(std::string_view newRaw);
+
+private:
+    using Rep = std::chrono::system_clock::rep;
+
+    static constexpr Rep NOT_PARSED = std::numeric_limits<Rep>::min();
+
+    std::string rawTimestamp;
+
+    // Parsing is deterministic, so if two threads race to fill this in they
+    // store the same value
+    mutable std::atomic<Rep> parsed{NOT_PARSED};
+};
+
+boost::json::result_for<Timestamp, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<Timestamp> /*tag*/,
+    const boost::json::value &jvRoot);
+
+const sax::Sink &saxSink(sax::SinkTag<Timestamp> /*tag*/);
+
+}  // namespace eventsub
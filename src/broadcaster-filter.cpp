@@ -0,0 +1,148 @@
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+
+#include "twitch-eventsub-ws/errors.hpp"
+
+#include <boost/json.hpp>
+
+#include <charconv>
+#include <initializer_list>
+#include <vector>
+
+namespace eventsub {
+
+namespace {
+
+// Returned by the BroadcasterIDSink once it has read the broadcaster ID
+boost::json::error_code broadcasterIDRead()
+{
+    static const error::ApplicationErrorCategory errorBroadcasterIDRead{
+        "Stopped after reading the broadcaster ID"};
+    return boost::system::error_code{129, errorBroadcasterIDRead};
+}
+
+// Follows a few keys of an object into their sinks, skipping all other keys
+class PathSink final : public sax::Sink
+{
+public:
+    struct Edge {
+        std::string_view key;
+        const sax::Sink *sink;
+    };
+
+    PathSink(std::initializer_list<Edge> _edges)
+        : edges(_edges)
+    {
+    }
+
+    Kind kind() const override
+    {
+        return Kind::Object;
+    }
+
+    boost::json::error_code onKey(void *target, std::string_view key,
+                                  std::uint64_t & /*seen*/,
+                                  sax::Slot &next) const override
+    {
+        for (const auto &edge : this->edges)
+        {
+            if (edge.key == key)
+            {
+                next = {target, edge.sink};
+                return {};
+            }
+        }
+
+        next = {};
+        return {};
+    }
+
+private:
+    const std::vector<Edge> edges;
+};
+
+class BroadcasterIDSink final : public sax::Sink
+{
+public:
+    boost::json::error_code onString(void *target,
+                                     std::string_view value) const override
+    {
+        *static_cast<std::optional<std::uint64_t> *>(target) =
+            parseUserID(value);
+        return broadcasterIDRead();
+    }
+
+    // Some subscriptions have an optional broadcaster ID
+    boost::json::error_code onNull(void * /*target*/) const override
+    {
+        return broadcasterIDRead();
+    }
+};
+
+}  // namespace
+
+std::optional<std::uint64_t> parseUserID(std::string_view id)
+{
+    std::uint64_t value = 0;
+    const auto *end = id.data() + id.size();
+    const auto [ptr, ec] = std::from_chars(id.data(), end, value);
+    if (ec != std::errc{} || ptr != end || id.empty())
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+std::optional<std::uint64_t> readBroadcasterID(std::string_view message,
+                                               sax::Parser &parser)
+{
+    static const BroadcasterIDSink idSink;
+    static const PathSink conditionSink{{"broadcaster_user_id", &idSink}};
+    static const PathSink subscriptionSink{{"condition", &conditionSink}};
+    static const PathSink eventSink{{"broadcaster_user_id", &idSink}};
+    static const PathSink payloadSink{
+        {"subscription", &subscriptionSink},
+        {"event", &eventSink},
+    };
+    static const PathSink messageSink{{"payload", &payloadSink}};
+
+    std::optional<std::uint64_t> broadcasterID;
+    if (parser.parse(message, sax::Slot{&broadcasterID, &messageSink}) !=
+        broadcasterIDRead())
+    {
+        return std::nullopt;
+    }
+
+    return broadcasterID;
+}
+
+void BroadcasterFilter::setBroadcasters(
+    const std::vector<std::string> &broadcasterIDs)
+{
+    this->broadcasters.clear();
+    this->enabled = !broadcasterIDs.empty();
+    for (const auto &id : broadcasterIDs)
+    {
+        if (auto parsed = parseUserID(id))
+        {
+            this->broadcasters.insert(*parsed);
+        }
+    }
+}
+
+bool BroadcasterFilter::empty() const
+{
+    return !this->enabled;
+}
+
+bool BroadcasterFilter::wants(std::optional<std::uint64_t> broadcasterID) const
+{
+    if (!this->enabled || !broadcasterID)
+    {
+        return true;
+    }
+
+    return this->broadcasters.contains(*broadcasterID);
+}
+
+}  // namespace eventsub
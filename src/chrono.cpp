@@ -1,23 +1,131 @@
 #include "twitch-eventsub-ws/chrono.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 namespace eventsub {
 
+namespace {
+
+// Parse the count digits starting at pos into out
+bool parseDigits(std::string_view raw, std::size_t pos, std::size_t count,
+                 int &out)
+{
+    int value = 0;
+    for (auto i = pos; i < pos + count; i++)
+    {
+        const auto c = raw[i];
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+
+    out = value;
+    return true;
+}
+
+}  // namespace
+
+std::optional<std::chrono::system_clock::time_point> tryParseISO8601(
+    std::string_view raw)
+{
+    // YYYY-MM-DDTHH:MM:SS[.fraction]Z
+    if (raw.size() < 20 || raw[4] != '-' || raw[7] != '-' || raw[10] != 'T' ||
+        raw[13] != ':' || raw[16] != ':' || raw.back() != 'Z')
+    {
+        return std::nullopt;
+    }
+
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    if (!parseDigits(raw, 0, 4, year) || !parseDigits(raw, 5, 2, month) ||
+        !parseDigits(raw, 8, 2, day) || !parseDigits(raw, 11, 2, hour) ||
+        !parseDigits(raw, 14, 2, minute) || !parseDigits(raw, 17, 2, second))
+    {
+        return std::nullopt;
+    }
+
+    if (hour > 23 || minute > 59 || second > 59)
+    {
+        return std::nullopt;
+    }
+
+    const date::year_month_day ymd{date::year{year},
+                                   date::month{static_cast<unsigned>(month)},
+                                   date::day{static_cast<unsigned>(day)}};
+    if (!ymd.ok())
+    {
+        return std::nullopt;
+    }
+
+    std::chrono::nanoseconds fraction{0};
+    const std::size_t fractionStart = 19;
+    const auto fractionEnd = raw.size() - 1;
+    if (fractionStart < fractionEnd)
+    {
+        const auto digits = fractionEnd - fractionStart - 1;
+        if (raw[fractionStart] != '.' || digits == 0 || digits > 9)
+        {
+            return std::nullopt;
+        }
+
+        int value = 0;
+        if (!parseDigits(raw, fractionStart + 1, digits, value))
+        {
+            return std::nullopt;
+        }
+
+        std::int64_t nanoseconds = value;
+        for (auto i = digits; i < 9; i++)
+        {
+            nanoseconds *= 10;
+        }
+        fraction = std::chrono::nanoseconds{nanoseconds};
+    }
+
+    const auto tp = date::sys_days{ymd} + std::chrono::hours{hour} +
+                    std::chrono::minutes{minute} +
+                    std::chrono::seconds{second} + fraction;
+
+    return std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+        tp);
+}
+
+std::chrono::system_clock::time_point parseISO8601(std::string_view raw)
+{
+    if (auto tp = tryParseISO8601(raw))
+    {
+        return *tp;
+    }
+
+    // Anything that isn't in the layout Twitch uses, e.g. leap seconds or
+    // more than nanosecond precision
+    std::istringstream in{std::string{raw}};
+    std::chrono::system_clock::time_point tp;
+    in >> date::parse("%FT%TZ", tp);
+
+    return tp;
+}
+
 boost::json::result_for<std::chrono::system_clock::time_point,
                         boost::json::value>::type
     tag_invoke(
         boost::json::try_value_to_tag<std::chrono::system_clock::time_point>,
         const boost::json::value &jvRoot, const AsISO8601 &)
 {
-    const auto raw = boost::json::try_value_to<std::string>(jvRoot);
-    if (raw.has_error())
+    const auto *raw = jvRoot.if_string();
+    if (raw == nullptr)
     {
-        return raw.error();
+        return boost::json::error_code{boost::json::error::not_string};
     }
 
-    std::istringstream in{*raw};
-    std::chrono::system_clock::time_point tp;
-    in >> date::parse("%FT%TZ", tp);
-
-    return tp;
+    return parseISO8601({raw->data(), raw->size()});
 }
 }  // namespace eventsub
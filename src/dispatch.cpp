@@ -0,0 +1,94 @@
+#include "twitch-eventsub-ws/dispatch.hpp"
+
+#include "twitch-eventsub-ws/errors.hpp"
+
+#include <boost/json.hpp>
+
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+namespace eventsub::detail {
+
+namespace {
+
+// Returned by the MetadataSink once it has read the metadata of a message
+boost::json::error_code metadataRead()
+{
+    static const error::ApplicationErrorCategory errorMetadataRead{
+        "Stopped after reading the metadata"};
+    return boost::system::error_code{129, errorMetadataRead};
+}
+
+// Reads the metadata of a message, and stops the parser once it reaches the
+// payload so we can pick how to deserialize it
+class MetadataSink final : public sax::Sink
+{
+public:
+    Kind kind() const override
+    {
+        return Kind::Object;
+    }
+
+    boost::json::error_code onKey(void *target, std::string_view key,
+                                  std::uint64_t &seen,
+                                  sax::Slot &next) const override
+    {
+        if (key == "metadata")
+        {
+            seen |= 1;
+            next = sax::slot(*static_cast<messages::MetadataView *>(target));
+            return {};
+        }
+
+        if (key == "payload" && (seen & 1) != 0)
+        {
+            return metadataRead();
+        }
+
+        next = {};
+        return {};
+    }
+};
+
+// Whether view points into message, rather than into the parser's buffer
+bool pointsInto(std::string_view view, std::string_view message)
+{
+    const std::less<const char *> less;
+    return !less(view.data(), message.data()) &&
+           !less(message.data() + message.size(), view.data() + view.size());
+}
+
+bool pointsInto(const std::optional<std::string_view> &view,
+                std::string_view message)
+{
+    return !view || pointsInto(*view, message);
+}
+
+}  // namespace
+
+bool readMetadata(std::string_view message, sax::Parser &parser,
+                  messages::MetadataView &metadata)
+{
+    static const MetadataSink metadataSink;
+
+    if (parser.parse(message, sax::Slot{&metadata, &metadataSink}) !=
+        metadataRead())
+    {
+        return false;
+    }
+
+    return pointsInto(metadata.messageID, message) &&
+           pointsInto(metadata.messageType, message) &&
+           pointsInto(metadata.messageTimestamp, message) &&
+           pointsInto(metadata.subscriptionType, message) &&
+           pointsInto(metadata.subscriptionVersion, message);
+}
+
+void fail(boost::system::error_code ec, const char *what)
+{
+    std::cerr << what << ": " << ec.message() << "\n";
+}
+
+}  // namespace eventsub::detail
@@ -0,0 +1,95 @@
+#include "twitch-eventsub-ws/frame-arena.hpp"
+
+#include <algorithm>
+#include <memory>
+
+namespace eventsub {
+
+namespace {
+
+std::unique_ptr<unsigned char[]> allocateBlock(std::size_t size)
+{
+    // Not using make_unique here since we don't want the block zeroed
+    return std::unique_ptr<unsigned char[]>(new unsigned char[size]);
+}
+
+}  // namespace
+
+FrameArena::FrameArena(std::size_t initialBlockSize)
+    : block(allocateBlock(initialBlockSize))
+    , size(initialBlockSize)
+{
+}
+
+void FrameArena::reset()
+{
+    this->highWater = std::max(this->highWater, this->frameBytes);
+
+    if (!this->overflow.empty())
+    {
+        this->overflow.clear();
+
+        // The last frame didn't fit, grow the block so it will next time
+        auto newSize = this->size;
+        while (newSize < this->frameBytes && newSize < MAX_BLOCK_SIZE)
+        {
+            newSize *= 2;
+        }
+        newSize = std::min(newSize, MAX_BLOCK_SIZE);
+
+        if (newSize > this->size)
+        {
+            this->block = allocateBlock(newSize);
+            this->size = newSize;
+        }
+    }
+
+    this->used = 0;
+    this->frameBytes = 0;
+}
+
+std::size_t FrameArena::highWaterMark() const noexcept
+{
+    return std::max(this->highWater, this->frameBytes);
+}
+
+std::size_t FrameArena::blockSize() const noexcept
+{
+    return this->size;
+}
+
+void *FrameArena::do_allocate(std::size_t n, std::size_t align)
+{
+    auto *start = this->block.get() + this->used;
+    void *p = start;
+    auto space = this->size - this->used;
+    if (std::align(align, n, p, space) != nullptr)
+    {
+        const auto consumed =
+            static_cast<std::size_t>(static_cast<unsigned char *>(p) - start) +
+            n;
+        this->used += consumed;
+        this->frameBytes += consumed;
+        return p;
+    }
+
+    // The block is full, fall back to the heap until the next reset
+    auto chunkSize = n + align;
+    this->frameBytes += chunkSize;
+    void *chunk = this->overflow.emplace_back(allocateBlock(chunkSize)).get();
+    return std::align(align, n, chunk, chunkSize);
+}
+
+void FrameArena::do_deallocate(void * /*p*/, std::size_t /*n*/,
+                               std::size_t /*align*/)
+{
+    // Everything is released at once in reset()
+}
+
+bool FrameArena::do_is_equal(
+    const boost::json::memory_resource &mr) const noexcept
+{
+    return this == &mr;
+}
+
+}  // namespace eventsub
@@ -1,12 +1,16 @@
 #include "twitch-eventsub-ws/messages/metadata.hpp"
 
 #include "twitch-eventsub-ws/errors.hpp"
+#include "twitch-eventsub-ws/perfect-hash.hpp"
 
 #include <boost/json.hpp>
 
+#include <utility>
+
 namespace eventsub::messages {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Metadata, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Metadata>, const boost::json::value &jvRoot)
 {
@@ -18,50 +22,108 @@ boost::json::result_for<Metadata, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvmessageID = root.if_contains("message_id");
-    if (jvmessageID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvmessageID = nullptr;
+    const boost::json::value *jvmessageType = nullptr;
+    const boost::json::value *jvmessageTimestamp = nullptr;
+    const boost::json::value *jvsubscriptionType = nullptr;
+    const boost::json::value *jvsubscriptionVersion = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageID{"Missing required key message_id"};
-        return boost::system::error_code{129, error_missing_field_messageID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 10:
+                if (key == "message_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvmessageID = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "message_type")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvmessageType = &member.value();
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'm':
+                        if (key == "message_timestamp")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvmessageTimestamp = &member.value();
+                        }
+                        break;
+                    case 's':
+                        if (key == "subscription_type")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvsubscriptionType = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 20:
+                if (key == "subscription_version")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvsubscriptionVersion = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
-
-    if (messageID.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return messageID.error();
+        if (jvmessageID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageID{
+                    "Missing required key message_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_messageID};
+        }
+
+        if (jvmessageType == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageType{
+                    "Missing required key message_type"};
+            return boost::system::error_code{129,
+                                             error_missing_field_messageType};
+        }
+
+        if (jvmessageTimestamp == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageTimestamp{
+                    "Missing required key message_timestamp"};
+            return boost::system::error_code{
+                129, error_missing_field_messageTimestamp};
+        }
     }
 
-    const auto *jvmessageType = root.if_contains("message_type");
-    if (jvmessageType == nullptr)
+    auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
+
+    if (messageID.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageType{
-                "Missing required key message_type"};
-        return boost::system::error_code{129, error_missing_field_messageType};
+        return messageID.error();
     }
 
-    const auto messageType =
-        boost::json::try_value_to<std::string>(*jvmessageType);
+    auto messageType = boost::json::try_value_to<std::string>(*jvmessageType);
 
     if (messageType.has_error())
     {
         return messageType.error();
     }
 
-    const auto *jvmessageTimestamp = root.if_contains("message_timestamp");
-    if (jvmessageTimestamp == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageTimestamp{
-                "Missing required key message_timestamp"};
-        return boost::system::error_code{129,
-                                         error_missing_field_messageTimestamp};
-    }
-
-    const auto messageTimestamp =
-        boost::json::try_value_to<std::string>(*jvmessageTimestamp);
+    auto messageTimestamp =
+        boost::json::try_value_to<Timestamp>(*jvmessageTimestamp);
 
     if (messageTimestamp.has_error())
     {
@@ -69,42 +131,435 @@ boost::json::result_for<Metadata, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::string> subscriptionType = std::nullopt;
-    const auto *jvsubscriptionType = root.if_contains("subscription_type");
     if (jvsubscriptionType != nullptr && !jvsubscriptionType->is_null())
     {
-        const auto tsubscriptionType =
+        auto tsubscriptionType =
             boost::json::try_value_to<std::string>(*jvsubscriptionType);
 
         if (tsubscriptionType.has_error())
         {
             return tsubscriptionType.error();
         }
-        subscriptionType = tsubscriptionType.value();
+        subscriptionType = std::move(tsubscriptionType.value());
     }
 
     std::optional<std::string> subscriptionVersion = std::nullopt;
-    const auto *jvsubscriptionVersion =
-        root.if_contains("subscription_version");
     if (jvsubscriptionVersion != nullptr && !jvsubscriptionVersion->is_null())
     {
-        const auto tsubscriptionVersion =
+        auto tsubscriptionVersion =
             boost::json::try_value_to<std::string>(*jvsubscriptionVersion);
 
         if (tsubscriptionVersion.has_error())
         {
             return tsubscriptionVersion.error();
         }
-        subscriptionVersion = tsubscriptionVersion.value();
+        subscriptionVersion = std::move(tsubscriptionVersion.value());
     }
 
     return Metadata{
-        .messageID = messageID.value(),
-        .messageType = messageType.value(),
-        .messageTimestamp = messageTimestamp.value(),
-        .subscriptionType = subscriptionType,
-        .subscriptionVersion = subscriptionVersion,
+        .messageID = std::move(messageID.value()),
+        .messageType = std::move(messageType.value()),
+        .messageTimestamp = std::move(messageTimestamp.value()),
+        .subscriptionType = std::move(subscriptionType),
+        .subscriptionVersion = std::move(subscriptionVersion),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Metadata> /*tag*/)
+{
+    static const sax::ObjectSink<Metadata> sink{
+        [](Metadata &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 10:
+                    if (key == "message_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.messageID);
+                    }
+                    break;
+                case 12:
+                    if (key == "message_type")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.messageType);
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'm':
+                            if (key == "message_timestamp")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                return sax::slot(out.messageTimestamp);
+                            }
+                            break;
+                        case 's':
+                            if (key == "subscription_type")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                return sax::slot(out.subscriptionType);
+                            }
+                            break;
+                    }
+                    break;
+                case 20:
+                    if (key == "subscription_version")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.subscriptionVersion);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageID{
+                        "Missing required key message_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_messageID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageType{
+                        "Missing required key message_type"};
+                return boost::system::error_code{
+                    129, error_missing_field_messageType};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageTimestamp{
+                        "Missing required key message_timestamp"};
+                return boost::system::error_code{
+                    129, error_missing_field_messageTimestamp};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 // DESERIALIZATION IMPLEMENTATION END
 
+namespace {
+
+constexpr auto MESSAGE_TYPES = makePerfectHashMap<MessageType>({
+    {"session_welcome", {}, MessageType::SessionWelcome},
+    {"session_keepalive", {}, MessageType::SessionKeepalive},
+    {"session_reconnect", {}, MessageType::SessionReconnect},
+    {"notification", {}, MessageType::Notification},
+    {"revocation", {}, MessageType::Revocation},
+});
+
+constexpr auto SUBSCRIPTIONS = makePerfectHashMap<Subscription>({
+    {"channel.ban", "1", Subscription::ChannelBanV1},
+    {"stream.online", "1", Subscription::StreamOnlineV1},
+    {"stream.offline", "1", Subscription::StreamOfflineV1},
+    {"channel.chat.notification", "1", Subscription::ChannelChatNotificationV1},
+    {"channel.update", "1", Subscription::ChannelUpdateV1},
+    {"channel.chat.message", "1", Subscription::ChannelChatMessageV1},
+    // Add your new subscription types above this line
+});
+
+// Decode the message & subscription types of a view once it has been read
+void decode(MetadataView &view)
+{
+    view.type = parseMessageType(view.messageType);
+
+    if (view.subscriptionType && view.subscriptionVersion)
+    {
+        view.subscription = parseSubscription(*view.subscriptionType,
+                                              *view.subscriptionVersion);
+    }
+    else
+    {
+        view.subscription = Subscription::Unknown;
+    }
+}
+
+// Returns the error for the first required key that wasn't seen, if any
+boost::json::error_code checkRequired(std::uint64_t seen)
+{
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) == requiredMask)
+    {
+        return {};
+    }
+
+    if ((seen & (std::uint64_t{1} << 0)) == 0)
+    {
+        static const error::ApplicationErrorCategory errorMissingMessageID{
+            "Missing required key message_id"};
+        return boost::system::error_code{129, errorMissingMessageID};
+    }
+
+    if ((seen & (std::uint64_t{1} << 1)) == 0)
+    {
+        static const error::ApplicationErrorCategory errorMissingMessageType{
+            "Missing required key message_type"};
+        return boost::system::error_code{129, errorMissingMessageType};
+    }
+
+    static const error::ApplicationErrorCategory errorMissingMessageTimestamp{
+        "Missing required key message_timestamp"};
+    return boost::system::error_code{129, errorMissingMessageTimestamp};
+}
+
+bool toView(const boost::json::value &jv, std::string_view &out)
+{
+    const auto *str = jv.if_string();
+    if (str == nullptr)
+    {
+        return false;
+    }
+
+    out = {str->data(), str->size()};
+    return true;
+}
+
+bool toOptionalView(const boost::json::value *jv,
+                    std::optional<std::string_view> &out)
+{
+    if (jv == nullptr || jv->is_null())
+    {
+        return true;
+    }
+
+    return toView(*jv, out.emplace());
+}
+
+std::optional<std::string> toOptionalString(
+    const std::optional<std::string_view> &view)
+{
+    if (!view)
+    {
+        return std::nullopt;
+    }
+
+    return std::string{*view};
+}
+
+}  // namespace
+
+MessageType parseMessageType(std::string_view messageType)
+{
+    const auto *type = MESSAGE_TYPES.find(messageType);
+    if (type == nullptr)
+    {
+        return MessageType::Unknown;
+    }
+
+    return *type;
+}
+
+Subscription parseSubscription(std::string_view subscriptionType,
+                               std::string_view subscriptionVersion)
+{
+    const auto *subscription =
+        SUBSCRIPTIONS.find(subscriptionType, subscriptionVersion);
+    if (subscription == nullptr)
+    {
+        return Subscription::Unknown;
+    }
+
+    return *subscription;
+}
+
+Metadata MetadataView::toMetadata() const
+{
+    return {
+        std::string{this->messageID},
+        std::string{this->messageType},
+        Timestamp{std::string{this->messageTimestamp}},
+        toOptionalString(this->subscriptionType),
+        toOptionalString(this->subscriptionVersion),
+    };
+}
+
+boost::json::result_for<MetadataView, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<MetadataView> /*tag*/,
+    const boost::json::value &jvRoot)
+{
+    if (!jvRoot.is_object())
+    {
+        static const error::ApplicationErrorCategory errorMustBeObject{
+            "Metadata must be an object"};
+        return boost::system::error_code{129, errorMustBeObject};
+    }
+    const auto &root = jvRoot.get_object();
+
+    std::uint64_t seen = 0;
+    const boost::json::value *jvmessageID = nullptr;
+    const boost::json::value *jvmessageType = nullptr;
+    const boost::json::value *jvmessageTimestamp = nullptr;
+    const boost::json::value *jvsubscriptionType = nullptr;
+    const boost::json::value *jvsubscriptionVersion = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 10:
+                if (key == "message_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvmessageID = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "message_type")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvmessageType = &member.value();
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'm':
+                        if (key == "message_timestamp")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvmessageTimestamp = &member.value();
+                        }
+                        break;
+                    case 's':
+                        if (key == "subscription_type")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvsubscriptionType = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 20:
+                if (key == "subscription_version")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvsubscriptionVersion = &member.value();
+                }
+                break;
+        }
+    }
+
+    if (auto ec = checkRequired(seen))
+    {
+        return ec;
+    }
+
+    MetadataView view;
+
+    if (!toView(*jvmessageID, view.messageID) ||
+        !toView(*jvmessageType, view.messageType) ||
+        !toView(*jvmessageTimestamp, view.messageTimestamp) ||
+        !toOptionalView(jvsubscriptionType, view.subscriptionType) ||
+        !toOptionalView(jvsubscriptionVersion, view.subscriptionVersion))
+    {
+        return sax::unexpectedType();
+    }
+
+    decode(view);
+
+    return view;
+}
+
+const sax::Sink &saxSink(sax::SinkTag<MetadataView> /*tag*/)
+{
+    class MetadataViewSink final : public sax::Sink
+    {
+    public:
+        Kind kind() const override
+        {
+            return Kind::Object;
+        }
+
+        boost::json::error_code onKey(void *target, std::string_view key,
+                                      std::uint64_t &seen,
+                                      sax::Slot &next) const override
+        {
+            auto &out = *static_cast<MetadataView *>(target);
+
+            next = {};
+            switch (key.size())
+            {
+                case 10:
+                    if (key == "message_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        next = sax::slot(out.messageID);
+                    }
+                    break;
+                case 12:
+                    if (key == "message_type")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        next = sax::slot(out.messageType);
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'm':
+                            if (key == "message_timestamp")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                next = sax::slot(out.messageTimestamp);
+                            }
+                            break;
+                        case 's':
+                            if (key == "subscription_type")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                next = sax::slot(out.subscriptionType);
+                            }
+                            break;
+                    }
+                    break;
+                case 20:
+                    if (key == "subscription_version")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        next = sax::slot(out.subscriptionVersion);
+                    }
+                    break;
+            }
+
+            return {};
+        }
+
+        boost::json::error_code onObjectEnd(void *target,
+                                            std::uint64_t seen) const override
+        {
+            if (auto ec = checkRequired(seen))
+            {
+                return ec;
+            }
+
+            decode(*static_cast<MetadataView *>(target));
+            return {};
+        }
+    };
+
+    static const MetadataViewSink sink;
+    return sink;
+}
+
 }  // namespace eventsub::messages
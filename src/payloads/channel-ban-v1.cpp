@@ -18,6 +18,7 @@ std::chrono::system_clock::duration Event::timeoutDuration() const
 }
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot)
 {
@@ -29,17 +30,240 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+    const boost::json::value *jvmoderatorUserID = nullptr;
+    const boost::json::value *jvmoderatorUserLogin = nullptr;
+    const boost::json::value *jvmoderatorUserName = nullptr;
+    const boost::json::value *jvuserID = nullptr;
+    const boost::json::value *jvuserLogin = nullptr;
+    const boost::json::value *jvuserName = nullptr;
+    const boost::json::value *jvreason = nullptr;
+    const boost::json::value *jvisPermanent = nullptr;
+    const boost::json::value *jvbannedAt = nullptr;
+    const boost::json::value *jvendsAt = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 6:
+                if (key == "reason")
+                {
+                    seen |= std::uint64_t{1} << 9;
+                    jvreason = &member.value();
+                }
+                break;
+            case 7:
+                switch (key[0])
+                {
+                    case 'u':
+                        if (key == "user_id")
+                        {
+                            seen |= std::uint64_t{1} << 6;
+                            jvuserID = &member.value();
+                        }
+                        break;
+                    case 'e':
+                        if (key == "ends_at")
+                        {
+                            seen |= std::uint64_t{1} << 12;
+                            jvendsAt = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 9:
+                switch (key[0])
+                {
+                    case 'u':
+                        if (key == "user_name")
+                        {
+                            seen |= std::uint64_t{1} << 8;
+                            jvuserName = &member.value();
+                        }
+                        break;
+                    case 'b':
+                        if (key == "banned_at")
+                        {
+                            seen |= std::uint64_t{1} << 11;
+                            jvbannedAt = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 10:
+                if (key == "user_login")
+                {
+                    seen |= std::uint64_t{1} << 7;
+                    jvuserLogin = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "is_permanent")
+                {
+                    seen |= std::uint64_t{1} << 10;
+                    jvisPermanent = &member.value();
+                }
+                break;
+            case 17:
+                if (key == "moderator_user_id")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvmoderatorUserID = &member.value();
+                }
+                break;
+            case 19:
+                switch (key[0])
+                {
+                    case 'b':
+                        if (key == "broadcaster_user_id")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvbroadcasterUserID = &member.value();
+                        }
+                        break;
+                    case 'm':
+                        if (key == "moderator_user_name")
+                        {
+                            seen |= std::uint64_t{1} << 5;
+                            jvmoderatorUserName = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 20:
+                if (key == "moderator_user_login")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvmoderatorUserLogin = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 4095U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
+
+        if (jvmoderatorUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_moderatorUserID{
+                    "Missing required key moderator_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_moderatorUserID};
+        }
+
+        if (jvmoderatorUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_moderatorUserLogin{
+                    "Missing required key moderator_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_moderatorUserLogin};
+        }
+
+        if (jvmoderatorUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_moderatorUserName{
+                    "Missing required key moderator_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_moderatorUserName};
+        }
+
+        if (jvuserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userID{"Missing required key user_id"};
+            return boost::system::error_code{129, error_missing_field_userID};
+        }
+
+        if (jvuserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userLogin{
+                    "Missing required key user_login"};
+            return boost::system::error_code{129,
+                                             error_missing_field_userLogin};
+        }
+
+        if (jvuserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userName{"Missing required key user_name"};
+            return boost::system::error_code{129, error_missing_field_userName};
+        }
+
+        if (jvreason == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_reason{"Missing required key reason"};
+            return boost::system::error_code{129, error_missing_field_reason};
+        }
+
+        if (jvisPermanent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_isPermanent{
+                    "Missing required key is_permanent"};
+            return boost::system::error_code{129,
+                                             error_missing_field_isPermanent};
+        }
+
+        if (jvbannedAt == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_bannedAt{"Missing required key banned_at"};
+            return boost::system::error_code{129, error_missing_field_bannedAt};
+        }
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -47,18 +271,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -66,18 +279,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -85,17 +287,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserName.error();
     }
 
-    const auto *jvmoderatorUserID = root.if_contains("moderator_user_id");
-    if (jvmoderatorUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_moderatorUserID{
-                "Missing required key moderator_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_moderatorUserID};
-    }
-
-    const auto moderatorUserID =
+    auto moderatorUserID =
         boost::json::try_value_to<std::string>(*jvmoderatorUserID);
 
     if (moderatorUserID.has_error())
@@ -103,17 +295,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return moderatorUserID.error();
     }
 
-    const auto *jvmoderatorUserLogin = root.if_contains("moderator_user_login");
-    if (jvmoderatorUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_moderatorUserLogin{
-                "Missing required key moderator_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_moderatorUserLogin};
-    }
-
-    const auto moderatorUserLogin =
+    auto moderatorUserLogin =
         boost::json::try_value_to<std::string>(*jvmoderatorUserLogin);
 
     if (moderatorUserLogin.has_error())
@@ -121,17 +303,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return moderatorUserLogin.error();
     }
 
-    const auto *jvmoderatorUserName = root.if_contains("moderator_user_name");
-    if (jvmoderatorUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_moderatorUserName{
-                "Missing required key moderator_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_moderatorUserName};
-    }
-
-    const auto moderatorUserName =
+    auto moderatorUserName =
         boost::json::try_value_to<std::string>(*jvmoderatorUserName);
 
     if (moderatorUserName.has_error())
@@ -139,91 +311,42 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return moderatorUserName.error();
     }
 
-    const auto *jvuserID = root.if_contains("user_id");
-    if (jvuserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_userID{
-            "Missing required key user_id"};
-        return boost::system::error_code{129, error_missing_field_userID};
-    }
-
-    const auto userID = boost::json::try_value_to<std::string>(*jvuserID);
+    auto userID = boost::json::try_value_to<std::string>(*jvuserID);
 
     if (userID.has_error())
     {
         return userID.error();
     }
 
-    const auto *jvuserLogin = root.if_contains("user_login");
-    if (jvuserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userLogin{"Missing required key user_login"};
-        return boost::system::error_code{129, error_missing_field_userLogin};
-    }
-
-    const auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
+    auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
 
     if (userLogin.has_error())
     {
         return userLogin.error();
     }
 
-    const auto *jvuserName = root.if_contains("user_name");
-    if (jvuserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userName{"Missing required key user_name"};
-        return boost::system::error_code{129, error_missing_field_userName};
-    }
-
-    const auto userName = boost::json::try_value_to<std::string>(*jvuserName);
+    auto userName = boost::json::try_value_to<std::string>(*jvuserName);
 
     if (userName.has_error())
     {
         return userName.error();
     }
 
-    const auto *jvreason = root.if_contains("reason");
-    if (jvreason == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_reason{
-            "Missing required key reason"};
-        return boost::system::error_code{129, error_missing_field_reason};
-    }
-
-    const auto reason = boost::json::try_value_to<std::string>(*jvreason);
+    auto reason = boost::json::try_value_to<std::string>(*jvreason);
 
     if (reason.has_error())
     {
         return reason.error();
     }
 
-    const auto *jvisPermanent = root.if_contains("is_permanent");
-    if (jvisPermanent == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_isPermanent{
-                "Missing required key is_permanent"};
-        return boost::system::error_code{129, error_missing_field_isPermanent};
-    }
-
-    const auto isPermanent = boost::json::try_value_to<bool>(*jvisPermanent);
+    auto isPermanent = boost::json::try_value_to<bool>(*jvisPermanent);
 
     if (isPermanent.has_error())
     {
         return isPermanent.error();
     }
 
-    const auto *jvbannedAt = root.if_contains("banned_at");
-    if (jvbannedAt == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_bannedAt{"Missing required key banned_at"};
-        return boost::system::error_code{129, error_missing_field_bannedAt};
-    }
-
-    const auto bannedAt =
+    auto bannedAt =
         boost::json::try_value_to<std::chrono::system_clock::time_point>(
             *jvbannedAt, AsISO8601());
 
@@ -233,10 +356,9 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::chrono::system_clock::time_point> endsAt = std::nullopt;
-    const auto *jvendsAt = root.if_contains("ends_at");
     if (jvendsAt != nullptr && !jvendsAt->is_null())
     {
-        const auto tendsAt =
+        auto tendsAt =
             boost::json::try_value_to<std::chrono::system_clock::time_point>(
                 *jvendsAt, AsISO8601());
 
@@ -244,26 +366,262 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tendsAt.error();
         }
-        endsAt = tendsAt.value();
+        endsAt = std::move(tendsAt.value());
     }
 
     return Event{
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
-        .moderatorUserID = moderatorUserID.value(),
-        .moderatorUserLogin = moderatorUserLogin.value(),
-        .moderatorUserName = moderatorUserName.value(),
-        .userID = userID.value(),
-        .userLogin = userLogin.value(),
-        .userName = userName.value(),
-        .reason = reason.value(),
-        .isPermanent = isPermanent.value(),
-        .bannedAt = bannedAt.value(),
-        .endsAt = endsAt,
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+        .moderatorUserID = std::move(moderatorUserID.value()),
+        .moderatorUserLogin = std::move(moderatorUserLogin.value()),
+        .moderatorUserName = std::move(moderatorUserName.value()),
+        .userID = std::move(userID.value()),
+        .userLogin = std::move(userLogin.value()),
+        .userName = std::move(userName.value()),
+        .reason = std::move(reason.value()),
+        .isPermanent = std::move(isPermanent.value()),
+        .bannedAt = std::move(bannedAt.value()),
+        .endsAt = std::move(endsAt),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 6:
+                    if (key == "reason")
+                    {
+                        seen |= std::uint64_t{1} << 9;
+                        return sax::slot(out.reason);
+                    }
+                    break;
+                case 7:
+                    switch (key[0])
+                    {
+                        case 'u':
+                            if (key == "user_id")
+                            {
+                                seen |= std::uint64_t{1} << 6;
+                                return sax::slot(out.userID);
+                            }
+                            break;
+                        case 'e':
+                            if (key == "ends_at")
+                            {
+                                seen |= std::uint64_t{1} << 12;
+                                return sax::slot(out.endsAt, AsISO8601());
+                            }
+                            break;
+                    }
+                    break;
+                case 9:
+                    switch (key[0])
+                    {
+                        case 'u':
+                            if (key == "user_name")
+                            {
+                                seen |= std::uint64_t{1} << 8;
+                                return sax::slot(out.userName);
+                            }
+                            break;
+                        case 'b':
+                            if (key == "banned_at")
+                            {
+                                seen |= std::uint64_t{1} << 11;
+                                return sax::slot(out.bannedAt, AsISO8601());
+                            }
+                            break;
+                    }
+                    break;
+                case 10:
+                    if (key == "user_login")
+                    {
+                        seen |= std::uint64_t{1} << 7;
+                        return sax::slot(out.userLogin);
+                    }
+                    break;
+                case 12:
+                    if (key == "is_permanent")
+                    {
+                        seen |= std::uint64_t{1} << 10;
+                        return sax::slot(out.isPermanent);
+                    }
+                    break;
+                case 17:
+                    if (key == "moderator_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.moderatorUserID);
+                    }
+                    break;
+                case 19:
+                    switch (key[0])
+                    {
+                        case 'b':
+                            if (key == "broadcaster_user_id")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.broadcasterUserID);
+                            }
+                            break;
+                        case 'm':
+                            if (key == "moderator_user_name")
+                            {
+                                seen |= std::uint64_t{1} << 5;
+                                return sax::slot(out.moderatorUserName);
+                            }
+                            break;
+                    }
+                    break;
+                case 20:
+                    if (key == "moderator_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.moderatorUserLogin);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 4095U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_moderatorUserID{
+                        "Missing required key moderator_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_moderatorUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_moderatorUserLogin{
+                        "Missing required key moderator_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_moderatorUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_moderatorUserName{
+                        "Missing required key moderator_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_moderatorUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userID{"Missing required key user_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 7)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userLogin{
+                        "Missing required key user_login"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 8)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userName{
+                        "Missing required key user_name"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 9)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_reason{"Missing required key reason"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_reason};
+            }
+
+            if ((seen & (std::uint64_t{1} << 10)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_isPermanent{
+                        "Missing required key is_permanent"};
+                return boost::system::error_code{
+                    129, error_missing_field_isPermanent};
+            }
+
+            if ((seen & (std::uint64_t{1} << 11)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_bannedAt{
+                        "Missing required key banned_at"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_bannedAt};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -275,16 +633,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
     }
 
-    const auto subscription =
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -292,15 +687,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -308,9 +695,65 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 // DESERIALIZATION IMPLEMENTATION END
 
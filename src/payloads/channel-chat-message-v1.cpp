@@ -7,6 +7,7 @@
 namespace eventsub::payload::channel_chat_message::v1 {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Badge>, const boost::json::value &jvRoot)
 {
@@ -18,45 +19,80 @@ boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsetID = root.if_contains("set_id");
-    if (jvsetID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsetID = nullptr;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvinfo = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_setID{
-            "Missing required key set_id"};
-        return boost::system::error_code{129, error_missing_field_setID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvid = &member.value();
+                }
+                break;
+            case 4:
+                if (key == "info")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvinfo = &member.value();
+                }
+                break;
+            case 6:
+                if (key == "set_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsetID = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto setID = boost::json::try_value_to<std::string>(*jvsetID);
-
-    if (setID.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return setID.error();
+        if (jvsetID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_setID{"Missing required key set_id"};
+            return boost::system::error_code{129, error_missing_field_setID};
+        }
+
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvinfo == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_info{"Missing required key info"};
+            return boost::system::error_code{129, error_missing_field_info};
+        }
     }
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    auto setID = boost::json::try_value_to<std::string>(*jvsetID);
+
+    if (setID.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        return setID.error();
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
+    auto id = boost::json::try_value_to<std::string>(*jvid);
 
     if (id.has_error())
     {
         return id.error();
     }
 
-    const auto *jvinfo = root.if_contains("info");
-    if (jvinfo == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_info{
-            "Missing required key info"};
-        return boost::system::error_code{129, error_missing_field_info};
-    }
-
-    const auto info = boost::json::try_value_to<std::string>(*jvinfo);
+    auto info = boost::json::try_value_to<std::string>(*jvinfo);
 
     if (info.has_error())
     {
@@ -64,10 +100,77 @@ boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     }
 
     return Badge{
-        .setID = setID.value(),
-        .id = id.value(),
-        .info = info.value(),
+        .setID = std::move(setID.value()),
+        .id = std::move(id.value()),
+        .info = std::move(info.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Badge> /*tag*/)
+{
+    static const sax::ObjectSink<Badge> sink{
+        [](Badge &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 4:
+                    if (key == "info")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.info);
+                    }
+                    break;
+                case 6:
+                    if (key == "set_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.setID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_setID{"Missing required key set_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_setID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_info{"Missing required key info"};
+                return boost::system::error_code{129, error_missing_field_info};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
@@ -81,45 +184,85 @@ boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvprefix = root.if_contains("prefix");
-    if (jvprefix == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvprefix = nullptr;
+    const boost::json::value *jvbits = nullptr;
+    const boost::json::value *jvtier = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_prefix{
-            "Missing required key prefix"};
-        return boost::system::error_code{129, error_missing_field_prefix};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                switch (key[0])
+                {
+                    case 'b':
+                        if (key == "bits")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvbits = &member.value();
+                        }
+                        break;
+                    case 't':
+                        if (key == "tier")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvtier = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 6:
+                if (key == "prefix")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvprefix = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto prefix = boost::json::try_value_to<std::string>(*jvprefix);
-
-    if (prefix.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return prefix.error();
+        if (jvprefix == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_prefix{"Missing required key prefix"};
+            return boost::system::error_code{129, error_missing_field_prefix};
+        }
+
+        if (jvbits == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_bits{"Missing required key bits"};
+            return boost::system::error_code{129, error_missing_field_bits};
+        }
+
+        if (jvtier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_tier{"Missing required key tier"};
+            return boost::system::error_code{129, error_missing_field_tier};
+        }
     }
 
-    const auto *jvbits = root.if_contains("bits");
-    if (jvbits == nullptr)
+    auto prefix = boost::json::try_value_to<std::string>(*jvprefix);
+
+    if (prefix.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_bits{
-            "Missing required key bits"};
-        return boost::system::error_code{129, error_missing_field_bits};
+        return prefix.error();
     }
 
-    const auto bits = boost::json::try_value_to<int>(*jvbits);
+    auto bits = boost::json::try_value_to<int>(*jvbits);
 
     if (bits.has_error())
     {
         return bits.error();
     }
 
-    const auto *jvtier = root.if_contains("tier");
-    if (jvtier == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_tier{
-            "Missing required key tier"};
-        return boost::system::error_code{129, error_missing_field_tier};
-    }
-
-    const auto tier = boost::json::try_value_to<int>(*jvtier);
+    auto tier = boost::json::try_value_to<int>(*jvtier);
 
     if (tier.has_error())
     {
@@ -127,12 +270,85 @@ boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     }
 
     return Cheermote{
-        .prefix = prefix.value(),
-        .bits = bits.value(),
-        .tier = tier.value(),
+        .prefix = std::move(prefix.value()),
+        .bits = std::move(bits.value()),
+        .tier = std::move(tier.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Cheermote> /*tag*/)
+{
+    static const sax::ObjectSink<Cheermote> sink{
+        [](Cheermote &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    switch (key[0])
+                    {
+                        case 'b':
+                            if (key == "bits")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.bits);
+                            }
+                            break;
+                        case 't':
+                            if (key == "tier")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                return sax::slot(out.tier);
+                            }
+                            break;
+                    }
+                    break;
+                case 6:
+                    if (key == "prefix")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.prefix);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_prefix{"Missing required key prefix"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_prefix};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_bits{"Missing required key bits"};
+                return boost::system::error_code{129, error_missing_field_bits};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_tier{"Missing required key tier"};
+                return boost::system::error_code{129, error_missing_field_tier};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Emote>, const boost::json::value &jvRoot)
 {
@@ -144,60 +360,104 @@ boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvemoteSetID = nullptr;
+    const boost::json::value *jvownerID = nullptr;
+    const boost::json::value *jvformat = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 6:
+                if (key == "format")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvformat = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "owner_id")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvownerID = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "emote_set_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvemoteSetID = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
-
-    if (id.has_error())
+    constexpr std::uint64_t requiredMask = 15U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return id.error();
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvemoteSetID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_emoteSetID{
+                    "Missing required key emote_set_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_emoteSetID};
+        }
+
+        if (jvownerID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_ownerID{"Missing required key owner_id"};
+            return boost::system::error_code{129, error_missing_field_ownerID};
+        }
+
+        if (jvformat == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_format{"Missing required key format"};
+            return boost::system::error_code{129, error_missing_field_format};
+        }
     }
 
-    const auto *jvemoteSetID = root.if_contains("emote_set_id");
-    if (jvemoteSetID == nullptr)
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_emoteSetID{"Missing required key emote_set_id"};
-        return boost::system::error_code{129, error_missing_field_emoteSetID};
+        return id.error();
     }
 
-    const auto emoteSetID =
-        boost::json::try_value_to<std::string>(*jvemoteSetID);
+    auto emoteSetID = boost::json::try_value_to<std::string>(*jvemoteSetID);
 
     if (emoteSetID.has_error())
     {
         return emoteSetID.error();
     }
 
-    const auto *jvownerID = root.if_contains("owner_id");
-    if (jvownerID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_ownerID{"Missing required key owner_id"};
-        return boost::system::error_code{129, error_missing_field_ownerID};
-    }
-
-    const auto ownerID = boost::json::try_value_to<std::string>(*jvownerID);
+    auto ownerID = boost::json::try_value_to<std::string>(*jvownerID);
 
     if (ownerID.has_error())
     {
         return ownerID.error();
     }
 
-    const auto *jvformat = root.if_contains("format");
-    if (jvformat == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_format{
-            "Missing required key format"};
-        return boost::system::error_code{129, error_missing_field_format};
-    }
-    const auto format =
+    auto format =
         boost::json::try_value_to<std::vector<std::string>>(*jvformat);
     if (format.has_error())
     {
@@ -205,13 +465,98 @@ boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     }
 
     return Emote{
-        .id = id.value(),
-        .emoteSetID = emoteSetID.value(),
-        .ownerID = ownerID.value(),
-        .format = format.value(),
+        .id = std::move(id.value()),
+        .emoteSetID = std::move(emoteSetID.value()),
+        .ownerID = std::move(ownerID.value()),
+        .format = std::move(format.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Emote> /*tag*/)
+{
+    static const sax::ObjectSink<Emote> sink{
+        [](Emote &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 6:
+                    if (key == "format")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.format);
+                    }
+                    break;
+                case 8:
+                    if (key == "owner_id")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.ownerID);
+                    }
+                    break;
+                case 12:
+                    if (key == "emote_set_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.emoteSetID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 15U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_emoteSetID{
+                        "Missing required key emote_set_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_emoteSetID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_ownerID{
+                        "Missing required key owner_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_ownerID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_format{"Missing required key format"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_format};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Mention>, const boost::json::value &jvRoot)
 {
@@ -223,45 +568,82 @@ boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvuserID = root.if_contains("user_id");
-    if (jvuserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvuserID = nullptr;
+    const boost::json::value *jvuserName = nullptr;
+    const boost::json::value *jvuserLogin = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_userID{
-            "Missing required key user_id"};
-        return boost::system::error_code{129, error_missing_field_userID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 7:
+                if (key == "user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvuserID = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "user_name")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvuserName = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "user_login")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvuserLogin = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto userID = boost::json::try_value_to<std::string>(*jvuserID);
-
-    if (userID.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return userID.error();
+        if (jvuserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userID{"Missing required key user_id"};
+            return boost::system::error_code{129, error_missing_field_userID};
+        }
+
+        if (jvuserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userName{"Missing required key user_name"};
+            return boost::system::error_code{129, error_missing_field_userName};
+        }
+
+        if (jvuserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userLogin{
+                    "Missing required key user_login"};
+            return boost::system::error_code{129,
+                                             error_missing_field_userLogin};
+        }
     }
 
-    const auto *jvuserName = root.if_contains("user_name");
-    if (jvuserName == nullptr)
+    auto userID = boost::json::try_value_to<std::string>(*jvuserID);
+
+    if (userID.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userName{"Missing required key user_name"};
-        return boost::system::error_code{129, error_missing_field_userName};
+        return userID.error();
     }
 
-    const auto userName = boost::json::try_value_to<std::string>(*jvuserName);
+    auto userName = boost::json::try_value_to<std::string>(*jvuserName);
 
     if (userName.has_error())
     {
         return userName.error();
     }
 
-    const auto *jvuserLogin = root.if_contains("user_login");
-    if (jvuserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userLogin{"Missing required key user_login"};
-        return boost::system::error_code{129, error_missing_field_userLogin};
-    }
-
-    const auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
+    auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
 
     if (userLogin.has_error())
     {
@@ -269,12 +651,84 @@ boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     }
 
     return Mention{
-        .userID = userID.value(),
-        .userName = userName.value(),
-        .userLogin = userLogin.value(),
+        .userID = std::move(userID.value()),
+        .userName = std::move(userName.value()),
+        .userLogin = std::move(userLogin.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Mention> /*tag*/)
+{
+    static const sax::ObjectSink<Mention> sink{
+        [](Mention &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 7:
+                    if (key == "user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.userID);
+                    }
+                    break;
+                case 9:
+                    if (key == "user_name")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.userName);
+                    }
+                    break;
+                case 10:
+                    if (key == "user_login")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.userLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userID{"Missing required key user_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userName{
+                        "Missing required key user_name"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userLogin{
+                        "Missing required key user_login"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userLogin};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<MessageFragment>,
     const boost::json::value &jvRoot)
@@ -287,30 +741,87 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvtype = root.if_contains("type");
-    if (jvtype == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvtype = nullptr;
+    const boost::json::value *jvtext = nullptr;
+    const boost::json::value *jvcheermote = nullptr;
+    const boost::json::value *jvemote = nullptr;
+    const boost::json::value *jvmention = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_type{
-            "Missing required key type"};
-        return boost::system::error_code{129, error_missing_field_type};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                switch (key[1])
+                {
+                    case 'y':
+                        if (key == "type")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvtype = &member.value();
+                        }
+                        break;
+                    case 'e':
+                        if (key == "text")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvtext = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 5:
+                if (key == "emote")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvemote = &member.value();
+                }
+                break;
+            case 7:
+                if (key == "mention")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvmention = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "cheermote")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvcheermote = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto type = boost::json::try_value_to<std::string>(*jvtype);
-
-    if (type.has_error())
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return type.error();
+        if (jvtype == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_type{"Missing required key type"};
+            return boost::system::error_code{129, error_missing_field_type};
+        }
+
+        if (jvtext == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_text{"Missing required key text"};
+            return boost::system::error_code{129, error_missing_field_text};
+        }
     }
 
-    const auto *jvtext = root.if_contains("text");
-    if (jvtext == nullptr)
+    auto type = boost::json::try_value_to<std::string>(*jvtype);
+
+    if (type.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_text{
-            "Missing required key text"};
-        return boost::system::error_code{129, error_missing_field_text};
+        return type.error();
     }
 
-    const auto text = boost::json::try_value_to<std::string>(*jvtext);
+    auto text = boost::json::try_value_to<std::string>(*jvtext);
 
     if (text.has_error())
     {
@@ -319,10 +830,9 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
 
     std::optional<eventsub::payload::channel_chat_message::v1::Cheermote>
         cheermote = std::nullopt;
-    const auto *jvcheermote = root.if_contains("cheermote");
     if (jvcheermote != nullptr && !jvcheermote->is_null())
     {
-        const auto tcheermote = boost::json::try_value_to<
+        auto tcheermote = boost::json::try_value_to<
             eventsub::payload::channel_chat_message::v1::Cheermote>(
             *jvcheermote);
 
@@ -330,48 +840,125 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
         {
             return tcheermote.error();
         }
-        cheermote = tcheermote.value();
+        cheermote = std::move(tcheermote.value());
     }
 
     std::optional<eventsub::payload::channel_chat_message::v1::Emote> emote =
         std::nullopt;
-    const auto *jvemote = root.if_contains("emote");
     if (jvemote != nullptr && !jvemote->is_null())
     {
-        const auto temote = boost::json::try_value_to<
+        auto temote = boost::json::try_value_to<
             eventsub::payload::channel_chat_message::v1::Emote>(*jvemote);
 
         if (temote.has_error())
         {
             return temote.error();
         }
-        emote = temote.value();
+        emote = std::move(temote.value());
     }
 
     std::optional<eventsub::payload::channel_chat_message::v1::Mention>
         mention = std::nullopt;
-    const auto *jvmention = root.if_contains("mention");
     if (jvmention != nullptr && !jvmention->is_null())
     {
-        const auto tmention = boost::json::try_value_to<
+        auto tmention = boost::json::try_value_to<
             eventsub::payload::channel_chat_message::v1::Mention>(*jvmention);
 
         if (tmention.has_error())
         {
             return tmention.error();
         }
-        mention = tmention.value();
+        mention = std::move(tmention.value());
     }
 
     return MessageFragment{
-        .type = type.value(),
-        .text = text.value(),
-        .cheermote = cheermote,
-        .emote = emote,
-        .mention = mention,
+        .type = std::move(type.value()),
+        .text = std::move(text.value()),
+        .cheermote = std::move(cheermote),
+        .emote = std::move(emote),
+        .mention = std::move(mention),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<MessageFragment> /*tag*/)
+{
+    static const sax::ObjectSink<MessageFragment> sink{
+        [](MessageFragment &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    switch (key[1])
+                    {
+                        case 'y':
+                            if (key == "type")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.type);
+                            }
+                            break;
+                        case 'e':
+                            if (key == "text")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.text);
+                            }
+                            break;
+                    }
+                    break;
+                case 5:
+                    if (key == "emote")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.emote);
+                    }
+                    break;
+                case 7:
+                    if (key == "mention")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.mention);
+                    }
+                    break;
+                case 9:
+                    if (key == "cheermote")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.cheermote);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_type{"Missing required key type"};
+                return boost::system::error_code{129, error_missing_field_type};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_text{"Missing required key text"};
+                return boost::system::error_code{129, error_missing_field_text};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Message>, const boost::json::value &jvRoot)
 {
@@ -383,29 +970,59 @@ boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvtext = root.if_contains("text");
-    if (jvtext == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvtext = nullptr;
+    const boost::json::value *jvfragments = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_text{
-            "Missing required key text"};
-        return boost::system::error_code{129, error_missing_field_text};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                if (key == "text")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvtext = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "fragments")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvfragments = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvtext == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_text{"Missing required key text"};
+            return boost::system::error_code{129, error_missing_field_text};
+        }
+
+        if (jvfragments == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_fragments{"Missing required key fragments"};
+            return boost::system::error_code{129,
+                                             error_missing_field_fragments};
+        }
     }
 
-    const auto text = boost::json::try_value_to<std::string>(*jvtext);
+    auto text = boost::json::try_value_to<std::string>(*jvtext);
 
     if (text.has_error())
     {
         return text.error();
     }
 
-    const auto *jvfragments = root.if_contains("fragments");
-    if (jvfragments == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_fragments{"Missing required key fragments"};
-        return boost::system::error_code{129, error_missing_field_fragments};
-    }
-    const auto fragments = boost::json::try_value_to<std::vector<
+    auto fragments = boost::json::try_value_to<std::vector<
         eventsub::payload::channel_chat_message::v1::MessageFragment>>(
         *jvfragments);
     if (fragments.has_error())
@@ -414,11 +1031,66 @@ boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     }
 
     return Message{
-        .text = text.value(),
-        .fragments = fragments.value(),
+        .text = std::move(text.value()),
+        .fragments = std::move(fragments.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Message> /*tag*/)
+{
+    static const sax::ObjectSink<Message> sink{
+        [](Message &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    if (key == "text")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.text);
+                    }
+                    break;
+                case 9:
+                    if (key == "fragments")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.fragments);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_text{"Missing required key text"};
+                return boost::system::error_code{129, error_missing_field_text};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_fragments{
+                        "Missing required key fragments"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_fragments};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Cheer, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Cheer>, const boost::json::value &jvRoot)
 {
@@ -430,15 +1102,36 @@ boost::json::result_for<Cheer, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbits = root.if_contains("bits");
-    if (jvbits == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbits = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_bits{
-            "Missing required key bits"};
-        return boost::system::error_code{129, error_missing_field_bits};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                if (key == "bits")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvbits = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto bits = boost::json::try_value_to<int>(*jvbits);
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvbits == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_bits{"Missing required key bits"};
+            return boost::system::error_code{129, error_missing_field_bits};
+        }
+    }
+
+    auto bits = boost::json::try_value_to<int>(*jvbits);
 
     if (bits.has_error())
     {
@@ -446,8 +1139,46 @@ boost::json::result_for<Cheer, boost::json::value>::type tag_invoke(
     }
 
     return Cheer{
-        .bits = bits.value(),
+        .bits = std::move(bits.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Cheer> /*tag*/)
+{
+    static const sax::ObjectSink<Cheer> sink{
+        [](Cheer &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    if (key == "bits")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.bits);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_bits{"Missing required key bits"};
+                return boost::system::error_code{129, error_missing_field_bits};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
@@ -461,17 +1192,185 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvparentMessageID = root.if_contains("parent_message_id");
-    if (jvparentMessageID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvparentMessageID = nullptr;
+    const boost::json::value *jvparentUserID = nullptr;
+    const boost::json::value *jvparentUserLogin = nullptr;
+    const boost::json::value *jvparentUserName = nullptr;
+    const boost::json::value *jvparentMessageBody = nullptr;
+    const boost::json::value *jvthreadMessageID = nullptr;
+    const boost::json::value *jvthreadUserID = nullptr;
+    const boost::json::value *jvthreadUserLogin = nullptr;
+    const boost::json::value *jvthreadUserName = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 14:
+                switch (key[0])
+                {
+                    case 'p':
+                        if (key == "parent_user_id")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvparentUserID = &member.value();
+                        }
+                        break;
+                    case 't':
+                        if (key == "thread_user_id")
+                        {
+                            seen |= std::uint64_t{1} << 6;
+                            jvthreadUserID = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 16:
+                switch (key[0])
+                {
+                    case 'p':
+                        if (key == "parent_user_name")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvparentUserName = &member.value();
+                        }
+                        break;
+                    case 't':
+                        if (key == "thread_user_name")
+                        {
+                            seen |= std::uint64_t{1} << 8;
+                            jvthreadUserName = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'p':
+                        if (key == "parent_message_id")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvparentMessageID = &member.value();
+                        }
+                        if (key == "parent_user_login")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvparentUserLogin = &member.value();
+                        }
+                        break;
+                    case 't':
+                        if (key == "thread_message_id")
+                        {
+                            seen |= std::uint64_t{1} << 5;
+                            jvthreadMessageID = &member.value();
+                        }
+                        if (key == "thread_user_login")
+                        {
+                            seen |= std::uint64_t{1} << 7;
+                            jvthreadUserLogin = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 19:
+                if (key == "parent_message_body")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvparentMessageBody = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 511U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_parentMessageID{
-                "Missing required key parent_message_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_parentMessageID};
+        if (jvparentMessageID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_parentMessageID{
+                    "Missing required key parent_message_id"};
+            return boost::system::error_code{
+                129, error_missing_field_parentMessageID};
+        }
+
+        if (jvparentUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_parentUserID{
+                    "Missing required key parent_user_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_parentUserID};
+        }
+
+        if (jvparentUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_parentUserLogin{
+                    "Missing required key parent_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_parentUserLogin};
+        }
+
+        if (jvparentUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_parentUserName{
+                    "Missing required key parent_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_parentUserName};
+        }
+
+        if (jvparentMessageBody == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_parentMessageBody{
+                    "Missing required key parent_message_body"};
+            return boost::system::error_code{
+                129, error_missing_field_parentMessageBody};
+        }
+
+        if (jvthreadMessageID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_threadMessageID{
+                    "Missing required key thread_message_id"};
+            return boost::system::error_code{
+                129, error_missing_field_threadMessageID};
+        }
+
+        if (jvthreadUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_threadUserID{
+                    "Missing required key thread_user_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_threadUserID};
+        }
+
+        if (jvthreadUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_threadUserLogin{
+                    "Missing required key thread_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_threadUserLogin};
+        }
+
+        if (jvthreadUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_threadUserName{
+                    "Missing required key thread_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_threadUserName};
+        }
     }
 
-    const auto parentMessageID =
+    auto parentMessageID =
         boost::json::try_value_to<std::string>(*jvparentMessageID);
 
     if (parentMessageID.has_error())
@@ -479,34 +1378,14 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return parentMessageID.error();
     }
 
-    const auto *jvparentUserID = root.if_contains("parent_user_id");
-    if (jvparentUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_parentUserID{
-                "Missing required key parent_user_id"};
-        return boost::system::error_code{129, error_missing_field_parentUserID};
-    }
-
-    const auto parentUserID =
-        boost::json::try_value_to<std::string>(*jvparentUserID);
+    auto parentUserID = boost::json::try_value_to<std::string>(*jvparentUserID);
 
     if (parentUserID.has_error())
     {
         return parentUserID.error();
     }
 
-    const auto *jvparentUserLogin = root.if_contains("parent_user_login");
-    if (jvparentUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_parentUserLogin{
-                "Missing required key parent_user_login"};
-        return boost::system::error_code{129,
-                                         error_missing_field_parentUserLogin};
-    }
-
-    const auto parentUserLogin =
+    auto parentUserLogin =
         boost::json::try_value_to<std::string>(*jvparentUserLogin);
 
     if (parentUserLogin.has_error())
@@ -514,17 +1393,7 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return parentUserLogin.error();
     }
 
-    const auto *jvparentUserName = root.if_contains("parent_user_name");
-    if (jvparentUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_parentUserName{
-                "Missing required key parent_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_parentUserName};
-    }
-
-    const auto parentUserName =
+    auto parentUserName =
         boost::json::try_value_to<std::string>(*jvparentUserName);
 
     if (parentUserName.has_error())
@@ -532,17 +1401,7 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return parentUserName.error();
     }
 
-    const auto *jvparentMessageBody = root.if_contains("parent_message_body");
-    if (jvparentMessageBody == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_parentMessageBody{
-                "Missing required key parent_message_body"};
-        return boost::system::error_code{129,
-                                         error_missing_field_parentMessageBody};
-    }
-
-    const auto parentMessageBody =
+    auto parentMessageBody =
         boost::json::try_value_to<std::string>(*jvparentMessageBody);
 
     if (parentMessageBody.has_error())
@@ -550,17 +1409,7 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return parentMessageBody.error();
     }
 
-    const auto *jvthreadMessageID = root.if_contains("thread_message_id");
-    if (jvthreadMessageID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_threadMessageID{
-                "Missing required key thread_message_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_threadMessageID};
-    }
-
-    const auto threadMessageID =
+    auto threadMessageID =
         boost::json::try_value_to<std::string>(*jvthreadMessageID);
 
     if (threadMessageID.has_error())
@@ -568,34 +1417,14 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return threadMessageID.error();
     }
 
-    const auto *jvthreadUserID = root.if_contains("thread_user_id");
-    if (jvthreadUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_threadUserID{
-                "Missing required key thread_user_id"};
-        return boost::system::error_code{129, error_missing_field_threadUserID};
-    }
-
-    const auto threadUserID =
-        boost::json::try_value_to<std::string>(*jvthreadUserID);
+    auto threadUserID = boost::json::try_value_to<std::string>(*jvthreadUserID);
 
     if (threadUserID.has_error())
     {
         return threadUserID.error();
     }
 
-    const auto *jvthreadUserLogin = root.if_contains("thread_user_login");
-    if (jvthreadUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_threadUserLogin{
-                "Missing required key thread_user_login"};
-        return boost::system::error_code{129,
-                                         error_missing_field_threadUserLogin};
-    }
-
-    const auto threadUserLogin =
+    auto threadUserLogin =
         boost::json::try_value_to<std::string>(*jvthreadUserLogin);
 
     if (threadUserLogin.has_error())
@@ -603,17 +1432,7 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
         return threadUserLogin.error();
     }
 
-    const auto *jvthreadUserName = root.if_contains("thread_user_name");
-    if (jvthreadUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_threadUserName{
-                "Missing required key thread_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_threadUserName};
-    }
-
-    const auto threadUserName =
+    auto threadUserName =
         boost::json::try_value_to<std::string>(*jvthreadUserName);
 
     if (threadUserName.has_error())
@@ -622,16 +1441,195 @@ boost::json::result_for<Reply, boost::json::value>::type tag_invoke(
     }
 
     return Reply{
-        .parentMessageID = parentMessageID.value(),
-        .parentUserID = parentUserID.value(),
-        .parentUserLogin = parentUserLogin.value(),
-        .parentUserName = parentUserName.value(),
-        .parentMessageBody = parentMessageBody.value(),
-        .threadMessageID = threadMessageID.value(),
-        .threadUserID = threadUserID.value(),
-        .threadUserLogin = threadUserLogin.value(),
-        .threadUserName = threadUserName.value(),
+        .parentMessageID = std::move(parentMessageID.value()),
+        .parentUserID = std::move(parentUserID.value()),
+        .parentUserLogin = std::move(parentUserLogin.value()),
+        .parentUserName = std::move(parentUserName.value()),
+        .parentMessageBody = std::move(parentMessageBody.value()),
+        .threadMessageID = std::move(threadMessageID.value()),
+        .threadUserID = std::move(threadUserID.value()),
+        .threadUserLogin = std::move(threadUserLogin.value()),
+        .threadUserName = std::move(threadUserName.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Reply> /*tag*/)
+{
+    static const sax::ObjectSink<Reply> sink{
+        [](Reply &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 14:
+                    switch (key[0])
+                    {
+                        case 'p':
+                            if (key == "parent_user_id")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.parentUserID);
+                            }
+                            break;
+                        case 't':
+                            if (key == "thread_user_id")
+                            {
+                                seen |= std::uint64_t{1} << 6;
+                                return sax::slot(out.threadUserID);
+                            }
+                            break;
+                    }
+                    break;
+                case 16:
+                    switch (key[0])
+                    {
+                        case 'p':
+                            if (key == "parent_user_name")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                return sax::slot(out.parentUserName);
+                            }
+                            break;
+                        case 't':
+                            if (key == "thread_user_name")
+                            {
+                                seen |= std::uint64_t{1} << 8;
+                                return sax::slot(out.threadUserName);
+                            }
+                            break;
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'p':
+                            if (key == "parent_message_id")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.parentMessageID);
+                            }
+                            if (key == "parent_user_login")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                return sax::slot(out.parentUserLogin);
+                            }
+                            break;
+                        case 't':
+                            if (key == "thread_message_id")
+                            {
+                                seen |= std::uint64_t{1} << 5;
+                                return sax::slot(out.threadMessageID);
+                            }
+                            if (key == "thread_user_login")
+                            {
+                                seen |= std::uint64_t{1} << 7;
+                                return sax::slot(out.threadUserLogin);
+                            }
+                            break;
+                    }
+                    break;
+                case 19:
+                    if (key == "parent_message_body")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.parentMessageBody);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 511U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_parentMessageID{
+                        "Missing required key parent_message_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_parentMessageID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_parentUserID{
+                        "Missing required key parent_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_parentUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_parentUserLogin{
+                        "Missing required key parent_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_parentUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_parentUserName{
+                        "Missing required key parent_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_parentUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_parentMessageBody{
+                        "Missing required key parent_message_body"};
+                return boost::system::error_code{
+                    129, error_missing_field_parentMessageBody};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_threadMessageID{
+                        "Missing required key thread_message_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_threadMessageID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_threadUserID{
+                        "Missing required key thread_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_threadUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 7)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_threadUserLogin{
+                        "Missing required key thread_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_threadUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 8)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_threadUserName{
+                        "Missing required key thread_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_threadUserName};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
@@ -645,17 +1643,229 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+    const boost::json::value *jvchatterUserID = nullptr;
+    const boost::json::value *jvchatterUserLogin = nullptr;
+    const boost::json::value *jvchatterUserName = nullptr;
+    const boost::json::value *jvcolor = nullptr;
+    const boost::json::value *jvbadges = nullptr;
+    const boost::json::value *jvmessageID = nullptr;
+    const boost::json::value *jvmessageType = nullptr;
+    const boost::json::value *jvmessage = nullptr;
+    const boost::json::value *jvcheer = nullptr;
+    const boost::json::value *jvreply = nullptr;
+    const boost::json::value *jvchannelPointsCustomRewardID = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "color")
+                        {
+                            seen |= std::uint64_t{1} << 6;
+                            jvcolor = &member.value();
+                        }
+                        if (key == "cheer")
+                        {
+                            seen |= std::uint64_t{1} << 11;
+                            jvcheer = &member.value();
+                        }
+                        break;
+                    case 'r':
+                        if (key == "reply")
+                        {
+                            seen |= std::uint64_t{1} << 12;
+                            jvreply = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 6:
+                if (key == "badges")
+                {
+                    seen |= std::uint64_t{1} << 7;
+                    jvbadges = &member.value();
+                }
+                break;
+            case 7:
+                if (key == "message")
+                {
+                    seen |= std::uint64_t{1} << 10;
+                    jvmessage = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "message_id")
+                {
+                    seen |= std::uint64_t{1} << 8;
+                    jvmessageID = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "message_type")
+                {
+                    seen |= std::uint64_t{1} << 9;
+                    jvmessageType = &member.value();
+                }
+                break;
+            case 15:
+                if (key == "chatter_user_id")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvchatterUserID = &member.value();
+                }
+                break;
+            case 17:
+                if (key == "chatter_user_name")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvchatterUserName = &member.value();
+                }
+                break;
+            case 18:
+                if (key == "chatter_user_login")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvchatterUserLogin = &member.value();
+                }
+                break;
+            case 19:
+                if (key == "broadcaster_user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvbroadcasterUserID = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+            case 31:
+                if (key == "channel_points_custom_reward_id")
+                {
+                    seen |= std::uint64_t{1} << 13;
+                    jvchannelPointsCustomRewardID = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 2047U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
+
+        if (jvchatterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserID{
+                    "Missing required key chatter_user_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_chatterUserID};
+        }
+
+        if (jvchatterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserLogin{
+                    "Missing required key chatter_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_chatterUserLogin};
+        }
+
+        if (jvchatterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserName{
+                    "Missing required key chatter_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_chatterUserName};
+        }
+
+        if (jvcolor == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_color{"Missing required key color"};
+            return boost::system::error_code{129, error_missing_field_color};
+        }
+
+        if (jvbadges == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_badges{"Missing required key badges"};
+            return boost::system::error_code{129, error_missing_field_badges};
+        }
+
+        if (jvmessageID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageID{
+                    "Missing required key message_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_messageID};
+        }
+
+        if (jvmessageType == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageType{
+                    "Missing required key message_type"};
+            return boost::system::error_code{129,
+                                             error_missing_field_messageType};
+        }
+
+        if (jvmessage == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_message{"Missing required key message"};
+            return boost::system::error_code{129, error_missing_field_message};
+        }
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -663,18 +1873,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -682,18 +1881,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -701,17 +1889,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserName.error();
     }
 
-    const auto *jvchatterUserID = root.if_contains("chatter_user_id");
-    if (jvchatterUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserID{
-                "Missing required key chatter_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserID};
-    }
-
-    const auto chatterUserID =
+    auto chatterUserID =
         boost::json::try_value_to<std::string>(*jvchatterUserID);
 
     if (chatterUserID.has_error())
@@ -719,17 +1897,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserID.error();
     }
 
-    const auto *jvchatterUserLogin = root.if_contains("chatter_user_login");
-    if (jvchatterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserLogin{
-                "Missing required key chatter_user_login"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserLogin};
-    }
-
-    const auto chatterUserLogin =
+    auto chatterUserLogin =
         boost::json::try_value_to<std::string>(*jvchatterUserLogin);
 
     if (chatterUserLogin.has_error())
@@ -737,17 +1905,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserLogin.error();
     }
 
-    const auto *jvchatterUserName = root.if_contains("chatter_user_name");
-    if (jvchatterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserName{
-                "Missing required key chatter_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserName};
-    }
-
-    const auto chatterUserName =
+    auto chatterUserName =
         boost::json::try_value_to<std::string>(*jvchatterUserName);
 
     if (chatterUserName.has_error())
@@ -755,29 +1913,14 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserName.error();
     }
 
-    const auto *jvcolor = root.if_contains("color");
-    if (jvcolor == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_color{
-            "Missing required key color"};
-        return boost::system::error_code{129, error_missing_field_color};
-    }
-
-    const auto color = boost::json::try_value_to<std::string>(*jvcolor);
+    auto color = boost::json::try_value_to<std::string>(*jvcolor);
 
     if (color.has_error())
     {
         return color.error();
     }
 
-    const auto *jvbadges = root.if_contains("badges");
-    if (jvbadges == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_badges{
-            "Missing required key badges"};
-        return boost::system::error_code{129, error_missing_field_badges};
-    }
-    const auto badges = boost::json::try_value_to<
+    auto badges = boost::json::try_value_to<
         std::vector<eventsub::payload::channel_chat_message::v1::Badge>>(
         *jvbadges);
     if (badges.has_error())
@@ -785,47 +1928,21 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return badges.error();
     }
 
-    const auto *jvmessageID = root.if_contains("message_id");
-    if (jvmessageID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageID{"Missing required key message_id"};
-        return boost::system::error_code{129, error_missing_field_messageID};
-    }
-
-    const auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
+    auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
 
     if (messageID.has_error())
     {
         return messageID.error();
     }
 
-    const auto *jvmessageType = root.if_contains("message_type");
-    if (jvmessageType == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageType{
-                "Missing required key message_type"};
-        return boost::system::error_code{129, error_missing_field_messageType};
-    }
-
-    const auto messageType =
-        boost::json::try_value_to<std::string>(*jvmessageType);
+    auto messageType = boost::json::try_value_to<std::string>(*jvmessageType);
 
     if (messageType.has_error())
     {
         return messageType.error();
     }
 
-    const auto *jvmessage = root.if_contains("message");
-    if (jvmessage == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_message{"Missing required key message"};
-        return boost::system::error_code{129, error_missing_field_message};
-    }
-
-    const auto message = boost::json::try_value_to<Message>(*jvmessage);
+    auto message = boost::json::try_value_to<Message>(*jvmessage);
 
     if (message.has_error())
     {
@@ -834,41 +1951,37 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
 
     std::optional<eventsub::payload::channel_chat_message::v1::Cheer> cheer =
         std::nullopt;
-    const auto *jvcheer = root.if_contains("cheer");
     if (jvcheer != nullptr && !jvcheer->is_null())
     {
-        const auto tcheer = boost::json::try_value_to<
+        auto tcheer = boost::json::try_value_to<
             eventsub::payload::channel_chat_message::v1::Cheer>(*jvcheer);
 
         if (tcheer.has_error())
         {
             return tcheer.error();
         }
-        cheer = tcheer.value();
+        cheer = std::move(tcheer.value());
     }
 
     std::optional<eventsub::payload::channel_chat_message::v1::Reply> reply =
         std::nullopt;
-    const auto *jvreply = root.if_contains("reply");
     if (jvreply != nullptr && !jvreply->is_null())
     {
-        const auto treply = boost::json::try_value_to<
+        auto treply = boost::json::try_value_to<
             eventsub::payload::channel_chat_message::v1::Reply>(*jvreply);
 
         if (treply.has_error())
         {
             return treply.error();
         }
-        reply = treply.value();
+        reply = std::move(treply.value());
     }
 
     std::optional<std::string> channelPointsCustomRewardID = std::nullopt;
-    const auto *jvchannelPointsCustomRewardID =
-        root.if_contains("channel_points_custom_reward_id");
     if (jvchannelPointsCustomRewardID != nullptr &&
         !jvchannelPointsCustomRewardID->is_null())
     {
-        const auto tchannelPointsCustomRewardID =
+        auto tchannelPointsCustomRewardID =
             boost::json::try_value_to<std::string>(
                 *jvchannelPointsCustomRewardID);
 
@@ -876,27 +1989,249 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tchannelPointsCustomRewardID.error();
         }
-        channelPointsCustomRewardID = tchannelPointsCustomRewardID.value();
+        channelPointsCustomRewardID =
+            std::move(tchannelPointsCustomRewardID.value());
     }
 
     return Event{
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
-        .chatterUserID = chatterUserID.value(),
-        .chatterUserLogin = chatterUserLogin.value(),
-        .chatterUserName = chatterUserName.value(),
-        .color = color.value(),
-        .badges = badges.value(),
-        .messageID = messageID.value(),
-        .messageType = messageType.value(),
-        .message = message.value(),
-        .cheer = cheer,
-        .reply = reply,
-        .channelPointsCustomRewardID = channelPointsCustomRewardID,
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+        .chatterUserID = std::move(chatterUserID.value()),
+        .chatterUserLogin = std::move(chatterUserLogin.value()),
+        .chatterUserName = std::move(chatterUserName.value()),
+        .color = std::move(color.value()),
+        .badges = std::move(badges.value()),
+        .messageID = std::move(messageID.value()),
+        .messageType = std::move(messageType.value()),
+        .message = std::move(message.value()),
+        .cheer = std::move(cheer),
+        .reply = std::move(reply),
+        .channelPointsCustomRewardID = std::move(channelPointsCustomRewardID),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "color")
+                            {
+                                seen |= std::uint64_t{1} << 6;
+                                return sax::slot(out.color);
+                            }
+                            if (key == "cheer")
+                            {
+                                seen |= std::uint64_t{1} << 11;
+                                return sax::slot(out.cheer);
+                            }
+                            break;
+                        case 'r':
+                            if (key == "reply")
+                            {
+                                seen |= std::uint64_t{1} << 12;
+                                return sax::slot(out.reply);
+                            }
+                            break;
+                    }
+                    break;
+                case 6:
+                    if (key == "badges")
+                    {
+                        seen |= std::uint64_t{1} << 7;
+                        return sax::slot(out.badges);
+                    }
+                    break;
+                case 7:
+                    if (key == "message")
+                    {
+                        seen |= std::uint64_t{1} << 10;
+                        return sax::slot(out.message);
+                    }
+                    break;
+                case 10:
+                    if (key == "message_id")
+                    {
+                        seen |= std::uint64_t{1} << 8;
+                        return sax::slot(out.messageID);
+                    }
+                    break;
+                case 12:
+                    if (key == "message_type")
+                    {
+                        seen |= std::uint64_t{1} << 9;
+                        return sax::slot(out.messageType);
+                    }
+                    break;
+                case 15:
+                    if (key == "chatter_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.chatterUserID);
+                    }
+                    break;
+                case 17:
+                    if (key == "chatter_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.chatterUserName);
+                    }
+                    break;
+                case 18:
+                    if (key == "chatter_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.chatterUserLogin);
+                    }
+                    break;
+                case 19:
+                    if (key == "broadcaster_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.broadcasterUserID);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+                case 31:
+                    if (key == "channel_points_custom_reward_id")
+                    {
+                        seen |= std::uint64_t{1} << 13;
+                        return sax::slot(out.channelPointsCustomRewardID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 2047U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserID{
+                        "Missing required key chatter_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserLogin{
+                        "Missing required key chatter_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserName{
+                        "Missing required key chatter_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_color{"Missing required key color"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_color};
+            }
+
+            if ((seen & (std::uint64_t{1} << 7)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_badges{"Missing required key badges"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_badges};
+            }
+
+            if ((seen & (std::uint64_t{1} << 8)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageID{
+                        "Missing required key message_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_messageID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 9)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageType{
+                        "Missing required key message_type"};
+                return boost::system::error_code{
+                    129, error_missing_field_messageType};
+            }
+
+            if ((seen & (std::uint64_t{1} << 10)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_message{"Missing required key message"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_message};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -908,16 +2243,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto subscription =
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
+    }
+
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -925,15 +2297,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -941,10 +2305,66 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
     };
 }
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
 // DESERIALIZATION IMPLEMENTATION END
 
 }  // namespace eventsub::payload::channel_chat_message::v1
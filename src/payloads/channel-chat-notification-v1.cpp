@@ -7,6 +7,7 @@
 namespace eventsub::payload::channel_chat_notification::v1 {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Badge>, const boost::json::value &jvRoot)
 {
@@ -18,45 +19,80 @@ boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsetID = root.if_contains("set_id");
-    if (jvsetID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsetID = nullptr;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvinfo = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_setID{
-            "Missing required key set_id"};
-        return boost::system::error_code{129, error_missing_field_setID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvid = &member.value();
+                }
+                break;
+            case 4:
+                if (key == "info")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvinfo = &member.value();
+                }
+                break;
+            case 6:
+                if (key == "set_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsetID = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto setID = boost::json::try_value_to<std::string>(*jvsetID);
-
-    if (setID.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return setID.error();
+        if (jvsetID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_setID{"Missing required key set_id"};
+            return boost::system::error_code{129, error_missing_field_setID};
+        }
+
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvinfo == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_info{"Missing required key info"};
+            return boost::system::error_code{129, error_missing_field_info};
+        }
     }
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    auto setID = boost::json::try_value_to<std::string>(*jvsetID);
+
+    if (setID.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        return setID.error();
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
+    auto id = boost::json::try_value_to<std::string>(*jvid);
 
     if (id.has_error())
     {
         return id.error();
     }
 
-    const auto *jvinfo = root.if_contains("info");
-    if (jvinfo == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_info{
-            "Missing required key info"};
-        return boost::system::error_code{129, error_missing_field_info};
-    }
-
-    const auto info = boost::json::try_value_to<std::string>(*jvinfo);
+    auto info = boost::json::try_value_to<std::string>(*jvinfo);
 
     if (info.has_error())
     {
@@ -64,12 +100,79 @@ boost::json::result_for<Badge, boost::json::value>::type tag_invoke(
     }
 
     return Badge{
-        .setID = setID.value(),
-        .id = id.value(),
-        .info = info.value(),
+        .setID = std::move(setID.value()),
+        .id = std::move(id.value()),
+        .info = std::move(info.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Badge> /*tag*/)
+{
+    static const sax::ObjectSink<Badge> sink{
+        [](Badge &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 4:
+                    if (key == "info")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.info);
+                    }
+                    break;
+                case 6:
+                    if (key == "set_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.setID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_setID{"Missing required key set_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_setID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_info{"Missing required key info"};
+                return boost::system::error_code{129, error_missing_field_info};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Cheermote>, const boost::json::value &jvRoot)
 {
@@ -81,45 +184,85 @@ boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvprefix = root.if_contains("prefix");
-    if (jvprefix == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvprefix = nullptr;
+    const boost::json::value *jvbits = nullptr;
+    const boost::json::value *jvtier = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_prefix{
-            "Missing required key prefix"};
-        return boost::system::error_code{129, error_missing_field_prefix};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                switch (key[0])
+                {
+                    case 'b':
+                        if (key == "bits")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvbits = &member.value();
+                        }
+                        break;
+                    case 't':
+                        if (key == "tier")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvtier = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 6:
+                if (key == "prefix")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvprefix = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto prefix = boost::json::try_value_to<std::string>(*jvprefix);
-
-    if (prefix.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return prefix.error();
+        if (jvprefix == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_prefix{"Missing required key prefix"};
+            return boost::system::error_code{129, error_missing_field_prefix};
+        }
+
+        if (jvbits == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_bits{"Missing required key bits"};
+            return boost::system::error_code{129, error_missing_field_bits};
+        }
+
+        if (jvtier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_tier{"Missing required key tier"};
+            return boost::system::error_code{129, error_missing_field_tier};
+        }
     }
 
-    const auto *jvbits = root.if_contains("bits");
-    if (jvbits == nullptr)
+    auto prefix = boost::json::try_value_to<std::string>(*jvprefix);
+
+    if (prefix.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_bits{
-            "Missing required key bits"};
-        return boost::system::error_code{129, error_missing_field_bits};
+        return prefix.error();
     }
 
-    const auto bits = boost::json::try_value_to<int>(*jvbits);
+    auto bits = boost::json::try_value_to<int>(*jvbits);
 
     if (bits.has_error())
     {
         return bits.error();
     }
 
-    const auto *jvtier = root.if_contains("tier");
-    if (jvtier == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_tier{
-            "Missing required key tier"};
-        return boost::system::error_code{129, error_missing_field_tier};
-    }
-
-    const auto tier = boost::json::try_value_to<int>(*jvtier);
+    auto tier = boost::json::try_value_to<int>(*jvtier);
 
     if (tier.has_error())
     {
@@ -127,12 +270,85 @@ boost::json::result_for<Cheermote, boost::json::value>::type tag_invoke(
     }
 
     return Cheermote{
-        .prefix = prefix.value(),
-        .bits = bits.value(),
-        .tier = tier.value(),
+        .prefix = std::move(prefix.value()),
+        .bits = std::move(bits.value()),
+        .tier = std::move(tier.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Cheermote> /*tag*/)
+{
+    static const sax::ObjectSink<Cheermote> sink{
+        [](Cheermote &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    switch (key[0])
+                    {
+                        case 'b':
+                            if (key == "bits")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.bits);
+                            }
+                            break;
+                        case 't':
+                            if (key == "tier")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                return sax::slot(out.tier);
+                            }
+                            break;
+                    }
+                    break;
+                case 6:
+                    if (key == "prefix")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.prefix);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_prefix{"Missing required key prefix"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_prefix};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_bits{"Missing required key bits"};
+                return boost::system::error_code{129, error_missing_field_bits};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_tier{"Missing required key tier"};
+                return boost::system::error_code{129, error_missing_field_tier};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Emote>, const boost::json::value &jvRoot)
 {
@@ -144,60 +360,104 @@ boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvemoteSetID = nullptr;
+    const boost::json::value *jvownerID = nullptr;
+    const boost::json::value *jvformat = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 6:
+                if (key == "format")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvformat = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "owner_id")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvownerID = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "emote_set_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvemoteSetID = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
-
-    if (id.has_error())
+    constexpr std::uint64_t requiredMask = 15U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return id.error();
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvemoteSetID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_emoteSetID{
+                    "Missing required key emote_set_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_emoteSetID};
+        }
+
+        if (jvownerID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_ownerID{"Missing required key owner_id"};
+            return boost::system::error_code{129, error_missing_field_ownerID};
+        }
+
+        if (jvformat == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_format{"Missing required key format"};
+            return boost::system::error_code{129, error_missing_field_format};
+        }
     }
 
-    const auto *jvemoteSetID = root.if_contains("emote_set_id");
-    if (jvemoteSetID == nullptr)
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_emoteSetID{"Missing required key emote_set_id"};
-        return boost::system::error_code{129, error_missing_field_emoteSetID};
+        return id.error();
     }
 
-    const auto emoteSetID =
-        boost::json::try_value_to<std::string>(*jvemoteSetID);
+    auto emoteSetID = boost::json::try_value_to<std::string>(*jvemoteSetID);
 
     if (emoteSetID.has_error())
     {
         return emoteSetID.error();
     }
 
-    const auto *jvownerID = root.if_contains("owner_id");
-    if (jvownerID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_ownerID{"Missing required key owner_id"};
-        return boost::system::error_code{129, error_missing_field_ownerID};
-    }
-
-    const auto ownerID = boost::json::try_value_to<std::string>(*jvownerID);
+    auto ownerID = boost::json::try_value_to<std::string>(*jvownerID);
 
     if (ownerID.has_error())
     {
         return ownerID.error();
     }
 
-    const auto *jvformat = root.if_contains("format");
-    if (jvformat == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_format{
-            "Missing required key format"};
-        return boost::system::error_code{129, error_missing_field_format};
-    }
-    const auto format =
+    auto format =
         boost::json::try_value_to<std::vector<std::string>>(*jvformat);
     if (format.has_error())
     {
@@ -205,11 +465,96 @@ boost::json::result_for<Emote, boost::json::value>::type tag_invoke(
     }
 
     return Emote{
-        .id = id.value(),
-        .emoteSetID = emoteSetID.value(),
-        .ownerID = ownerID.value(),
-        .format = format.value(),
+        .id = std::move(id.value()),
+        .emoteSetID = std::move(emoteSetID.value()),
+        .ownerID = std::move(ownerID.value()),
+        .format = std::move(format.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Emote> /*tag*/)
+{
+    static const sax::ObjectSink<Emote> sink{
+        [](Emote &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 6:
+                    if (key == "format")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.format);
+                    }
+                    break;
+                case 8:
+                    if (key == "owner_id")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.ownerID);
+                    }
+                    break;
+                case 12:
+                    if (key == "emote_set_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.emoteSetID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 15U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_emoteSetID{
+                        "Missing required key emote_set_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_emoteSetID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_ownerID{
+                        "Missing required key owner_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_ownerID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_format{"Missing required key format"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_format};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
@@ -223,45 +568,82 @@ boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvuserID = root.if_contains("user_id");
-    if (jvuserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvuserID = nullptr;
+    const boost::json::value *jvuserName = nullptr;
+    const boost::json::value *jvuserLogin = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_userID{
-            "Missing required key user_id"};
-        return boost::system::error_code{129, error_missing_field_userID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 7:
+                if (key == "user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvuserID = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "user_name")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvuserName = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "user_login")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvuserLogin = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto userID = boost::json::try_value_to<std::string>(*jvuserID);
-
-    if (userID.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return userID.error();
+        if (jvuserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userID{"Missing required key user_id"};
+            return boost::system::error_code{129, error_missing_field_userID};
+        }
+
+        if (jvuserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userName{"Missing required key user_name"};
+            return boost::system::error_code{129, error_missing_field_userName};
+        }
+
+        if (jvuserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userLogin{
+                    "Missing required key user_login"};
+            return boost::system::error_code{129,
+                                             error_missing_field_userLogin};
+        }
     }
 
-    const auto *jvuserName = root.if_contains("user_name");
-    if (jvuserName == nullptr)
+    auto userID = boost::json::try_value_to<std::string>(*jvuserID);
+
+    if (userID.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userName{"Missing required key user_name"};
-        return boost::system::error_code{129, error_missing_field_userName};
+        return userID.error();
     }
 
-    const auto userName = boost::json::try_value_to<std::string>(*jvuserName);
+    auto userName = boost::json::try_value_to<std::string>(*jvuserName);
 
     if (userName.has_error())
     {
         return userName.error();
     }
 
-    const auto *jvuserLogin = root.if_contains("user_login");
-    if (jvuserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userLogin{"Missing required key user_login"};
-        return boost::system::error_code{129, error_missing_field_userLogin};
-    }
-
-    const auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
+    auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
 
     if (userLogin.has_error())
     {
@@ -269,12 +651,84 @@ boost::json::result_for<Mention, boost::json::value>::type tag_invoke(
     }
 
     return Mention{
-        .userID = userID.value(),
-        .userName = userName.value(),
-        .userLogin = userLogin.value(),
+        .userID = std::move(userID.value()),
+        .userName = std::move(userName.value()),
+        .userLogin = std::move(userLogin.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Mention> /*tag*/)
+{
+    static const sax::ObjectSink<Mention> sink{
+        [](Mention &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 7:
+                    if (key == "user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.userID);
+                    }
+                    break;
+                case 9:
+                    if (key == "user_name")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.userName);
+                    }
+                    break;
+                case 10:
+                    if (key == "user_login")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.userLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userID{"Missing required key user_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userName{
+                        "Missing required key user_name"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userLogin{
+                        "Missing required key user_login"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userLogin};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<MessageFragment>,
     const boost::json::value &jvRoot)
@@ -287,30 +741,87 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvtype = root.if_contains("type");
-    if (jvtype == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvtype = nullptr;
+    const boost::json::value *jvtext = nullptr;
+    const boost::json::value *jvcheermote = nullptr;
+    const boost::json::value *jvemote = nullptr;
+    const boost::json::value *jvmention = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_type{
-            "Missing required key type"};
-        return boost::system::error_code{129, error_missing_field_type};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                switch (key[1])
+                {
+                    case 'y':
+                        if (key == "type")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvtype = &member.value();
+                        }
+                        break;
+                    case 'e':
+                        if (key == "text")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvtext = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 5:
+                if (key == "emote")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvemote = &member.value();
+                }
+                break;
+            case 7:
+                if (key == "mention")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvmention = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "cheermote")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvcheermote = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto type = boost::json::try_value_to<std::string>(*jvtype);
-
-    if (type.has_error())
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return type.error();
+        if (jvtype == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_type{"Missing required key type"};
+            return boost::system::error_code{129, error_missing_field_type};
+        }
+
+        if (jvtext == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_text{"Missing required key text"};
+            return boost::system::error_code{129, error_missing_field_text};
+        }
     }
 
-    const auto *jvtext = root.if_contains("text");
-    if (jvtext == nullptr)
+    auto type = boost::json::try_value_to<std::string>(*jvtype);
+
+    if (type.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_text{
-            "Missing required key text"};
-        return boost::system::error_code{129, error_missing_field_text};
+        return type.error();
     }
 
-    const auto text = boost::json::try_value_to<std::string>(*jvtext);
+    auto text = boost::json::try_value_to<std::string>(*jvtext);
 
     if (text.has_error())
     {
@@ -319,10 +830,9 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Cheermote>
         cheermote = std::nullopt;
-    const auto *jvcheermote = root.if_contains("cheermote");
     if (jvcheermote != nullptr && !jvcheermote->is_null())
     {
-        const auto tcheermote = boost::json::try_value_to<
+        auto tcheermote = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Cheermote>(
             *jvcheermote);
 
@@ -330,30 +840,28 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
         {
             return tcheermote.error();
         }
-        cheermote = tcheermote.value();
+        cheermote = std::move(tcheermote.value());
     }
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Emote>
         emote = std::nullopt;
-    const auto *jvemote = root.if_contains("emote");
     if (jvemote != nullptr && !jvemote->is_null())
     {
-        const auto temote = boost::json::try_value_to<
+        auto temote = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Emote>(*jvemote);
 
         if (temote.has_error())
         {
             return temote.error();
         }
-        emote = temote.value();
+        emote = std::move(temote.value());
     }
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Mention>
         mention = std::nullopt;
-    const auto *jvmention = root.if_contains("mention");
     if (jvmention != nullptr && !jvmention->is_null())
     {
-        const auto tmention = boost::json::try_value_to<
+        auto tmention = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Mention>(
             *jvmention);
 
@@ -361,16 +869,95 @@ boost::json::result_for<MessageFragment, boost::json::value>::type tag_invoke(
         {
             return tmention.error();
         }
-        mention = tmention.value();
+        mention = std::move(tmention.value());
     }
 
     return MessageFragment{
-        .type = type.value(),
-        .text = text.value(),
-        .cheermote = cheermote,
-        .emote = emote,
-        .mention = mention,
+        .type = std::move(type.value()),
+        .text = std::move(text.value()),
+        .cheermote = std::move(cheermote),
+        .emote = std::move(emote),
+        .mention = std::move(mention),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<MessageFragment> /*tag*/)
+{
+    static const sax::ObjectSink<MessageFragment> sink{
+        [](MessageFragment &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    switch (key[1])
+                    {
+                        case 'y':
+                            if (key == "type")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.type);
+                            }
+                            break;
+                        case 'e':
+                            if (key == "text")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.text);
+                            }
+                            break;
+                    }
+                    break;
+                case 5:
+                    if (key == "emote")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.emote);
+                    }
+                    break;
+                case 7:
+                    if (key == "mention")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.mention);
+                    }
+                    break;
+                case 9:
+                    if (key == "cheermote")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.cheermote);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_type{"Missing required key type"};
+                return boost::system::error_code{129, error_missing_field_type};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_text{"Missing required key text"};
+                return boost::system::error_code{129, error_missing_field_text};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Subcription, boost::json::value>::type tag_invoke(
@@ -385,48 +972,87 @@ boost::json::result_for<Subcription, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubTier = root.if_contains("sub_tier");
-    if (jvsubTier == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubTier = nullptr;
+    const boost::json::value *jvisPrime = nullptr;
+    const boost::json::value *jvdurationMonths = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subTier{"Missing required key sub_tier"};
-        return boost::system::error_code{129, error_missing_field_subTier};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 8:
+                switch (key[0])
+                {
+                    case 's':
+                        if (key == "sub_tier")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvsubTier = &member.value();
+                        }
+                        break;
+                    case 'i':
+                        if (key == "is_prime")
+                        {
+                            seen |= std::uint64_t{1} << 1;
+                            jvisPrime = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 15:
+                if (key == "duration_months")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvdurationMonths = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
-
-    if (subTier.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return subTier.error();
+        if (jvsubTier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subTier{"Missing required key sub_tier"};
+            return boost::system::error_code{129, error_missing_field_subTier};
+        }
+
+        if (jvisPrime == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_isPrime{"Missing required key is_prime"};
+            return boost::system::error_code{129, error_missing_field_isPrime};
+        }
+
+        if (jvdurationMonths == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_durationMonths{
+                    "Missing required key duration_months"};
+            return boost::system::error_code{
+                129, error_missing_field_durationMonths};
+        }
     }
 
-    const auto *jvisPrime = root.if_contains("is_prime");
-    if (jvisPrime == nullptr)
+    auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
+
+    if (subTier.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_isPrime{"Missing required key is_prime"};
-        return boost::system::error_code{129, error_missing_field_isPrime};
+        return subTier.error();
     }
 
-    const auto isPrime = boost::json::try_value_to<bool>(*jvisPrime);
+    auto isPrime = boost::json::try_value_to<bool>(*jvisPrime);
 
     if (isPrime.has_error())
     {
         return isPrime.error();
     }
 
-    const auto *jvdurationMonths = root.if_contains("duration_months");
-    if (jvdurationMonths == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_durationMonths{
-                "Missing required key duration_months"};
-        return boost::system::error_code{129,
-                                         error_missing_field_durationMonths};
-    }
-
-    const auto durationMonths =
-        boost::json::try_value_to<int>(*jvdurationMonths);
+    auto durationMonths = boost::json::try_value_to<int>(*jvdurationMonths);
 
     if (durationMonths.has_error())
     {
@@ -434,10 +1060,88 @@ boost::json::result_for<Subcription, boost::json::value>::type tag_invoke(
     }
 
     return Subcription{
-        .subTier = subTier.value(),
-        .isPrime = isPrime.value(),
-        .durationMonths = durationMonths.value(),
+        .subTier = std::move(subTier.value()),
+        .isPrime = std::move(isPrime.value()),
+        .durationMonths = std::move(durationMonths.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Subcription> /*tag*/)
+{
+    static const sax::ObjectSink<Subcription> sink{
+        [](Subcription &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 8:
+                    switch (key[0])
+                    {
+                        case 's':
+                            if (key == "sub_tier")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.subTier);
+                            }
+                            break;
+                        case 'i':
+                            if (key == "is_prime")
+                            {
+                                seen |= std::uint64_t{1} << 1;
+                                return sax::slot(out.isPrime);
+                            }
+                            break;
+                    }
+                    break;
+                case 15:
+                    if (key == "duration_months")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.durationMonths);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subTier{
+                        "Missing required key sub_tier"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_subTier};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_isPrime{
+                        "Missing required key is_prime"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_isPrime};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_durationMonths{
+                        "Missing required key duration_months"};
+                return boost::system::error_code{
+                    129, error_missing_field_durationMonths};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Resubscription, boost::json::value>::type tag_invoke(
@@ -452,36 +1156,166 @@ boost::json::result_for<Resubscription, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvcumulativeMonths = root.if_contains("cumulative_months");
-    if (jvcumulativeMonths == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvcumulativeMonths = nullptr;
+    const boost::json::value *jvdurationMonths = nullptr;
+    const boost::json::value *jvstreakMonths = nullptr;
+    const boost::json::value *jvsubTier = nullptr;
+    const boost::json::value *jvisPrime = nullptr;
+    const boost::json::value *jvisGift = nullptr;
+    const boost::json::value *jvgifterIsAnonymous = nullptr;
+    const boost::json::value *jvgifterUserID = nullptr;
+    const boost::json::value *jvgifterUserName = nullptr;
+    const boost::json::value *jvgifterUserLogin = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 7:
+                if (key == "is_gift")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvisGift = &member.value();
+                }
+                break;
+            case 8:
+                switch (key[0])
+                {
+                    case 's':
+                        if (key == "sub_tier")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvsubTier = &member.value();
+                        }
+                        break;
+                    case 'i':
+                        if (key == "is_prime")
+                        {
+                            seen |= std::uint64_t{1} << 4;
+                            jvisPrime = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 13:
+                if (key == "streak_months")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvstreakMonths = &member.value();
+                }
+                break;
+            case 14:
+                if (key == "gifter_user_id")
+                {
+                    seen |= std::uint64_t{1} << 7;
+                    jvgifterUserID = &member.value();
+                }
+                break;
+            case 15:
+                if (key == "duration_months")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvdurationMonths = &member.value();
+                }
+                break;
+            case 16:
+                if (key == "gifter_user_name")
+                {
+                    seen |= std::uint64_t{1} << 8;
+                    jvgifterUserName = &member.value();
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "cumulative_months")
+                        {
+                            seen |= std::uint64_t{1} << 0;
+                            jvcumulativeMonths = &member.value();
+                        }
+                        break;
+                    case 'g':
+                        if (key == "gifter_user_login")
+                        {
+                            seen |= std::uint64_t{1} << 9;
+                            jvgifterUserLogin = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 19:
+                if (key == "gifter_is_anonymous")
+                {
+                    seen |= std::uint64_t{1} << 6;
+                    jvgifterIsAnonymous = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 123U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_cumulativeMonths{
-                "Missing required key cumulative_months"};
-        return boost::system::error_code{129,
-                                         error_missing_field_cumulativeMonths};
+        if (jvcumulativeMonths == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_cumulativeMonths{
+                    "Missing required key cumulative_months"};
+            return boost::system::error_code{
+                129, error_missing_field_cumulativeMonths};
+        }
+
+        if (jvdurationMonths == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_durationMonths{
+                    "Missing required key duration_months"};
+            return boost::system::error_code{
+                129, error_missing_field_durationMonths};
+        }
+
+        if (jvsubTier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subTier{"Missing required key sub_tier"};
+            return boost::system::error_code{129, error_missing_field_subTier};
+        }
+
+        if (jvisPrime == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_isPrime{"Missing required key is_prime"};
+            return boost::system::error_code{129, error_missing_field_isPrime};
+        }
+
+        if (jvisGift == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_isGift{"Missing required key is_gift"};
+            return boost::system::error_code{129, error_missing_field_isGift};
+        }
+
+        if (jvgifterIsAnonymous == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_gifterIsAnonymous{
+                    "Missing required key gifter_is_anonymous"};
+            return boost::system::error_code{
+                129, error_missing_field_gifterIsAnonymous};
+        }
     }
 
-    const auto cumulativeMonths =
-        boost::json::try_value_to<int>(*jvcumulativeMonths);
+    auto cumulativeMonths = boost::json::try_value_to<int>(*jvcumulativeMonths);
 
     if (cumulativeMonths.has_error())
     {
         return cumulativeMonths.error();
     }
 
-    const auto *jvdurationMonths = root.if_contains("duration_months");
-    if (jvdurationMonths == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_durationMonths{
-                "Missing required key duration_months"};
-        return boost::system::error_code{129,
-                                         error_missing_field_durationMonths};
-    }
-
-    const auto durationMonths =
-        boost::json::try_value_to<int>(*jvdurationMonths);
+    auto durationMonths = boost::json::try_value_to<int>(*jvdurationMonths);
 
     if (durationMonths.has_error())
     {
@@ -489,75 +1323,39 @@ boost::json::result_for<Resubscription, boost::json::value>::type tag_invoke(
     }
 
     std::optional<int> streakMonths = std::nullopt;
-    const auto *jvstreakMonths = root.if_contains("streak_months");
     if (jvstreakMonths != nullptr && !jvstreakMonths->is_null())
     {
-        const auto tstreakMonths =
-            boost::json::try_value_to<int>(*jvstreakMonths);
+        auto tstreakMonths = boost::json::try_value_to<int>(*jvstreakMonths);
 
         if (tstreakMonths.has_error())
         {
             return tstreakMonths.error();
         }
-        streakMonths = tstreakMonths.value();
+        streakMonths = std::move(tstreakMonths.value());
     }
 
-    const auto *jvsubTier = root.if_contains("sub_tier");
-    if (jvsubTier == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subTier{"Missing required key sub_tier"};
-        return boost::system::error_code{129, error_missing_field_subTier};
-    }
-
-    const auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
+    auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
 
     if (subTier.has_error())
     {
         return subTier.error();
     }
 
-    const auto *jvisPrime = root.if_contains("is_prime");
-    if (jvisPrime == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_isPrime{"Missing required key is_prime"};
-        return boost::system::error_code{129, error_missing_field_isPrime};
-    }
-
-    const auto isPrime = boost::json::try_value_to<bool>(*jvisPrime);
+    auto isPrime = boost::json::try_value_to<bool>(*jvisPrime);
 
     if (isPrime.has_error())
     {
         return isPrime.error();
     }
 
-    const auto *jvisGift = root.if_contains("is_gift");
-    if (jvisGift == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_isGift{
-            "Missing required key is_gift"};
-        return boost::system::error_code{129, error_missing_field_isGift};
-    }
-
-    const auto isGift = boost::json::try_value_to<bool>(*jvisGift);
+    auto isGift = boost::json::try_value_to<bool>(*jvisGift);
 
     if (isGift.has_error())
     {
         return isGift.error();
     }
 
-    const auto *jvgifterIsAnonymous = root.if_contains("gifter_is_anonymous");
-    if (jvgifterIsAnonymous == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_gifterIsAnonymous{
-                "Missing required key gifter_is_anonymous"};
-        return boost::system::error_code{129,
-                                         error_missing_field_gifterIsAnonymous};
-    }
-
-    const auto gifterIsAnonymous =
+    auto gifterIsAnonymous =
         boost::json::try_value_to<bool>(*jvgifterIsAnonymous);
 
     if (gifterIsAnonymous.has_error())
@@ -566,61 +1364,216 @@ boost::json::result_for<Resubscription, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::string> gifterUserID = std::nullopt;
-    const auto *jvgifterUserID = root.if_contains("gifter_user_id");
     if (jvgifterUserID != nullptr && !jvgifterUserID->is_null())
     {
-        const auto tgifterUserID =
+        auto tgifterUserID =
             boost::json::try_value_to<std::string>(*jvgifterUserID);
 
         if (tgifterUserID.has_error())
         {
             return tgifterUserID.error();
         }
-        gifterUserID = tgifterUserID.value();
+        gifterUserID = std::move(tgifterUserID.value());
     }
 
     std::optional<std::string> gifterUserName = std::nullopt;
-    const auto *jvgifterUserName = root.if_contains("gifter_user_name");
     if (jvgifterUserName != nullptr && !jvgifterUserName->is_null())
     {
-        const auto tgifterUserName =
+        auto tgifterUserName =
             boost::json::try_value_to<std::string>(*jvgifterUserName);
 
         if (tgifterUserName.has_error())
         {
             return tgifterUserName.error();
         }
-        gifterUserName = tgifterUserName.value();
+        gifterUserName = std::move(tgifterUserName.value());
     }
 
     std::optional<std::string> gifterUserLogin = std::nullopt;
-    const auto *jvgifterUserLogin = root.if_contains("gifter_user_login");
     if (jvgifterUserLogin != nullptr && !jvgifterUserLogin->is_null())
     {
-        const auto tgifterUserLogin =
+        auto tgifterUserLogin =
             boost::json::try_value_to<std::string>(*jvgifterUserLogin);
 
         if (tgifterUserLogin.has_error())
         {
             return tgifterUserLogin.error();
         }
-        gifterUserLogin = tgifterUserLogin.value();
+        gifterUserLogin = std::move(tgifterUserLogin.value());
     }
 
     return Resubscription{
-        .cumulativeMonths = cumulativeMonths.value(),
-        .durationMonths = durationMonths.value(),
-        .streakMonths = streakMonths,
-        .subTier = subTier.value(),
-        .isPrime = isPrime.value(),
-        .isGift = isGift.value(),
-        .gifterIsAnonymous = gifterIsAnonymous.value(),
-        .gifterUserID = gifterUserID,
-        .gifterUserName = gifterUserName,
-        .gifterUserLogin = gifterUserLogin,
+        .cumulativeMonths = std::move(cumulativeMonths.value()),
+        .durationMonths = std::move(durationMonths.value()),
+        .streakMonths = std::move(streakMonths),
+        .subTier = std::move(subTier.value()),
+        .isPrime = std::move(isPrime.value()),
+        .isGift = std::move(isGift.value()),
+        .gifterIsAnonymous = std::move(gifterIsAnonymous.value()),
+        .gifterUserID = std::move(gifterUserID),
+        .gifterUserName = std::move(gifterUserName),
+        .gifterUserLogin = std::move(gifterUserLogin),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Resubscription> /*tag*/)
+{
+    static const sax::ObjectSink<Resubscription> sink{
+        [](Resubscription &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 7:
+                    if (key == "is_gift")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.isGift);
+                    }
+                    break;
+                case 8:
+                    switch (key[0])
+                    {
+                        case 's':
+                            if (key == "sub_tier")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                return sax::slot(out.subTier);
+                            }
+                            break;
+                        case 'i':
+                            if (key == "is_prime")
+                            {
+                                seen |= std::uint64_t{1} << 4;
+                                return sax::slot(out.isPrime);
+                            }
+                            break;
+                    }
+                    break;
+                case 13:
+                    if (key == "streak_months")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.streakMonths);
+                    }
+                    break;
+                case 14:
+                    if (key == "gifter_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 7;
+                        return sax::slot(out.gifterUserID);
+                    }
+                    break;
+                case 15:
+                    if (key == "duration_months")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.durationMonths);
+                    }
+                    break;
+                case 16:
+                    if (key == "gifter_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 8;
+                        return sax::slot(out.gifterUserName);
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "cumulative_months")
+                            {
+                                seen |= std::uint64_t{1} << 0;
+                                return sax::slot(out.cumulativeMonths);
+                            }
+                            break;
+                        case 'g':
+                            if (key == "gifter_user_login")
+                            {
+                                seen |= std::uint64_t{1} << 9;
+                                return sax::slot(out.gifterUserLogin);
+                            }
+                            break;
+                    }
+                    break;
+                case 19:
+                    if (key == "gifter_is_anonymous")
+                    {
+                        seen |= std::uint64_t{1} << 6;
+                        return sax::slot(out.gifterIsAnonymous);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 123U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_cumulativeMonths{
+                        "Missing required key cumulative_months"};
+                return boost::system::error_code{
+                    129, error_missing_field_cumulativeMonths};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_durationMonths{
+                        "Missing required key duration_months"};
+                return boost::system::error_code{
+                    129, error_missing_field_durationMonths};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subTier{
+                        "Missing required key sub_tier"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_subTier};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_isPrime{
+                        "Missing required key is_prime"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_isPrime};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_isGift{"Missing required key is_gift"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_isGift};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_gifterIsAnonymous{
+                        "Missing required key gifter_is_anonymous"};
+                return boost::system::error_code{
+                    129, error_missing_field_gifterIsAnonymous};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<GiftSubscription>,
     const boost::json::value &jvRoot)
@@ -633,18 +1586,133 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvdurationMonths = root.if_contains("duration_months");
-    if (jvdurationMonths == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvdurationMonths = nullptr;
+    const boost::json::value *jvcumulativeTotal = nullptr;
+    const boost::json::value *jvstreakMonths = nullptr;
+    const boost::json::value *jvrecipientUserID = nullptr;
+    const boost::json::value *jvrecipientUserName = nullptr;
+    const boost::json::value *jvrecipientUserLogin = nullptr;
+    const boost::json::value *jvsubTier = nullptr;
+    const boost::json::value *jvcommunityGiftID = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_durationMonths{
-                "Missing required key duration_months"};
-        return boost::system::error_code{129,
-                                         error_missing_field_durationMonths};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 8:
+                if (key == "sub_tier")
+                {
+                    seen |= std::uint64_t{1} << 6;
+                    jvsubTier = &member.value();
+                }
+                break;
+            case 13:
+                if (key == "streak_months")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvstreakMonths = &member.value();
+                }
+                break;
+            case 15:
+                if (key == "duration_months")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvdurationMonths = &member.value();
+                }
+                break;
+            case 16:
+                if (key == "cumulative_total")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvcumulativeTotal = &member.value();
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'r':
+                        if (key == "recipient_user_id")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvrecipientUserID = &member.value();
+                        }
+                        break;
+                    case 'c':
+                        if (key == "community_gift_id")
+                        {
+                            seen |= std::uint64_t{1} << 7;
+                            jvcommunityGiftID = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 19:
+                if (key == "recipient_user_name")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvrecipientUserName = &member.value();
+                }
+                break;
+            case 20:
+                if (key == "recipient_user_login")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvrecipientUserLogin = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto durationMonths =
-        boost::json::try_value_to<int>(*jvdurationMonths);
+    constexpr std::uint64_t requiredMask = 121U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvdurationMonths == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_durationMonths{
+                    "Missing required key duration_months"};
+            return boost::system::error_code{
+                129, error_missing_field_durationMonths};
+        }
+
+        if (jvrecipientUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_recipientUserID{
+                    "Missing required key recipient_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_recipientUserID};
+        }
+
+        if (jvrecipientUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_recipientUserName{
+                    "Missing required key recipient_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_recipientUserName};
+        }
+
+        if (jvrecipientUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_recipientUserLogin{
+                    "Missing required key recipient_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_recipientUserLogin};
+        }
+
+        if (jvsubTier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subTier{"Missing required key sub_tier"};
+            return boost::system::error_code{129, error_missing_field_subTier};
+        }
+    }
+
+    auto durationMonths = boost::json::try_value_to<int>(*jvdurationMonths);
 
     if (durationMonths.has_error())
     {
@@ -652,44 +1720,31 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
     }
 
     std::optional<int> cumulativeTotal = std::nullopt;
-    const auto *jvcumulativeTotal = root.if_contains("cumulative_total");
     if (jvcumulativeTotal != nullptr && !jvcumulativeTotal->is_null())
     {
-        const auto tcumulativeTotal =
+        auto tcumulativeTotal =
             boost::json::try_value_to<int>(*jvcumulativeTotal);
 
         if (tcumulativeTotal.has_error())
         {
             return tcumulativeTotal.error();
         }
-        cumulativeTotal = tcumulativeTotal.value();
+        cumulativeTotal = std::move(tcumulativeTotal.value());
     }
 
     std::optional<int> streakMonths = std::nullopt;
-    const auto *jvstreakMonths = root.if_contains("streak_months");
     if (jvstreakMonths != nullptr && !jvstreakMonths->is_null())
     {
-        const auto tstreakMonths =
-            boost::json::try_value_to<int>(*jvstreakMonths);
+        auto tstreakMonths = boost::json::try_value_to<int>(*jvstreakMonths);
 
         if (tstreakMonths.has_error())
         {
             return tstreakMonths.error();
         }
-        streakMonths = tstreakMonths.value();
-    }
-
-    const auto *jvrecipientUserID = root.if_contains("recipient_user_id");
-    if (jvrecipientUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_recipientUserID{
-                "Missing required key recipient_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_recipientUserID};
+        streakMonths = std::move(tstreakMonths.value());
     }
 
-    const auto recipientUserID =
+    auto recipientUserID =
         boost::json::try_value_to<std::string>(*jvrecipientUserID);
 
     if (recipientUserID.has_error())
@@ -697,17 +1752,7 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
         return recipientUserID.error();
     }
 
-    const auto *jvrecipientUserName = root.if_contains("recipient_user_name");
-    if (jvrecipientUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_recipientUserName{
-                "Missing required key recipient_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_recipientUserName};
-    }
-
-    const auto recipientUserName =
+    auto recipientUserName =
         boost::json::try_value_to<std::string>(*jvrecipientUserName);
 
     if (recipientUserName.has_error())
@@ -715,17 +1760,7 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
         return recipientUserName.error();
     }
 
-    const auto *jvrecipientUserLogin = root.if_contains("recipient_user_login");
-    if (jvrecipientUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_recipientUserLogin{
-                "Missing required key recipient_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_recipientUserLogin};
-    }
-
-    const auto recipientUserLogin =
+    auto recipientUserLogin =
         boost::json::try_value_to<std::string>(*jvrecipientUserLogin);
 
     if (recipientUserLogin.has_error())
@@ -733,15 +1768,7 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
         return recipientUserLogin.error();
     }
 
-    const auto *jvsubTier = root.if_contains("sub_tier");
-    if (jvsubTier == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subTier{"Missing required key sub_tier"};
-        return boost::system::error_code{129, error_missing_field_subTier};
-    }
-
-    const auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
+    auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
 
     if (subTier.has_error())
     {
@@ -749,31 +1776,161 @@ boost::json::result_for<GiftSubscription, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::string> communityGiftID = std::nullopt;
-    const auto *jvcommunityGiftID = root.if_contains("community_gift_id");
     if (jvcommunityGiftID != nullptr && !jvcommunityGiftID->is_null())
     {
-        const auto tcommunityGiftID =
+        auto tcommunityGiftID =
             boost::json::try_value_to<std::string>(*jvcommunityGiftID);
 
         if (tcommunityGiftID.has_error())
         {
             return tcommunityGiftID.error();
         }
-        communityGiftID = tcommunityGiftID.value();
+        communityGiftID = std::move(tcommunityGiftID.value());
     }
 
     return GiftSubscription{
-        .durationMonths = durationMonths.value(),
-        .cumulativeTotal = cumulativeTotal,
-        .streakMonths = streakMonths,
-        .recipientUserID = recipientUserID.value(),
-        .recipientUserName = recipientUserName.value(),
-        .recipientUserLogin = recipientUserLogin.value(),
-        .subTier = subTier.value(),
-        .communityGiftID = communityGiftID,
+        .durationMonths = std::move(durationMonths.value()),
+        .cumulativeTotal = std::move(cumulativeTotal),
+        .streakMonths = std::move(streakMonths),
+        .recipientUserID = std::move(recipientUserID.value()),
+        .recipientUserName = std::move(recipientUserName.value()),
+        .recipientUserLogin = std::move(recipientUserLogin.value()),
+        .subTier = std::move(subTier.value()),
+        .communityGiftID = std::move(communityGiftID),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<GiftSubscription> /*tag*/)
+{
+    static const sax::ObjectSink<GiftSubscription> sink{
+        [](GiftSubscription &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 8:
+                    if (key == "sub_tier")
+                    {
+                        seen |= std::uint64_t{1} << 6;
+                        return sax::slot(out.subTier);
+                    }
+                    break;
+                case 13:
+                    if (key == "streak_months")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.streakMonths);
+                    }
+                    break;
+                case 15:
+                    if (key == "duration_months")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.durationMonths);
+                    }
+                    break;
+                case 16:
+                    if (key == "cumulative_total")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.cumulativeTotal);
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'r':
+                            if (key == "recipient_user_id")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                return sax::slot(out.recipientUserID);
+                            }
+                            break;
+                        case 'c':
+                            if (key == "community_gift_id")
+                            {
+                                seen |= std::uint64_t{1} << 7;
+                                return sax::slot(out.communityGiftID);
+                            }
+                            break;
+                    }
+                    break;
+                case 19:
+                    if (key == "recipient_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.recipientUserName);
+                    }
+                    break;
+                case 20:
+                    if (key == "recipient_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.recipientUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 121U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_durationMonths{
+                        "Missing required key duration_months"};
+                return boost::system::error_code{
+                    129, error_missing_field_durationMonths};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_recipientUserID{
+                        "Missing required key recipient_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_recipientUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_recipientUserName{
+                        "Missing required key recipient_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_recipientUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_recipientUserLogin{
+                        "Missing required key recipient_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_recipientUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subTier{
+                        "Missing required key sub_tier"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_subTier};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<CommunityGiftSubscription, boost::json::value>::type
     tag_invoke(boost::json::try_value_to_tag<CommunityGiftSubscription>,
                const boost::json::value &jvRoot)
@@ -786,45 +1943,88 @@ boost::json::result_for<CommunityGiftSubscription, boost::json::value>::type
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvtotal = nullptr;
+    const boost::json::value *jvsubTier = nullptr;
+    const boost::json::value *jvcumulativeTotal = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 5:
+                if (key == "total")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvtotal = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "sub_tier")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvsubTier = &member.value();
+                }
+                break;
+            case 16:
+                if (key == "cumulative_total")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvcumulativeTotal = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
-
-    if (id.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return id.error();
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvtotal == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_total{"Missing required key total"};
+            return boost::system::error_code{129, error_missing_field_total};
+        }
+
+        if (jvsubTier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subTier{"Missing required key sub_tier"};
+            return boost::system::error_code{129, error_missing_field_subTier};
+        }
     }
 
-    const auto *jvtotal = root.if_contains("total");
-    if (jvtotal == nullptr)
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_total{
-            "Missing required key total"};
-        return boost::system::error_code{129, error_missing_field_total};
+        return id.error();
     }
 
-    const auto total = boost::json::try_value_to<int>(*jvtotal);
+    auto total = boost::json::try_value_to<int>(*jvtotal);
 
     if (total.has_error())
     {
         return total.error();
     }
 
-    const auto *jvsubTier = root.if_contains("sub_tier");
-    if (jvsubTier == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subTier{"Missing required key sub_tier"};
-        return boost::system::error_code{129, error_missing_field_subTier};
-    }
-
-    const auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
+    auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
 
     if (subTier.has_error())
     {
@@ -832,27 +2032,103 @@ boost::json::result_for<CommunityGiftSubscription, boost::json::value>::type
     }
 
     std::optional<int> cumulativeTotal = std::nullopt;
-    const auto *jvcumulativeTotal = root.if_contains("cumulative_total");
     if (jvcumulativeTotal != nullptr && !jvcumulativeTotal->is_null())
     {
-        const auto tcumulativeTotal =
+        auto tcumulativeTotal =
             boost::json::try_value_to<int>(*jvcumulativeTotal);
 
         if (tcumulativeTotal.has_error())
         {
             return tcumulativeTotal.error();
         }
-        cumulativeTotal = tcumulativeTotal.value();
+        cumulativeTotal = std::move(tcumulativeTotal.value());
     }
 
     return CommunityGiftSubscription{
-        .id = id.value(),
-        .total = total.value(),
-        .subTier = subTier.value(),
-        .cumulativeTotal = cumulativeTotal,
+        .id = std::move(id.value()),
+        .total = std::move(total.value()),
+        .subTier = std::move(subTier.value()),
+        .cumulativeTotal = std::move(cumulativeTotal),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<CommunityGiftSubscription> /*tag*/)
+{
+    static const sax::ObjectSink<CommunityGiftSubscription> sink{
+        [](CommunityGiftSubscription &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 5:
+                    if (key == "total")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.total);
+                    }
+                    break;
+                case 8:
+                    if (key == "sub_tier")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.subTier);
+                    }
+                    break;
+                case 16:
+                    if (key == "cumulative_total")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.cumulativeTotal);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_total{"Missing required key total"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_total};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subTier{
+                        "Missing required key sub_tier"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_subTier};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<GiftPaidUpgrade, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<GiftPaidUpgrade>,
     const boost::json::value &jvRoot)
@@ -865,17 +2141,62 @@ boost::json::result_for<GiftPaidUpgrade, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvgifterIsAnonymous = root.if_contains("gifter_is_anonymous");
-    if (jvgifterIsAnonymous == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvgifterIsAnonymous = nullptr;
+    const boost::json::value *jvgifterUserID = nullptr;
+    const boost::json::value *jvgifterUserName = nullptr;
+    const boost::json::value *jvgifterUserLogin = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 14:
+                if (key == "gifter_user_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvgifterUserID = &member.value();
+                }
+                break;
+            case 16:
+                if (key == "gifter_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvgifterUserName = &member.value();
+                }
+                break;
+            case 17:
+                if (key == "gifter_user_login")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvgifterUserLogin = &member.value();
+                }
+                break;
+            case 19:
+                if (key == "gifter_is_anonymous")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvgifterIsAnonymous = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_gifterIsAnonymous{
-                "Missing required key gifter_is_anonymous"};
-        return boost::system::error_code{129,
-                                         error_missing_field_gifterIsAnonymous};
+        if (jvgifterIsAnonymous == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_gifterIsAnonymous{
+                    "Missing required key gifter_is_anonymous"};
+            return boost::system::error_code{
+                129, error_missing_field_gifterIsAnonymous};
+        }
     }
 
-    const auto gifterIsAnonymous =
+    auto gifterIsAnonymous =
         boost::json::try_value_to<bool>(*jvgifterIsAnonymous);
 
     if (gifterIsAnonymous.has_error())
@@ -884,55 +2205,114 @@ boost::json::result_for<GiftPaidUpgrade, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::string> gifterUserID = std::nullopt;
-    const auto *jvgifterUserID = root.if_contains("gifter_user_id");
     if (jvgifterUserID != nullptr && !jvgifterUserID->is_null())
     {
-        const auto tgifterUserID =
+        auto tgifterUserID =
             boost::json::try_value_to<std::string>(*jvgifterUserID);
 
         if (tgifterUserID.has_error())
         {
             return tgifterUserID.error();
         }
-        gifterUserID = tgifterUserID.value();
+        gifterUserID = std::move(tgifterUserID.value());
     }
 
     std::optional<std::string> gifterUserName = std::nullopt;
-    const auto *jvgifterUserName = root.if_contains("gifter_user_name");
     if (jvgifterUserName != nullptr && !jvgifterUserName->is_null())
     {
-        const auto tgifterUserName =
+        auto tgifterUserName =
             boost::json::try_value_to<std::string>(*jvgifterUserName);
 
         if (tgifterUserName.has_error())
         {
             return tgifterUserName.error();
         }
-        gifterUserName = tgifterUserName.value();
+        gifterUserName = std::move(tgifterUserName.value());
     }
 
     std::optional<std::string> gifterUserLogin = std::nullopt;
-    const auto *jvgifterUserLogin = root.if_contains("gifter_user_login");
     if (jvgifterUserLogin != nullptr && !jvgifterUserLogin->is_null())
     {
-        const auto tgifterUserLogin =
+        auto tgifterUserLogin =
             boost::json::try_value_to<std::string>(*jvgifterUserLogin);
 
         if (tgifterUserLogin.has_error())
         {
             return tgifterUserLogin.error();
         }
-        gifterUserLogin = tgifterUserLogin.value();
+        gifterUserLogin = std::move(tgifterUserLogin.value());
     }
 
     return GiftPaidUpgrade{
-        .gifterIsAnonymous = gifterIsAnonymous.value(),
-        .gifterUserID = gifterUserID,
-        .gifterUserName = gifterUserName,
-        .gifterUserLogin = gifterUserLogin,
+        .gifterIsAnonymous = std::move(gifterIsAnonymous.value()),
+        .gifterUserID = std::move(gifterUserID),
+        .gifterUserName = std::move(gifterUserName),
+        .gifterUserLogin = std::move(gifterUserLogin),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<GiftPaidUpgrade> /*tag*/)
+{
+    static const sax::ObjectSink<GiftPaidUpgrade> sink{
+        [](GiftPaidUpgrade &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 14:
+                    if (key == "gifter_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.gifterUserID);
+                    }
+                    break;
+                case 16:
+                    if (key == "gifter_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.gifterUserName);
+                    }
+                    break;
+                case 17:
+                    if (key == "gifter_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.gifterUserLogin);
+                    }
+                    break;
+                case 19:
+                    if (key == "gifter_is_anonymous")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.gifterIsAnonymous);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_gifterIsAnonymous{
+                        "Missing required key gifter_is_anonymous"};
+                return boost::system::error_code{
+                    129, error_missing_field_gifterIsAnonymous};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<PrimePaidUpgrade, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<PrimePaidUpgrade>,
     const boost::json::value &jvRoot)
@@ -945,24 +2325,86 @@ boost::json::result_for<PrimePaidUpgrade, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubTier = root.if_contains("sub_tier");
-    if (jvsubTier == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubTier = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subTier{"Missing required key sub_tier"};
-        return boost::system::error_code{129, error_missing_field_subTier};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 8:
+                if (key == "sub_tier")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubTier = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvsubTier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subTier{"Missing required key sub_tier"};
+            return boost::system::error_code{129, error_missing_field_subTier};
+        }
+    }
+
+    auto subTier = boost::json::try_value_to<std::string>(*jvsubTier);
 
     if (subTier.has_error())
     {
         return subTier.error();
     }
 
-    return PrimePaidUpgrade{
-        .subTier = subTier.value(),
+    return PrimePaidUpgrade{
+        .subTier = std::move(subTier.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<PrimePaidUpgrade> /*tag*/)
+{
+    static const sax::ObjectSink<PrimePaidUpgrade> sink{
+        [](PrimePaidUpgrade &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 8:
+                    if (key == "sub_tier")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subTier);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subTier{
+                        "Missing required key sub_tier"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_subTier};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Raid, boost::json::value>::type tag_invoke(
@@ -976,78 +2418,130 @@ boost::json::result_for<Raid, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvuserID = root.if_contains("user_id");
-    if (jvuserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvuserID = nullptr;
+    const boost::json::value *jvuserName = nullptr;
+    const boost::json::value *jvuserLogin = nullptr;
+    const boost::json::value *jvviewerCount = nullptr;
+    const boost::json::value *jvprofileImageURL = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_userID{
-            "Missing required key user_id"};
-        return boost::system::error_code{129, error_missing_field_userID};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 7:
+                if (key == "user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvuserID = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "user_name")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvuserName = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "user_login")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvuserLogin = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "viewer_count")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvviewerCount = &member.value();
+                }
+                break;
+            case 17:
+                if (key == "profile_image_url")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvprofileImageURL = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto userID = boost::json::try_value_to<std::string>(*jvuserID);
-
-    if (userID.has_error())
+    constexpr std::uint64_t requiredMask = 31U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return userID.error();
+        if (jvuserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userID{"Missing required key user_id"};
+            return boost::system::error_code{129, error_missing_field_userID};
+        }
+
+        if (jvuserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userName{"Missing required key user_name"};
+            return boost::system::error_code{129, error_missing_field_userName};
+        }
+
+        if (jvuserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_userLogin{
+                    "Missing required key user_login"};
+            return boost::system::error_code{129,
+                                             error_missing_field_userLogin};
+        }
+
+        if (jvviewerCount == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_viewerCount{
+                    "Missing required key viewer_count"};
+            return boost::system::error_code{129,
+                                             error_missing_field_viewerCount};
+        }
+
+        if (jvprofileImageURL == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_profileImageURL{
+                    "Missing required key profile_image_url"};
+            return boost::system::error_code{
+                129, error_missing_field_profileImageURL};
+        }
     }
 
-    const auto *jvuserName = root.if_contains("user_name");
-    if (jvuserName == nullptr)
+    auto userID = boost::json::try_value_to<std::string>(*jvuserID);
+
+    if (userID.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userName{"Missing required key user_name"};
-        return boost::system::error_code{129, error_missing_field_userName};
+        return userID.error();
     }
 
-    const auto userName = boost::json::try_value_to<std::string>(*jvuserName);
+    auto userName = boost::json::try_value_to<std::string>(*jvuserName);
 
     if (userName.has_error())
     {
         return userName.error();
     }
 
-    const auto *jvuserLogin = root.if_contains("user_login");
-    if (jvuserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_userLogin{"Missing required key user_login"};
-        return boost::system::error_code{129, error_missing_field_userLogin};
-    }
-
-    const auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
+    auto userLogin = boost::json::try_value_to<std::string>(*jvuserLogin);
 
     if (userLogin.has_error())
     {
         return userLogin.error();
     }
 
-    const auto *jvviewerCount = root.if_contains("viewer_count");
-    if (jvviewerCount == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_viewerCount{
-                "Missing required key viewer_count"};
-        return boost::system::error_code{129, error_missing_field_viewerCount};
-    }
-
-    const auto viewerCount = boost::json::try_value_to<int>(*jvviewerCount);
+    auto viewerCount = boost::json::try_value_to<int>(*jvviewerCount);
 
     if (viewerCount.has_error())
     {
         return viewerCount.error();
     }
 
-    const auto *jvprofileImageURL = root.if_contains("profile_image_url");
-    if (jvprofileImageURL == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_profileImageURL{
-                "Missing required key profile_image_url"};
-        return boost::system::error_code{129,
-                                         error_missing_field_profileImageURL};
-    }
-
-    const auto profileImageURL =
+    auto profileImageURL =
         boost::json::try_value_to<std::string>(*jvprofileImageURL);
 
     if (profileImageURL.has_error())
@@ -1056,12 +2550,115 @@ boost::json::result_for<Raid, boost::json::value>::type tag_invoke(
     }
 
     return Raid{
-        .userID = userID.value(),
-        .userName = userName.value(),
-        .userLogin = userLogin.value(),
-        .viewerCount = viewerCount.value(),
-        .profileImageURL = profileImageURL.value(),
+        .userID = std::move(userID.value()),
+        .userName = std::move(userName.value()),
+        .userLogin = std::move(userLogin.value()),
+        .viewerCount = std::move(viewerCount.value()),
+        .profileImageURL = std::move(profileImageURL.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Raid> /*tag*/)
+{
+    static const sax::ObjectSink<Raid> sink{
+        [](Raid &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 7:
+                    if (key == "user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.userID);
+                    }
+                    break;
+                case 9:
+                    if (key == "user_name")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.userName);
+                    }
+                    break;
+                case 10:
+                    if (key == "user_login")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.userLogin);
+                    }
+                    break;
+                case 12:
+                    if (key == "viewer_count")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.viewerCount);
+                    }
+                    break;
+                case 17:
+                    if (key == "profile_image_url")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.profileImageURL);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 31U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userID{"Missing required key user_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userName{
+                        "Missing required key user_name"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_userLogin{
+                        "Missing required key user_login"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_userLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_viewerCount{
+                        "Missing required key viewer_count"};
+                return boost::system::error_code{
+                    129, error_missing_field_viewerCount};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_profileImageURL{
+                        "Missing required key profile_image_url"};
+                return boost::system::error_code{
+                    129, error_missing_field_profileImageURL};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Unraid, boost::json::value>::type tag_invoke(
@@ -1075,9 +2672,49 @@ boost::json::result_for<Unraid, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
+    std::uint64_t seen = 0;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 0U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+    }
+
     return Unraid{};
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Unraid> /*tag*/)
+{
+    static const sax::ObjectSink<Unraid> sink{
+        [](Unraid &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 0U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<PayItForward, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<PayItForward>,
     const boost::json::value &jvRoot)
@@ -1090,17 +2727,62 @@ boost::json::result_for<PayItForward, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvgifterIsAnonymous = root.if_contains("gifter_is_anonymous");
-    if (jvgifterIsAnonymous == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvgifterIsAnonymous = nullptr;
+    const boost::json::value *jvgifterUserID = nullptr;
+    const boost::json::value *jvgifterUserName = nullptr;
+    const boost::json::value *jvgifterUserLogin = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 14:
+                if (key == "gifter_user_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvgifterUserID = &member.value();
+                }
+                break;
+            case 16:
+                if (key == "gifter_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvgifterUserName = &member.value();
+                }
+                break;
+            case 17:
+                if (key == "gifter_user_login")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvgifterUserLogin = &member.value();
+                }
+                break;
+            case 19:
+                if (key == "gifter_is_anonymous")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvgifterIsAnonymous = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_gifterIsAnonymous{
-                "Missing required key gifter_is_anonymous"};
-        return boost::system::error_code{129,
-                                         error_missing_field_gifterIsAnonymous};
+        if (jvgifterIsAnonymous == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_gifterIsAnonymous{
+                    "Missing required key gifter_is_anonymous"};
+            return boost::system::error_code{
+                129, error_missing_field_gifterIsAnonymous};
+        }
     }
 
-    const auto gifterIsAnonymous =
+    auto gifterIsAnonymous =
         boost::json::try_value_to<bool>(*jvgifterIsAnonymous);
 
     if (gifterIsAnonymous.has_error())
@@ -1109,53 +2791,112 @@ boost::json::result_for<PayItForward, boost::json::value>::type tag_invoke(
     }
 
     std::optional<std::string> gifterUserID = std::nullopt;
-    const auto *jvgifterUserID = root.if_contains("gifter_user_id");
     if (jvgifterUserID != nullptr && !jvgifterUserID->is_null())
     {
-        const auto tgifterUserID =
+        auto tgifterUserID =
             boost::json::try_value_to<std::string>(*jvgifterUserID);
 
         if (tgifterUserID.has_error())
         {
             return tgifterUserID.error();
         }
-        gifterUserID = tgifterUserID.value();
+        gifterUserID = std::move(tgifterUserID.value());
     }
 
     std::optional<std::string> gifterUserName = std::nullopt;
-    const auto *jvgifterUserName = root.if_contains("gifter_user_name");
     if (jvgifterUserName != nullptr && !jvgifterUserName->is_null())
     {
-        const auto tgifterUserName =
+        auto tgifterUserName =
             boost::json::try_value_to<std::string>(*jvgifterUserName);
 
         if (tgifterUserName.has_error())
         {
             return tgifterUserName.error();
         }
-        gifterUserName = tgifterUserName.value();
+        gifterUserName = std::move(tgifterUserName.value());
     }
 
     std::optional<std::string> gifterUserLogin = std::nullopt;
-    const auto *jvgifterUserLogin = root.if_contains("gifter_user_login");
     if (jvgifterUserLogin != nullptr && !jvgifterUserLogin->is_null())
     {
-        const auto tgifterUserLogin =
+        auto tgifterUserLogin =
             boost::json::try_value_to<std::string>(*jvgifterUserLogin);
 
         if (tgifterUserLogin.has_error())
         {
             return tgifterUserLogin.error();
         }
-        gifterUserLogin = tgifterUserLogin.value();
+        gifterUserLogin = std::move(tgifterUserLogin.value());
     }
 
     return PayItForward{
-        .gifterIsAnonymous = gifterIsAnonymous.value(),
-        .gifterUserID = gifterUserID,
-        .gifterUserName = gifterUserName,
-        .gifterUserLogin = gifterUserLogin,
+        .gifterIsAnonymous = std::move(gifterIsAnonymous.value()),
+        .gifterUserID = std::move(gifterUserID),
+        .gifterUserName = std::move(gifterUserName),
+        .gifterUserLogin = std::move(gifterUserLogin),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<PayItForward> /*tag*/)
+{
+    static const sax::ObjectSink<PayItForward> sink{
+        [](PayItForward &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 14:
+                    if (key == "gifter_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.gifterUserID);
+                    }
+                    break;
+                case 16:
+                    if (key == "gifter_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.gifterUserName);
+                    }
+                    break;
+                case 17:
+                    if (key == "gifter_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.gifterUserLogin);
+                    }
+                    break;
+                case 19:
+                    if (key == "gifter_is_anonymous")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.gifterIsAnonymous);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_gifterIsAnonymous{
+                        "Missing required key gifter_is_anonymous"};
+                return boost::system::error_code{
+                    129, error_missing_field_gifterIsAnonymous};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Announcement, boost::json::value>::type tag_invoke(
@@ -1170,15 +2911,36 @@ boost::json::result_for<Announcement, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvcolor = root.if_contains("color");
-    if (jvcolor == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvcolor = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "color")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvcolor = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory error_missing_field_color{
-            "Missing required key color"};
-        return boost::system::error_code{129, error_missing_field_color};
+        if (jvcolor == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_color{"Missing required key color"};
+            return boost::system::error_code{129, error_missing_field_color};
+        }
     }
 
-    const auto color = boost::json::try_value_to<std::string>(*jvcolor);
+    auto color = boost::json::try_value_to<std::string>(*jvcolor);
 
     if (color.has_error())
     {
@@ -1186,8 +2948,48 @@ boost::json::result_for<Announcement, boost::json::value>::type tag_invoke(
     }
 
     return Announcement{
-        .color = color.value(),
+        .color = std::move(color.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Announcement> /*tag*/)
+{
+    static const sax::ObjectSink<Announcement> sink{
+        [](Announcement &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "color")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.color);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_color{"Missing required key color"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_color};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<CharityDonationAmount, boost::json::value>::type
@@ -1202,47 +3004,82 @@ boost::json::result_for<CharityDonationAmount, boost::json::value>::type
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvvalue = root.if_contains("value");
-    if (jvvalue == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvvalue = nullptr;
+    const boost::json::value *jvdecimalPlaces = nullptr;
+    const boost::json::value *jvcurrency = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_value{
-            "Missing required key value"};
-        return boost::system::error_code{129, error_missing_field_value};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "value")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvvalue = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "currency")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvcurrency = &member.value();
+                }
+                break;
+            case 14:
+                if (key == "decimal_places")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvdecimalPlaces = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto value = boost::json::try_value_to<int>(*jvvalue);
-
-    if (value.has_error())
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return value.error();
+        if (jvvalue == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_value{"Missing required key value"};
+            return boost::system::error_code{129, error_missing_field_value};
+        }
+
+        if (jvdecimalPlaces == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_decimalPlaces{
+                    "Missing required key decimal_places"};
+            return boost::system::error_code{129,
+                                             error_missing_field_decimalPlaces};
+        }
+
+        if (jvcurrency == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_currency{"Missing required key currency"};
+            return boost::system::error_code{129, error_missing_field_currency};
+        }
     }
 
-    const auto *jvdecimalPlaces = root.if_contains("decimal_places");
-    if (jvdecimalPlaces == nullptr)
+    auto value = boost::json::try_value_to<int>(*jvvalue);
+
+    if (value.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_decimalPlaces{
-                "Missing required key decimal_places"};
-        return boost::system::error_code{129,
-                                         error_missing_field_decimalPlaces};
+        return value.error();
     }
 
-    const auto decimalPlaces = boost::json::try_value_to<int>(*jvdecimalPlaces);
+    auto decimalPlaces = boost::json::try_value_to<int>(*jvdecimalPlaces);
 
     if (decimalPlaces.has_error())
     {
         return decimalPlaces.error();
     }
 
-    const auto *jvcurrency = root.if_contains("currency");
-    if (jvcurrency == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_currency{"Missing required key currency"};
-        return boost::system::error_code{129, error_missing_field_currency};
-    }
-
-    const auto currency = boost::json::try_value_to<std::string>(*jvcurrency);
+    auto currency = boost::json::try_value_to<std::string>(*jvcurrency);
 
     if (currency.has_error())
     {
@@ -1250,10 +3087,82 @@ boost::json::result_for<CharityDonationAmount, boost::json::value>::type
     }
 
     return CharityDonationAmount{
-        .value = value.value(),
-        .decimalPlaces = decimalPlaces.value(),
-        .currency = currency.value(),
+        .value = std::move(value.value()),
+        .decimalPlaces = std::move(decimalPlaces.value()),
+        .currency = std::move(currency.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<CharityDonationAmount> /*tag*/)
+{
+    static const sax::ObjectSink<CharityDonationAmount> sink{
+        [](CharityDonationAmount &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "value")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.value);
+                    }
+                    break;
+                case 8:
+                    if (key == "currency")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.currency);
+                    }
+                    break;
+                case 14:
+                    if (key == "decimal_places")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.decimalPlaces);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_value{"Missing required key value"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_value};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_decimalPlaces{
+                        "Missing required key decimal_places"};
+                return boost::system::error_code{
+                    129, error_missing_field_decimalPlaces};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_currency{
+                        "Missing required key currency"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_currency};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<CharityDonation, boost::json::value>::type tag_invoke(
@@ -1268,33 +3177,60 @@ boost::json::result_for<CharityDonation, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvcharityName = root.if_contains("charity_name");
-    if (jvcharityName == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvcharityName = nullptr;
+    const boost::json::value *jvamount = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_charityName{
-                "Missing required key charity_name"};
-        return boost::system::error_code{129, error_missing_field_charityName};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 6:
+                if (key == "amount")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvamount = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "charity_name")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvcharityName = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto charityName =
-        boost::json::try_value_to<std::string>(*jvcharityName);
-
-    if (charityName.has_error())
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return charityName.error();
+        if (jvcharityName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_charityName{
+                    "Missing required key charity_name"};
+            return boost::system::error_code{129,
+                                             error_missing_field_charityName};
+        }
+
+        if (jvamount == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_amount{"Missing required key amount"};
+            return boost::system::error_code{129, error_missing_field_amount};
+        }
     }
 
-    const auto *jvamount = root.if_contains("amount");
-    if (jvamount == nullptr)
+    auto charityName = boost::json::try_value_to<std::string>(*jvcharityName);
+
+    if (charityName.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_amount{
-            "Missing required key amount"};
-        return boost::system::error_code{129, error_missing_field_amount};
+        return charityName.error();
     }
 
-    const auto amount =
-        boost::json::try_value_to<CharityDonationAmount>(*jvamount);
+    auto amount = boost::json::try_value_to<CharityDonationAmount>(*jvamount);
 
     if (amount.has_error())
     {
@@ -1302,9 +3238,65 @@ boost::json::result_for<CharityDonation, boost::json::value>::type tag_invoke(
     }
 
     return CharityDonation{
-        .charityName = charityName.value(),
-        .amount = amount.value(),
+        .charityName = std::move(charityName.value()),
+        .amount = std::move(amount.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<CharityDonation> /*tag*/)
+{
+    static const sax::ObjectSink<CharityDonation> sink{
+        [](CharityDonation &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 6:
+                    if (key == "amount")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.amount);
+                    }
+                    break;
+                case 12:
+                    if (key == "charity_name")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.charityName);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_charityName{
+                        "Missing required key charity_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_charityName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_amount{"Missing required key amount"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_amount};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<BitsBadgeTier, boost::json::value>::type tag_invoke(
@@ -1319,15 +3311,36 @@ boost::json::result_for<BitsBadgeTier, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvtier = root.if_contains("tier");
-    if (jvtier == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvtier = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                if (key == "tier")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvtier = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory error_missing_field_tier{
-            "Missing required key tier"};
-        return boost::system::error_code{129, error_missing_field_tier};
+        if (jvtier == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_tier{"Missing required key tier"};
+            return boost::system::error_code{129, error_missing_field_tier};
+        }
     }
 
-    const auto tier = boost::json::try_value_to<int>(*jvtier);
+    auto tier = boost::json::try_value_to<int>(*jvtier);
 
     if (tier.has_error())
     {
@@ -1335,8 +3348,47 @@ boost::json::result_for<BitsBadgeTier, boost::json::value>::type tag_invoke(
     }
 
     return BitsBadgeTier{
-        .tier = tier.value(),
+        .tier = std::move(tier.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<BitsBadgeTier> /*tag*/)
+{
+    static const sax::ObjectSink<BitsBadgeTier> sink{
+        [](BitsBadgeTier &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    if (key == "tier")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.tier);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_tier{"Missing required key tier"};
+                return boost::system::error_code{129, error_missing_field_tier};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Message, boost::json::value>::type tag_invoke(
@@ -1350,29 +3402,59 @@ boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvtext = root.if_contains("text");
-    if (jvtext == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvtext = nullptr;
+    const boost::json::value *jvfragments = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 4:
+                if (key == "text")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvtext = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "fragments")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvfragments = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory error_missing_field_text{
-            "Missing required key text"};
-        return boost::system::error_code{129, error_missing_field_text};
+        if (jvtext == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_text{"Missing required key text"};
+            return boost::system::error_code{129, error_missing_field_text};
+        }
+
+        if (jvfragments == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_fragments{"Missing required key fragments"};
+            return boost::system::error_code{129,
+                                             error_missing_field_fragments};
+        }
     }
 
-    const auto text = boost::json::try_value_to<std::string>(*jvtext);
+    auto text = boost::json::try_value_to<std::string>(*jvtext);
 
     if (text.has_error())
     {
         return text.error();
     }
 
-    const auto *jvfragments = root.if_contains("fragments");
-    if (jvfragments == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_fragments{"Missing required key fragments"};
-        return boost::system::error_code{129, error_missing_field_fragments};
-    }
-    const auto fragments = boost::json::try_value_to<std::vector<
+    auto fragments = boost::json::try_value_to<std::vector<
         eventsub::payload::channel_chat_notification::v1::MessageFragment>>(
         *jvfragments);
     if (fragments.has_error())
@@ -1381,9 +3463,64 @@ boost::json::result_for<Message, boost::json::value>::type tag_invoke(
     }
 
     return Message{
-        .text = text.value(),
-        .fragments = fragments.value(),
+        .text = std::move(text.value()),
+        .fragments = std::move(fragments.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Message> /*tag*/)
+{
+    static const sax::ObjectSink<Message> sink{
+        [](Message &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 4:
+                    if (key == "text")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.text);
+                    }
+                    break;
+                case 9:
+                    if (key == "fragments")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.fragments);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_text{"Missing required key text"};
+                return boost::system::error_code{129, error_missing_field_text};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_fragments{
+                        "Missing required key fragments"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_fragments};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
@@ -1397,17 +3534,360 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+    const boost::json::value *jvchatterUserID = nullptr;
+    const boost::json::value *jvchatterUserLogin = nullptr;
+    const boost::json::value *jvchatterUserName = nullptr;
+    const boost::json::value *jvchatterIsAnonymous = nullptr;
+    const boost::json::value *jvcolor = nullptr;
+    const boost::json::value *jvbadges = nullptr;
+    const boost::json::value *jvsystemMessage = nullptr;
+    const boost::json::value *jvmessageID = nullptr;
+    const boost::json::value *jvmessage = nullptr;
+    const boost::json::value *jvnoticeType = nullptr;
+    const boost::json::value *jvsub = nullptr;
+    const boost::json::value *jvresub = nullptr;
+    const boost::json::value *jvsubGift = nullptr;
+    const boost::json::value *jvcommunitySubGift = nullptr;
+    const boost::json::value *jvgiftPaidUpgrade = nullptr;
+    const boost::json::value *jvprimePaidUpgrade = nullptr;
+    const boost::json::value *jvraid = nullptr;
+    const boost::json::value *jvunraid = nullptr;
+    const boost::json::value *jvpayItForward = nullptr;
+    const boost::json::value *jvannouncement = nullptr;
+    const boost::json::value *jvcharityDonation = nullptr;
+    const boost::json::value *jvbitsBadgeTier = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 3:
+                if (key == "sub")
+                {
+                    seen |= std::uint64_t{1} << 13;
+                    jvsub = &member.value();
+                }
+                break;
+            case 4:
+                if (key == "raid")
+                {
+                    seen |= std::uint64_t{1} << 19;
+                    jvraid = &member.value();
+                }
+                break;
+            case 5:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "color")
+                        {
+                            seen |= std::uint64_t{1} << 7;
+                            jvcolor = &member.value();
+                        }
+                        break;
+                    case 'r':
+                        if (key == "resub")
+                        {
+                            seen |= std::uint64_t{1} << 14;
+                            jvresub = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 6:
+                switch (key[0])
+                {
+                    case 'b':
+                        if (key == "badges")
+                        {
+                            seen |= std::uint64_t{1} << 8;
+                            jvbadges = &member.value();
+                        }
+                        break;
+                    case 'u':
+                        if (key == "unraid")
+                        {
+                            seen |= std::uint64_t{1} << 20;
+                            jvunraid = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 7:
+                if (key == "message")
+                {
+                    seen |= std::uint64_t{1} << 11;
+                    jvmessage = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "sub_gift")
+                {
+                    seen |= std::uint64_t{1} << 15;
+                    jvsubGift = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "message_id")
+                {
+                    seen |= std::uint64_t{1} << 10;
+                    jvmessageID = &member.value();
+                }
+                break;
+            case 11:
+                if (key == "notice_type")
+                {
+                    seen |= std::uint64_t{1} << 12;
+                    jvnoticeType = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "announcement")
+                {
+                    seen |= std::uint64_t{1} << 22;
+                    jvannouncement = &member.value();
+                }
+                break;
+            case 14:
+                switch (key[0])
+                {
+                    case 's':
+                        if (key == "system_message")
+                        {
+                            seen |= std::uint64_t{1} << 9;
+                            jvsystemMessage = &member.value();
+                        }
+                        break;
+                    case 'p':
+                        if (key == "pay_it_forward")
+                        {
+                            seen |= std::uint64_t{1} << 21;
+                            jvpayItForward = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 15:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "chatter_user_id")
+                        {
+                            seen |= std::uint64_t{1} << 3;
+                            jvchatterUserID = &member.value();
+                        }
+                        break;
+                    case 'b':
+                        if (key == "bits_badge_tier")
+                        {
+                            seen |= std::uint64_t{1} << 24;
+                            jvbitsBadgeTier = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 16:
+                if (key == "charity_donation")
+                {
+                    seen |= std::uint64_t{1} << 23;
+                    jvcharityDonation = &member.value();
+                }
+                break;
+            case 17:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "chatter_user_name")
+                        {
+                            seen |= std::uint64_t{1} << 5;
+                            jvchatterUserName = &member.value();
+                        }
+                        break;
+                    case 'g':
+                        if (key == "gift_paid_upgrade")
+                        {
+                            seen |= std::uint64_t{1} << 17;
+                            jvgiftPaidUpgrade = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 18:
+                switch (key[0])
+                {
+                    case 'c':
+                        if (key == "chatter_user_login")
+                        {
+                            seen |= std::uint64_t{1} << 4;
+                            jvchatterUserLogin = &member.value();
+                        }
+                        if (key == "community_sub_gift")
+                        {
+                            seen |= std::uint64_t{1} << 16;
+                            jvcommunitySubGift = &member.value();
+                        }
+                        break;
+                    case 'p':
+                        if (key == "prime_paid_upgrade")
+                        {
+                            seen |= std::uint64_t{1} << 18;
+                            jvprimePaidUpgrade = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 19:
+                if (key == "broadcaster_user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvbroadcasterUserID = &member.value();
+                }
+                break;
+            case 20:
+                if (key == "chatter_is_anonymous")
+                {
+                    seen |= std::uint64_t{1} << 6;
+                    jvchatterIsAnonymous = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 8191U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
+
+        if (jvchatterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserID{
+                    "Missing required key chatter_user_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_chatterUserID};
+        }
+
+        if (jvchatterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserLogin{
+                    "Missing required key chatter_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_chatterUserLogin};
+        }
+
+        if (jvchatterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterUserName{
+                    "Missing required key chatter_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_chatterUserName};
+        }
+
+        if (jvchatterIsAnonymous == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_chatterIsAnonymous{
+                    "Missing required key chatter_is_anonymous"};
+            return boost::system::error_code{
+                129, error_missing_field_chatterIsAnonymous};
+        }
+
+        if (jvcolor == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_color{"Missing required key color"};
+            return boost::system::error_code{129, error_missing_field_color};
+        }
+
+        if (jvbadges == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_badges{"Missing required key badges"};
+            return boost::system::error_code{129, error_missing_field_badges};
+        }
+
+        if (jvsystemMessage == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_systemMessage{
+                    "Missing required key system_message"};
+            return boost::system::error_code{129,
+                                             error_missing_field_systemMessage};
+        }
+
+        if (jvmessageID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_messageID{
+                    "Missing required key message_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_messageID};
+        }
+
+        if (jvmessage == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_message{"Missing required key message"};
+            return boost::system::error_code{129, error_missing_field_message};
+        }
+
+        if (jvnoticeType == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_noticeType{
+                    "Missing required key notice_type"};
+            return boost::system::error_code{129,
+                                             error_missing_field_noticeType};
+        }
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -1415,18 +3895,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -1434,18 +3903,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -1453,17 +3911,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserName.error();
     }
 
-    const auto *jvchatterUserID = root.if_contains("chatter_user_id");
-    if (jvchatterUserID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserID{
-                "Missing required key chatter_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserID};
-    }
-
-    const auto chatterUserID =
+    auto chatterUserID =
         boost::json::try_value_to<std::string>(*jvchatterUserID);
 
     if (chatterUserID.has_error())
@@ -1471,17 +3919,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserID.error();
     }
 
-    const auto *jvchatterUserLogin = root.if_contains("chatter_user_login");
-    if (jvchatterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserLogin{
-                "Missing required key chatter_user_login"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserLogin};
-    }
-
-    const auto chatterUserLogin =
+    auto chatterUserLogin =
         boost::json::try_value_to<std::string>(*jvchatterUserLogin);
 
     if (chatterUserLogin.has_error())
@@ -1489,17 +3927,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserLogin.error();
     }
 
-    const auto *jvchatterUserName = root.if_contains("chatter_user_name");
-    if (jvchatterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterUserName{
-                "Missing required key chatter_user_name"};
-        return boost::system::error_code{129,
-                                         error_missing_field_chatterUserName};
-    }
-
-    const auto chatterUserName =
+    auto chatterUserName =
         boost::json::try_value_to<std::string>(*jvchatterUserName);
 
     if (chatterUserName.has_error())
@@ -1507,17 +3935,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterUserName.error();
     }
 
-    const auto *jvchatterIsAnonymous = root.if_contains("chatter_is_anonymous");
-    if (jvchatterIsAnonymous == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_chatterIsAnonymous{
-                "Missing required key chatter_is_anonymous"};
-        return boost::system::error_code{
-            129, error_missing_field_chatterIsAnonymous};
-    }
-
-    const auto chatterIsAnonymous =
+    auto chatterIsAnonymous =
         boost::json::try_value_to<bool>(*jvchatterIsAnonymous);
 
     if (chatterIsAnonymous.has_error())
@@ -1525,29 +3943,14 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return chatterIsAnonymous.error();
     }
 
-    const auto *jvcolor = root.if_contains("color");
-    if (jvcolor == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_color{
-            "Missing required key color"};
-        return boost::system::error_code{129, error_missing_field_color};
-    }
-
-    const auto color = boost::json::try_value_to<std::string>(*jvcolor);
+    auto color = boost::json::try_value_to<std::string>(*jvcolor);
 
     if (color.has_error())
     {
         return color.error();
     }
 
-    const auto *jvbadges = root.if_contains("badges");
-    if (jvbadges == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_badges{
-            "Missing required key badges"};
-        return boost::system::error_code{129, error_missing_field_badges};
-    }
-    const auto badges = boost::json::try_value_to<
+    auto badges = boost::json::try_value_to<
         std::vector<eventsub::payload::channel_chat_notification::v1::Badge>>(
         *jvbadges);
     if (badges.has_error())
@@ -1555,17 +3958,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return badges.error();
     }
 
-    const auto *jvsystemMessage = root.if_contains("system_message");
-    if (jvsystemMessage == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_systemMessage{
-                "Missing required key system_message"};
-        return boost::system::error_code{129,
-                                         error_missing_field_systemMessage};
-    }
-
-    const auto systemMessage =
+    auto systemMessage =
         boost::json::try_value_to<std::string>(*jvsystemMessage);
 
     if (systemMessage.has_error())
@@ -1573,46 +3966,21 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return systemMessage.error();
     }
 
-    const auto *jvmessageID = root.if_contains("message_id");
-    if (jvmessageID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_messageID{"Missing required key message_id"};
-        return boost::system::error_code{129, error_missing_field_messageID};
-    }
-
-    const auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
+    auto messageID = boost::json::try_value_to<std::string>(*jvmessageID);
 
     if (messageID.has_error())
     {
         return messageID.error();
     }
 
-    const auto *jvmessage = root.if_contains("message");
-    if (jvmessage == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_message{"Missing required key message"};
-        return boost::system::error_code{129, error_missing_field_message};
-    }
-
-    const auto message = boost::json::try_value_to<Message>(*jvmessage);
+    auto message = boost::json::try_value_to<Message>(*jvmessage);
 
     if (message.has_error())
     {
         return message.error();
     }
 
-    const auto *jvnoticeType = root.if_contains("notice_type");
-    if (jvnoticeType == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_noticeType{"Missing required key notice_type"};
-        return boost::system::error_code{129, error_missing_field_noticeType};
-    }
-
-    const auto noticeType =
-        boost::json::try_value_to<std::string>(*jvnoticeType);
+    auto noticeType = boost::json::try_value_to<std::string>(*jvnoticeType);
 
     if (noticeType.has_error())
     {
@@ -1621,10 +3989,9 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Subcription>
         sub = std::nullopt;
-    const auto *jvsub = root.if_contains("sub");
     if (jvsub != nullptr && !jvsub->is_null())
     {
-        const auto tsub = boost::json::try_value_to<
+        auto tsub = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Subcription>(
             *jvsub);
 
@@ -1632,16 +3999,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tsub.error();
         }
-        sub = tsub.value();
+        sub = std::move(tsub.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::Resubscription>
         resub = std::nullopt;
-    const auto *jvresub = root.if_contains("resub");
     if (jvresub != nullptr && !jvresub->is_null())
     {
-        const auto tresub = boost::json::try_value_to<
+        auto tresub = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Resubscription>(
             *jvresub);
 
@@ -1649,16 +4015,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tresub.error();
         }
-        resub = tresub.value();
+        resub = std::move(tresub.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::GiftSubscription>
         subGift = std::nullopt;
-    const auto *jvsubGift = root.if_contains("sub_gift");
     if (jvsubGift != nullptr && !jvsubGift->is_null())
     {
-        const auto tsubGift = boost::json::try_value_to<
+        auto tsubGift = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::GiftSubscription>(
             *jvsubGift);
 
@@ -1666,16 +4031,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tsubGift.error();
         }
-        subGift = tsubGift.value();
+        subGift = std::move(tsubGift.value());
     }
 
     std::optional<eventsub::payload::channel_chat_notification::v1::
                       CommunityGiftSubscription>
         communitySubGift = std::nullopt;
-    const auto *jvcommunitySubGift = root.if_contains("community_sub_gift");
     if (jvcommunitySubGift != nullptr && !jvcommunitySubGift->is_null())
     {
-        const auto tcommunitySubGift = boost::json::try_value_to<
+        auto tcommunitySubGift = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::
                 CommunityGiftSubscription>(*jvcommunitySubGift);
 
@@ -1683,16 +4047,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tcommunitySubGift.error();
         }
-        communitySubGift = tcommunitySubGift.value();
+        communitySubGift = std::move(tcommunitySubGift.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::GiftPaidUpgrade>
         giftPaidUpgrade = std::nullopt;
-    const auto *jvgiftPaidUpgrade = root.if_contains("gift_paid_upgrade");
     if (jvgiftPaidUpgrade != nullptr && !jvgiftPaidUpgrade->is_null())
     {
-        const auto tgiftPaidUpgrade = boost::json::try_value_to<
+        auto tgiftPaidUpgrade = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::GiftPaidUpgrade>(
             *jvgiftPaidUpgrade);
 
@@ -1700,16 +4063,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tgiftPaidUpgrade.error();
         }
-        giftPaidUpgrade = tgiftPaidUpgrade.value();
+        giftPaidUpgrade = std::move(tgiftPaidUpgrade.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::PrimePaidUpgrade>
         primePaidUpgrade = std::nullopt;
-    const auto *jvprimePaidUpgrade = root.if_contains("prime_paid_upgrade");
     if (jvprimePaidUpgrade != nullptr && !jvprimePaidUpgrade->is_null())
     {
-        const auto tprimePaidUpgrade = boost::json::try_value_to<
+        auto tprimePaidUpgrade = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::PrimePaidUpgrade>(
             *jvprimePaidUpgrade);
 
@@ -1717,30 +4079,28 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tprimePaidUpgrade.error();
         }
-        primePaidUpgrade = tprimePaidUpgrade.value();
+        primePaidUpgrade = std::move(tprimePaidUpgrade.value());
     }
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Raid> raid =
         std::nullopt;
-    const auto *jvraid = root.if_contains("raid");
     if (jvraid != nullptr && !jvraid->is_null())
     {
-        const auto traid = boost::json::try_value_to<
+        auto traid = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Raid>(*jvraid);
 
         if (traid.has_error())
         {
             return traid.error();
         }
-        raid = traid.value();
+        raid = std::move(traid.value());
     }
 
     std::optional<eventsub::payload::channel_chat_notification::v1::Unraid>
         unraid = std::nullopt;
-    const auto *jvunraid = root.if_contains("unraid");
     if (jvunraid != nullptr && !jvunraid->is_null())
     {
-        const auto tunraid = boost::json::try_value_to<
+        auto tunraid = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Unraid>(
             *jvunraid);
 
@@ -1748,16 +4108,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tunraid.error();
         }
-        unraid = tunraid.value();
+        unraid = std::move(tunraid.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::PayItForward>
         payItForward = std::nullopt;
-    const auto *jvpayItForward = root.if_contains("pay_it_forward");
     if (jvpayItForward != nullptr && !jvpayItForward->is_null())
     {
-        const auto tpayItForward = boost::json::try_value_to<
+        auto tpayItForward = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::PayItForward>(
             *jvpayItForward);
 
@@ -1765,16 +4124,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tpayItForward.error();
         }
-        payItForward = tpayItForward.value();
+        payItForward = std::move(tpayItForward.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::Announcement>
         announcement = std::nullopt;
-    const auto *jvannouncement = root.if_contains("announcement");
     if (jvannouncement != nullptr && !jvannouncement->is_null())
     {
-        const auto tannouncement = boost::json::try_value_to<
+        auto tannouncement = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::Announcement>(
             *jvannouncement);
 
@@ -1782,16 +4140,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tannouncement.error();
         }
-        announcement = tannouncement.value();
+        announcement = std::move(tannouncement.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::CharityDonation>
         charityDonation = std::nullopt;
-    const auto *jvcharityDonation = root.if_contains("charity_donation");
     if (jvcharityDonation != nullptr && !jvcharityDonation->is_null())
     {
-        const auto tcharityDonation = boost::json::try_value_to<
+        auto tcharityDonation = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::CharityDonation>(
             *jvcharityDonation);
 
@@ -1799,16 +4156,15 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tcharityDonation.error();
         }
-        charityDonation = tcharityDonation.value();
+        charityDonation = std::move(tcharityDonation.value());
     }
 
     std::optional<
         eventsub::payload::channel_chat_notification::v1::BitsBadgeTier>
         bitsBadgeTier = std::nullopt;
-    const auto *jvbitsBadgeTier = root.if_contains("bits_badge_tier");
     if (jvbitsBadgeTier != nullptr && !jvbitsBadgeTier->is_null())
     {
-        const auto tbitsBadgeTier = boost::json::try_value_to<
+        auto tbitsBadgeTier = boost::json::try_value_to<
             eventsub::payload::channel_chat_notification::v1::BitsBadgeTier>(
             *jvbitsBadgeTier);
 
@@ -1816,38 +4172,379 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         {
             return tbitsBadgeTier.error();
         }
-        bitsBadgeTier = tbitsBadgeTier.value();
+        bitsBadgeTier = std::move(tbitsBadgeTier.value());
     }
 
     return Event{
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
-        .chatterUserID = chatterUserID.value(),
-        .chatterUserLogin = chatterUserLogin.value(),
-        .chatterUserName = chatterUserName.value(),
-        .chatterIsAnonymous = chatterIsAnonymous.value(),
-        .color = color.value(),
-        .badges = badges.value(),
-        .systemMessage = systemMessage.value(),
-        .messageID = messageID.value(),
-        .message = message.value(),
-        .noticeType = noticeType.value(),
-        .sub = sub,
-        .resub = resub,
-        .subGift = subGift,
-        .communitySubGift = communitySubGift,
-        .giftPaidUpgrade = giftPaidUpgrade,
-        .primePaidUpgrade = primePaidUpgrade,
-        .raid = raid,
-        .unraid = unraid,
-        .payItForward = payItForward,
-        .announcement = announcement,
-        .charityDonation = charityDonation,
-        .bitsBadgeTier = bitsBadgeTier,
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+        .chatterUserID = std::move(chatterUserID.value()),
+        .chatterUserLogin = std::move(chatterUserLogin.value()),
+        .chatterUserName = std::move(chatterUserName.value()),
+        .chatterIsAnonymous = std::move(chatterIsAnonymous.value()),
+        .color = std::move(color.value()),
+        .badges = std::move(badges.value()),
+        .systemMessage = std::move(systemMessage.value()),
+        .messageID = std::move(messageID.value()),
+        .message = std::move(message.value()),
+        .noticeType = std::move(noticeType.value()),
+        .sub = std::move(sub),
+        .resub = std::move(resub),
+        .subGift = std::move(subGift),
+        .communitySubGift = std::move(communitySubGift),
+        .giftPaidUpgrade = std::move(giftPaidUpgrade),
+        .primePaidUpgrade = std::move(primePaidUpgrade),
+        .raid = std::move(raid),
+        .unraid = std::move(unraid),
+        .payItForward = std::move(payItForward),
+        .announcement = std::move(announcement),
+        .charityDonation = std::move(charityDonation),
+        .bitsBadgeTier = std::move(bitsBadgeTier),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 3:
+                    if (key == "sub")
+                    {
+                        seen |= std::uint64_t{1} << 13;
+                        return sax::slot(out.sub);
+                    }
+                    break;
+                case 4:
+                    if (key == "raid")
+                    {
+                        seen |= std::uint64_t{1} << 19;
+                        return sax::slot(out.raid);
+                    }
+                    break;
+                case 5:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "color")
+                            {
+                                seen |= std::uint64_t{1} << 7;
+                                return sax::slot(out.color);
+                            }
+                            break;
+                        case 'r':
+                            if (key == "resub")
+                            {
+                                seen |= std::uint64_t{1} << 14;
+                                return sax::slot(out.resub);
+                            }
+                            break;
+                    }
+                    break;
+                case 6:
+                    switch (key[0])
+                    {
+                        case 'b':
+                            if (key == "badges")
+                            {
+                                seen |= std::uint64_t{1} << 8;
+                                return sax::slot(out.badges);
+                            }
+                            break;
+                        case 'u':
+                            if (key == "unraid")
+                            {
+                                seen |= std::uint64_t{1} << 20;
+                                return sax::slot(out.unraid);
+                            }
+                            break;
+                    }
+                    break;
+                case 7:
+                    if (key == "message")
+                    {
+                        seen |= std::uint64_t{1} << 11;
+                        return sax::slot(out.message);
+                    }
+                    break;
+                case 8:
+                    if (key == "sub_gift")
+                    {
+                        seen |= std::uint64_t{1} << 15;
+                        return sax::slot(out.subGift);
+                    }
+                    break;
+                case 10:
+                    if (key == "message_id")
+                    {
+                        seen |= std::uint64_t{1} << 10;
+                        return sax::slot(out.messageID);
+                    }
+                    break;
+                case 11:
+                    if (key == "notice_type")
+                    {
+                        seen |= std::uint64_t{1} << 12;
+                        return sax::slot(out.noticeType);
+                    }
+                    break;
+                case 12:
+                    if (key == "announcement")
+                    {
+                        seen |= std::uint64_t{1} << 22;
+                        return sax::slot(out.announcement);
+                    }
+                    break;
+                case 14:
+                    switch (key[0])
+                    {
+                        case 's':
+                            if (key == "system_message")
+                            {
+                                seen |= std::uint64_t{1} << 9;
+                                return sax::slot(out.systemMessage);
+                            }
+                            break;
+                        case 'p':
+                            if (key == "pay_it_forward")
+                            {
+                                seen |= std::uint64_t{1} << 21;
+                                return sax::slot(out.payItForward);
+                            }
+                            break;
+                    }
+                    break;
+                case 15:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "chatter_user_id")
+                            {
+                                seen |= std::uint64_t{1} << 3;
+                                return sax::slot(out.chatterUserID);
+                            }
+                            break;
+                        case 'b':
+                            if (key == "bits_badge_tier")
+                            {
+                                seen |= std::uint64_t{1} << 24;
+                                return sax::slot(out.bitsBadgeTier);
+                            }
+                            break;
+                    }
+                    break;
+                case 16:
+                    if (key == "charity_donation")
+                    {
+                        seen |= std::uint64_t{1} << 23;
+                        return sax::slot(out.charityDonation);
+                    }
+                    break;
+                case 17:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "chatter_user_name")
+                            {
+                                seen |= std::uint64_t{1} << 5;
+                                return sax::slot(out.chatterUserName);
+                            }
+                            break;
+                        case 'g':
+                            if (key == "gift_paid_upgrade")
+                            {
+                                seen |= std::uint64_t{1} << 17;
+                                return sax::slot(out.giftPaidUpgrade);
+                            }
+                            break;
+                    }
+                    break;
+                case 18:
+                    switch (key[0])
+                    {
+                        case 'c':
+                            if (key == "chatter_user_login")
+                            {
+                                seen |= std::uint64_t{1} << 4;
+                                return sax::slot(out.chatterUserLogin);
+                            }
+                            if (key == "community_sub_gift")
+                            {
+                                seen |= std::uint64_t{1} << 16;
+                                return sax::slot(out.communitySubGift);
+                            }
+                            break;
+                        case 'p':
+                            if (key == "prime_paid_upgrade")
+                            {
+                                seen |= std::uint64_t{1} << 18;
+                                return sax::slot(out.primePaidUpgrade);
+                            }
+                            break;
+                    }
+                    break;
+                case 19:
+                    if (key == "broadcaster_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.broadcasterUserID);
+                    }
+                    break;
+                case 20:
+                    if (key == "chatter_is_anonymous")
+                    {
+                        seen |= std::uint64_t{1} << 6;
+                        return sax::slot(out.chatterIsAnonymous);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 8191U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserID{
+                        "Missing required key chatter_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserLogin{
+                        "Missing required key chatter_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterUserName{
+                        "Missing required key chatter_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_chatterIsAnonymous{
+                        "Missing required key chatter_is_anonymous"};
+                return boost::system::error_code{
+                    129, error_missing_field_chatterIsAnonymous};
+            }
+
+            if ((seen & (std::uint64_t{1} << 7)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_color{"Missing required key color"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_color};
+            }
+
+            if ((seen & (std::uint64_t{1} << 8)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_badges{"Missing required key badges"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_badges};
+            }
+
+            if ((seen & (std::uint64_t{1} << 9)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_systemMessage{
+                        "Missing required key system_message"};
+                return boost::system::error_code{
+                    129, error_missing_field_systemMessage};
+            }
+
+            if ((seen & (std::uint64_t{1} << 10)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_messageID{
+                        "Missing required key message_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_messageID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 11)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_message{"Missing required key message"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_message};
+            }
+
+            if ((seen & (std::uint64_t{1} << 12)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_noticeType{
+                        "Missing required key notice_type"};
+                return boost::system::error_code{
+                    129, error_missing_field_noticeType};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -1859,16 +4556,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
     }
 
-    const auto subscription =
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -1876,15 +4610,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -1892,9 +4618,65 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 // DESERIALIZATION IMPLEMENTATION END
 
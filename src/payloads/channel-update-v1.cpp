@@ -7,6 +7,7 @@
 namespace eventsub::payload::channel_update::v1 {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot)
 {
@@ -18,17 +19,151 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+    const boost::json::value *jvtitle = nullptr;
+    const boost::json::value *jvlanguage = nullptr;
+    const boost::json::value *jvcategoryID = nullptr;
+    const boost::json::value *jvcategoryName = nullptr;
+    const boost::json::value *jvisMature = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "title")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvtitle = &member.value();
+                }
+                break;
+            case 8:
+                if (key == "language")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvlanguage = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "is_mature")
+                {
+                    seen |= std::uint64_t{1} << 7;
+                    jvisMature = &member.value();
+                }
+                break;
+            case 11:
+                if (key == "category_id")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvcategoryID = &member.value();
+                }
+                break;
+            case 13:
+                if (key == "category_name")
+                {
+                    seen |= std::uint64_t{1} << 6;
+                    jvcategoryName = &member.value();
+                }
+                break;
+            case 19:
+                if (key == "broadcaster_user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvbroadcasterUserID = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 255U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
+
+        if (jvtitle == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_title{"Missing required key title"};
+            return boost::system::error_code{129, error_missing_field_title};
+        }
+
+        if (jvlanguage == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_language{"Missing required key language"};
+            return boost::system::error_code{129, error_missing_field_language};
+        }
+
+        if (jvcategoryID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_categoryID{
+                    "Missing required key category_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_categoryID};
+        }
+
+        if (jvcategoryName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_categoryName{
+                    "Missing required key category_name"};
+            return boost::system::error_code{129,
+                                             error_missing_field_categoryName};
+        }
+
+        if (jvisMature == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_isMature{"Missing required key is_mature"};
+            return boost::system::error_code{129, error_missing_field_isMature};
+        }
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -36,18 +171,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -55,18 +179,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -74,78 +187,35 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserName.error();
     }
 
-    const auto *jvtitle = root.if_contains("title");
-    if (jvtitle == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_title{
-            "Missing required key title"};
-        return boost::system::error_code{129, error_missing_field_title};
-    }
-
-    const auto title = boost::json::try_value_to<std::string>(*jvtitle);
+    auto title = boost::json::try_value_to<std::string>(*jvtitle);
 
     if (title.has_error())
     {
         return title.error();
     }
 
-    const auto *jvlanguage = root.if_contains("language");
-    if (jvlanguage == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_language{"Missing required key language"};
-        return boost::system::error_code{129, error_missing_field_language};
-    }
-
-    const auto language = boost::json::try_value_to<std::string>(*jvlanguage);
+    auto language = boost::json::try_value_to<std::string>(*jvlanguage);
 
     if (language.has_error())
     {
         return language.error();
     }
 
-    const auto *jvcategoryID = root.if_contains("category_id");
-    if (jvcategoryID == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_categoryID{"Missing required key category_id"};
-        return boost::system::error_code{129, error_missing_field_categoryID};
-    }
-
-    const auto categoryID =
-        boost::json::try_value_to<std::string>(*jvcategoryID);
+    auto categoryID = boost::json::try_value_to<std::string>(*jvcategoryID);
 
     if (categoryID.has_error())
     {
         return categoryID.error();
     }
 
-    const auto *jvcategoryName = root.if_contains("category_name");
-    if (jvcategoryName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_categoryName{
-                "Missing required key category_name"};
-        return boost::system::error_code{129, error_missing_field_categoryName};
-    }
-
-    const auto categoryName =
-        boost::json::try_value_to<std::string>(*jvcategoryName);
+    auto categoryName = boost::json::try_value_to<std::string>(*jvcategoryName);
 
     if (categoryName.has_error())
     {
         return categoryName.error();
     }
 
-    const auto *jvisMature = root.if_contains("is_mature");
-    if (jvisMature == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_isMature{"Missing required key is_mature"};
-        return boost::system::error_code{129, error_missing_field_isMature};
-    }
-
-    const auto isMature = boost::json::try_value_to<bool>(*jvisMature);
+    auto isMature = boost::json::try_value_to<bool>(*jvisMature);
 
     if (isMature.has_error())
     {
@@ -153,17 +223,168 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
 
     return Event{
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
-        .title = title.value(),
-        .language = language.value(),
-        .categoryID = categoryID.value(),
-        .categoryName = categoryName.value(),
-        .isMature = isMature.value(),
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+        .title = std::move(title.value()),
+        .language = std::move(language.value()),
+        .categoryID = std::move(categoryID.value()),
+        .categoryName = std::move(categoryName.value()),
+        .isMature = std::move(isMature.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "title")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.title);
+                    }
+                    break;
+                case 8:
+                    if (key == "language")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.language);
+                    }
+                    break;
+                case 9:
+                    if (key == "is_mature")
+                    {
+                        seen |= std::uint64_t{1} << 7;
+                        return sax::slot(out.isMature);
+                    }
+                    break;
+                case 11:
+                    if (key == "category_id")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.categoryID);
+                    }
+                    break;
+                case 13:
+                    if (key == "category_name")
+                    {
+                        seen |= std::uint64_t{1} << 6;
+                        return sax::slot(out.categoryName);
+                    }
+                    break;
+                case 19:
+                    if (key == "broadcaster_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.broadcasterUserID);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 255U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_title{"Missing required key title"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_title};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_language{
+                        "Missing required key language"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_language};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_categoryID{
+                        "Missing required key category_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_categoryID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_categoryName{
+                        "Missing required key category_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_categoryName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 7)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_isMature{
+                        "Missing required key is_mature"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_isMature};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -175,16 +396,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto subscription =
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
+    }
+
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -192,15 +450,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -208,10 +458,66 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
     };
 }
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
 // DESERIALIZATION IMPLEMENTATION END
 
 }  // namespace eventsub::payload::channel_update::v1
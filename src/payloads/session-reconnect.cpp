@@ -0,0 +1,180 @@
+#include "twitch-eventsub-ws/payloads/session-reconnect.hpp"
+
+#include "twitch-eventsub-ws/errors.hpp"
+
+#include <boost/json.hpp>
+
+namespace eventsub::payload::session_reconnect {
+
+// DESERIALIZATION IMPLEMENTATION START
+
+boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
+{
+    if (!jvRoot.is_object())
+    {
+        static const error::ApplicationErrorCategory errorMustBeObject{
+            "Payload must be an object"};
+        return boost::system::error_code{129, errorMustBeObject};
+    }
+    const auto &outerRoot = jvRoot.get_object();
+
+    const auto *jvInnerRoot = outerRoot.if_contains("session");
+    if (jvInnerRoot == nullptr)
+    {
+        static const error::ApplicationErrorCategory errorMissing{
+            "Payload's key session is missing"};
+        return boost::system::error_code{129, errorMissing};
+    }
+    if (!jvInnerRoot->is_object())
+    {
+        static const error::ApplicationErrorCategory errorMustBeObject{
+            "Payload's session must be an object"};
+        return boost::system::error_code{129, errorMustBeObject};
+    }
+    const auto &root = jvInnerRoot->get_object();
+
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvreconnectURL = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 13:
+                if (key == "reconnect_url")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvreconnectURL = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
+    {
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvreconnectURL == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_reconnectURL{
+                    "Missing required key reconnect_url"};
+            return boost::system::error_code{129,
+                                             error_missing_field_reconnectURL};
+        }
+    }
+
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
+    {
+        return id.error();
+    }
+
+    auto reconnectURL = boost::json::try_value_to<std::string>(*jvreconnectURL);
+
+    if (reconnectURL.has_error())
+    {
+        return reconnectURL.error();
+    }
+
+    return Payload{
+        .id = std::move(id.value()),
+        .reconnectURL = std::move(reconnectURL.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> innerSink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 13:
+                    if (key == "reconnect_url")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.reconnectURL);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_reconnectURL{
+                        "Missing required key reconnect_url"};
+                return boost::system::error_code{
+                    129, error_missing_field_reconnectURL};
+            }
+
+            return {};
+        },
+    };
+
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            if (key == "session")
+            {
+                seen |= 1;
+                return {&out, &innerSink};
+            }
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            if ((seen & 1) == 0)
+            {
+                static const error::ApplicationErrorCategory errorMissing{
+                    "Payload's key session is missing"};
+                return boost::system::error_code{129, errorMissing};
+            }
+            return {};
+        },
+    };
+
+    return sink;
+}
+// DESERIALIZATION IMPLEMENTATION END
+
+}  // namespace eventsub::payload::session_reconnect
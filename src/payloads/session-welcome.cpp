@@ -7,6 +7,7 @@
 namespace eventsub::payload::session_welcome {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -33,25 +34,136 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvInnerRoot->get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvkeepaliveTimeoutSeconds = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 25:
+                if (key == "keepalive_timeout_seconds")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvkeepaliveTimeoutSeconds = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 1U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
+    auto id = boost::json::try_value_to<std::string>(*jvid);
 
     if (id.has_error())
     {
         return id.error();
     }
 
+    std::optional<int> keepaliveTimeoutSeconds = std::nullopt;
+    if (jvkeepaliveTimeoutSeconds != nullptr &&
+        !jvkeepaliveTimeoutSeconds->is_null())
+    {
+        auto tkeepaliveTimeoutSeconds =
+            boost::json::try_value_to<int>(*jvkeepaliveTimeoutSeconds);
+
+        if (tkeepaliveTimeoutSeconds.has_error())
+        {
+            return tkeepaliveTimeoutSeconds.error();
+        }
+        keepaliveTimeoutSeconds = std::move(tkeepaliveTimeoutSeconds.value());
+    }
+
     return Payload{
-        .id = id.value(),
+        .id = std::move(id.value()),
+        .keepaliveTimeoutSeconds = std::move(keepaliveTimeoutSeconds),
     };
 }
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> innerSink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 25:
+                    if (key == "keepalive_timeout_seconds")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.keepaliveTimeoutSeconds);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 1U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            return {};
+        },
+    };
+
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            if (key == "session")
+            {
+                seen |= 1;
+                return {&out, &innerSink};
+            }
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            if ((seen & 1) == 0)
+            {
+                static const error::ApplicationErrorCategory errorMissing{
+                    "Payload's key session is missing"};
+                return boost::system::error_code{129, errorMissing};
+            }
+            return {};
+        },
+    };
+
+    return sink;
+}
 // DESERIALIZATION IMPLEMENTATION END
 
 }  // namespace eventsub::payload::session_welcome
@@ -7,6 +7,7 @@
 namespace eventsub::payload::stream_offline::v1 {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot)
 {
@@ -18,17 +19,72 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 19:
+                if (key == "broadcaster_user_id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvbroadcasterUserID = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 7U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -36,18 +92,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -55,18 +100,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -75,10 +109,82 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
 
     return Event{
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 19:
+                    if (key == "broadcaster_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.broadcasterUserID);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 7U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
@@ -92,16 +198,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
     }
 
-    const auto subscription =
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -109,15 +252,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -125,9 +260,65 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 // DESERIALIZATION IMPLEMENTATION END
 
@@ -7,6 +7,7 @@
 namespace eventsub::payload::stream_online::v1 {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Event>, const boost::json::value &jvRoot)
 {
@@ -18,32 +19,126 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvbroadcasterUserID = nullptr;
+    const boost::json::value *jvbroadcasterUserLogin = nullptr;
+    const boost::json::value *jvbroadcasterUserName = nullptr;
+    const boost::json::value *jvtype = nullptr;
+    const boost::json::value *jvstartedAt = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 4:
+                if (key == "type")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvtype = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "started_at")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvstartedAt = &member.value();
+                }
+                break;
+            case 19:
+                if (key == "broadcaster_user_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvbroadcasterUserID = &member.value();
+                }
+                break;
+            case 21:
+                if (key == "broadcaster_user_name")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvbroadcasterUserName = &member.value();
+                }
+                break;
+            case 22:
+                if (key == "broadcaster_user_login")
+                {
+                    seen |= std::uint64_t{1} << 2;
+                    jvbroadcasterUserLogin = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
-
-    if (id.has_error())
+    constexpr std::uint64_t requiredMask = 63U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return id.error();
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvbroadcasterUserID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserID{
+                    "Missing required key broadcaster_user_id"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserID};
+        }
+
+        if (jvbroadcasterUserLogin == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserLogin{
+                    "Missing required key broadcaster_user_login"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserLogin};
+        }
+
+        if (jvbroadcasterUserName == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_broadcasterUserName{
+                    "Missing required key broadcaster_user_name"};
+            return boost::system::error_code{
+                129, error_missing_field_broadcasterUserName};
+        }
+
+        if (jvtype == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_type{"Missing required key type"};
+            return boost::system::error_code{129, error_missing_field_type};
+        }
+
+        if (jvstartedAt == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_startedAt{
+                    "Missing required key started_at"};
+            return boost::system::error_code{129,
+                                             error_missing_field_startedAt};
+        }
     }
 
-    const auto *jvbroadcasterUserID = root.if_contains("broadcaster_user_id");
-    if (jvbroadcasterUserID == nullptr)
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserID{
-                "Missing required key broadcaster_user_id"};
-        return boost::system::error_code{129,
-                                         error_missing_field_broadcasterUserID};
+        return id.error();
     }
 
-    const auto broadcasterUserID =
+    auto broadcasterUserID =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserID);
 
     if (broadcasterUserID.has_error())
@@ -51,18 +146,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserID.error();
     }
 
-    const auto *jvbroadcasterUserLogin =
-        root.if_contains("broadcaster_user_login");
-    if (jvbroadcasterUserLogin == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserLogin{
-                "Missing required key broadcaster_user_login"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserLogin};
-    }
-
-    const auto broadcasterUserLogin =
+    auto broadcasterUserLogin =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserLogin);
 
     if (broadcasterUserLogin.has_error())
@@ -70,18 +154,7 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserLogin.error();
     }
 
-    const auto *jvbroadcasterUserName =
-        root.if_contains("broadcaster_user_name");
-    if (jvbroadcasterUserName == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_broadcasterUserName{
-                "Missing required key broadcaster_user_name"};
-        return boost::system::error_code{
-            129, error_missing_field_broadcasterUserName};
-    }
-
-    const auto broadcasterUserName =
+    auto broadcasterUserName =
         boost::json::try_value_to<std::string>(*jvbroadcasterUserName);
 
     if (broadcasterUserName.has_error())
@@ -89,30 +162,14 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
         return broadcasterUserName.error();
     }
 
-    const auto *jvtype = root.if_contains("type");
-    if (jvtype == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_type{
-            "Missing required key type"};
-        return boost::system::error_code{129, error_missing_field_type};
-    }
-
-    const auto type = boost::json::try_value_to<std::string>(*jvtype);
+    auto type = boost::json::try_value_to<std::string>(*jvtype);
 
     if (type.has_error())
     {
         return type.error();
     }
 
-    const auto *jvstartedAt = root.if_contains("started_at");
-    if (jvstartedAt == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_startedAt{"Missing required key started_at"};
-        return boost::system::error_code{129, error_missing_field_startedAt};
-    }
-
-    const auto startedAt = boost::json::try_value_to<std::string>(*jvstartedAt);
+    auto startedAt = boost::json::try_value_to<Timestamp>(*jvstartedAt);
 
     if (startedAt.has_error())
     {
@@ -120,15 +177,131 @@ boost::json::result_for<Event, boost::json::value>::type tag_invoke(
     }
 
     return Event{
-        .id = id.value(),
-        .broadcasterUserID = broadcasterUserID.value(),
-        .broadcasterUserLogin = broadcasterUserLogin.value(),
-        .broadcasterUserName = broadcasterUserName.value(),
-        .type = type.value(),
-        .startedAt = startedAt.value(),
+        .id = std::move(id.value()),
+        .broadcasterUserID = std::move(broadcasterUserID.value()),
+        .broadcasterUserLogin = std::move(broadcasterUserLogin.value()),
+        .broadcasterUserName = std::move(broadcasterUserName.value()),
+        .type = std::move(type.value()),
+        .startedAt = std::move(startedAt.value()),
     };
 }
 
+const sax::Sink &saxSink(sax::SinkTag<Event> /*tag*/)
+{
+    static const sax::ObjectSink<Event> sink{
+        [](Event &out, std::string_view key, std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 4:
+                    if (key == "type")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.type);
+                    }
+                    break;
+                case 10:
+                    if (key == "started_at")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.startedAt);
+                    }
+                    break;
+                case 19:
+                    if (key == "broadcaster_user_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.broadcasterUserID);
+                    }
+                    break;
+                case 21:
+                    if (key == "broadcaster_user_name")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.broadcasterUserName);
+                    }
+                    break;
+                case 22:
+                    if (key == "broadcaster_user_login")
+                    {
+                        seen |= std::uint64_t{1} << 2;
+                        return sax::slot(out.broadcasterUserLogin);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 63U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserID{
+                        "Missing required key broadcaster_user_id"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserID};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserLogin{
+                        "Missing required key broadcaster_user_login"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserLogin};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_broadcasterUserName{
+                        "Missing required key broadcaster_user_name"};
+                return boost::system::error_code{
+                    129, error_missing_field_broadcasterUserName};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_type{"Missing required key type"};
+                return boost::system::error_code{129, error_missing_field_type};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_startedAt{
+                        "Missing required key started_at"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_startedAt};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
+
 boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Payload>, const boost::json::value &jvRoot)
 {
@@ -140,16 +313,53 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvsubscription = root.if_contains("subscription");
-    if (jvsubscription == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvsubscription = nullptr;
+    const boost::json::value *jvevent = nullptr;
+
+    for (const auto &member : root)
+    {
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 5:
+                if (key == "event")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvevent = &member.value();
+                }
+                break;
+            case 12:
+                if (key == "subscription")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvsubscription = &member.value();
+                }
+                break;
+        }
+    }
+
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_subscription{
-                "Missing required key subscription"};
-        return boost::system::error_code{129, error_missing_field_subscription};
+        if (jvsubscription == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_subscription{
+                    "Missing required key subscription"};
+            return boost::system::error_code{129,
+                                             error_missing_field_subscription};
+        }
+
+        if (jvevent == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_event{"Missing required key event"};
+            return boost::system::error_code{129, error_missing_field_event};
+        }
     }
 
-    const auto subscription =
+    auto subscription =
         boost::json::try_value_to<subscription::Subscription>(*jvsubscription);
 
     if (subscription.has_error())
@@ -157,15 +367,7 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
         return subscription.error();
     }
 
-    const auto *jvevent = root.if_contains("event");
-    if (jvevent == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_event{
-            "Missing required key event"};
-        return boost::system::error_code{129, error_missing_field_event};
-    }
-
-    const auto event = boost::json::try_value_to<Event>(*jvevent);
+    auto event = boost::json::try_value_to<Event>(*jvevent);
 
     if (event.has_error())
     {
@@ -173,10 +375,66 @@ boost::json::result_for<Payload, boost::json::value>::type tag_invoke(
     }
 
     return Payload{
-        .subscription = subscription.value(),
-        .event = event.value(),
+        .subscription = std::move(subscription.value()),
+        .event = std::move(event.value()),
     };
 }
+
+const sax::Sink &saxSink(sax::SinkTag<Payload> /*tag*/)
+{
+    static const sax::ObjectSink<Payload> sink{
+        [](Payload &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 5:
+                    if (key == "event")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.event);
+                    }
+                    break;
+                case 12:
+                    if (key == "subscription")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.subscription);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_subscription{
+                        "Missing required key subscription"};
+                return boost::system::error_code{
+                    129, error_missing_field_subscription};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_event{"Missing required key event"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_event};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
 // DESERIALIZATION IMPLEMENTATION END
 
 }  // namespace eventsub::payload::stream_online::v1
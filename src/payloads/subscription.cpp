@@ -7,6 +7,7 @@
 namespace eventsub::payload::subscription {
 
 // DESERIALIZATION IMPLEMENTATION START
+
 boost::json::result_for<Transport, boost::json::value>::type tag_invoke(
     boost::json::try_value_to_tag<Transport>, const boost::json::value &jvRoot)
 {
@@ -18,30 +19,60 @@ boost::json::result_for<Transport, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvmethod = root.if_contains("method");
-    if (jvmethod == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvmethod = nullptr;
+    const boost::json::value *jvsessionID = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_method{
-            "Missing required key method"};
-        return boost::system::error_code{129, error_missing_field_method};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 6:
+                if (key == "method")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvmethod = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "session_id")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvsessionID = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto method = boost::json::try_value_to<std::string>(*jvmethod);
-
-    if (method.has_error())
+    constexpr std::uint64_t requiredMask = 3U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return method.error();
+        if (jvmethod == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_method{"Missing required key method"};
+            return boost::system::error_code{129, error_missing_field_method};
+        }
+
+        if (jvsessionID == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_sessionID{
+                    "Missing required key session_id"};
+            return boost::system::error_code{129,
+                                             error_missing_field_sessionID};
+        }
     }
 
-    const auto *jvsessionID = root.if_contains("session_id");
-    if (jvsessionID == nullptr)
+    auto method = boost::json::try_value_to<std::string>(*jvmethod);
+
+    if (method.has_error())
     {
-        static const error::ApplicationErrorCategory
-            error_missing_field_sessionID{"Missing required key session_id"};
-        return boost::system::error_code{129, error_missing_field_sessionID};
+        return method.error();
     }
 
-    const auto sessionID = boost::json::try_value_to<std::string>(*jvsessionID);
+    auto sessionID = boost::json::try_value_to<std::string>(*jvsessionID);
 
     if (sessionID.has_error())
     {
@@ -49,9 +80,65 @@ boost::json::result_for<Transport, boost::json::value>::type tag_invoke(
     }
 
     return Transport{
-        .method = method.value(),
-        .sessionID = sessionID.value(),
+        .method = std::move(method.value()),
+        .sessionID = std::move(sessionID.value()),
+    };
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Transport> /*tag*/)
+{
+    static const sax::ObjectSink<Transport> sink{
+        [](Transport &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 6:
+                    if (key == "method")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.method);
+                    }
+                    break;
+                case 10:
+                    if (key == "session_id")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.sessionID);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 3U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_method{"Missing required key method"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_method};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_sessionID{
+                        "Missing required key session_id"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_sessionID};
+            }
+
+            return {};
+        },
     };
+
+    return sink;
 }
 
 boost::json::result_for<Subscription, boost::json::value>::type tag_invoke(
@@ -66,105 +153,176 @@ boost::json::result_for<Subscription, boost::json::value>::type tag_invoke(
     }
     const auto &root = jvRoot.get_object();
 
-    const auto *jvid = root.if_contains("id");
-    if (jvid == nullptr)
+    std::uint64_t seen = 0;
+    const boost::json::value *jvid = nullptr;
+    const boost::json::value *jvstatus = nullptr;
+    const boost::json::value *jvtype = nullptr;
+    const boost::json::value *jvversion = nullptr;
+    const boost::json::value *jvtransport = nullptr;
+    const boost::json::value *jvcreatedAt = nullptr;
+    const boost::json::value *jvcost = nullptr;
+
+    for (const auto &member : root)
     {
-        static const error::ApplicationErrorCategory error_missing_field_id{
-            "Missing required key id"};
-        return boost::system::error_code{129, error_missing_field_id};
+        const auto key = member.key();
+        switch (key.size())
+        {
+            case 2:
+                if (key == "id")
+                {
+                    seen |= std::uint64_t{1} << 0;
+                    jvid = &member.value();
+                }
+                break;
+            case 4:
+                switch (key[0])
+                {
+                    case 't':
+                        if (key == "type")
+                        {
+                            seen |= std::uint64_t{1} << 2;
+                            jvtype = &member.value();
+                        }
+                        break;
+                    case 'c':
+                        if (key == "cost")
+                        {
+                            seen |= std::uint64_t{1} << 6;
+                            jvcost = &member.value();
+                        }
+                        break;
+                }
+                break;
+            case 6:
+                if (key == "status")
+                {
+                    seen |= std::uint64_t{1} << 1;
+                    jvstatus = &member.value();
+                }
+                break;
+            case 7:
+                if (key == "version")
+                {
+                    seen |= std::uint64_t{1} << 3;
+                    jvversion = &member.value();
+                }
+                break;
+            case 9:
+                if (key == "transport")
+                {
+                    seen |= std::uint64_t{1} << 4;
+                    jvtransport = &member.value();
+                }
+                break;
+            case 10:
+                if (key == "created_at")
+                {
+                    seen |= std::uint64_t{1} << 5;
+                    jvcreatedAt = &member.value();
+                }
+                break;
+        }
     }
 
-    const auto id = boost::json::try_value_to<std::string>(*jvid);
-
-    if (id.has_error())
+    constexpr std::uint64_t requiredMask = 127U;
+    if ((seen & requiredMask) != requiredMask)
     {
-        return id.error();
+        if (jvid == nullptr)
+        {
+            static const error::ApplicationErrorCategory error_missing_field_id{
+                "Missing required key id"};
+            return boost::system::error_code{129, error_missing_field_id};
+        }
+
+        if (jvstatus == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_status{"Missing required key status"};
+            return boost::system::error_code{129, error_missing_field_status};
+        }
+
+        if (jvtype == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_type{"Missing required key type"};
+            return boost::system::error_code{129, error_missing_field_type};
+        }
+
+        if (jvversion == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_version{"Missing required key version"};
+            return boost::system::error_code{129, error_missing_field_version};
+        }
+
+        if (jvtransport == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_transport{"Missing required key transport"};
+            return boost::system::error_code{129,
+                                             error_missing_field_transport};
+        }
+
+        if (jvcreatedAt == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_createdAt{
+                    "Missing required key created_at"};
+            return boost::system::error_code{129,
+                                             error_missing_field_createdAt};
+        }
+
+        if (jvcost == nullptr)
+        {
+            static const error::ApplicationErrorCategory
+                error_missing_field_cost{"Missing required key cost"};
+            return boost::system::error_code{129, error_missing_field_cost};
+        }
     }
 
-    const auto *jvstatus = root.if_contains("status");
-    if (jvstatus == nullptr)
+    auto id = boost::json::try_value_to<std::string>(*jvid);
+
+    if (id.has_error())
     {
-        static const error::ApplicationErrorCategory error_missing_field_status{
-            "Missing required key status"};
-        return boost::system::error_code{129, error_missing_field_status};
+        return id.error();
     }
 
-    const auto status = boost::json::try_value_to<std::string>(*jvstatus);
+    auto status = boost::json::try_value_to<std::string>(*jvstatus);
 
     if (status.has_error())
     {
         return status.error();
     }
 
-    const auto *jvtype = root.if_contains("type");
-    if (jvtype == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_type{
-            "Missing required key type"};
-        return boost::system::error_code{129, error_missing_field_type};
-    }
-
-    const auto type = boost::json::try_value_to<std::string>(*jvtype);
+    auto type = boost::json::try_value_to<std::string>(*jvtype);
 
     if (type.has_error())
     {
         return type.error();
     }
 
-    const auto *jvversion = root.if_contains("version");
-    if (jvversion == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_version{"Missing required key version"};
-        return boost::system::error_code{129, error_missing_field_version};
-    }
-
-    const auto version = boost::json::try_value_to<std::string>(*jvversion);
+    auto version = boost::json::try_value_to<std::string>(*jvversion);
 
     if (version.has_error())
     {
         return version.error();
     }
 
-    const auto *jvtransport = root.if_contains("transport");
-    if (jvtransport == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_transport{"Missing required key transport"};
-        return boost::system::error_code{129, error_missing_field_transport};
-    }
-
-    const auto transport = boost::json::try_value_to<Transport>(*jvtransport);
+    auto transport = boost::json::try_value_to<Transport>(*jvtransport);
 
     if (transport.has_error())
     {
         return transport.error();
     }
 
-    const auto *jvcreatedAt = root.if_contains("created_at");
-    if (jvcreatedAt == nullptr)
-    {
-        static const error::ApplicationErrorCategory
-            error_missing_field_createdAt{"Missing required key created_at"};
-        return boost::system::error_code{129, error_missing_field_createdAt};
-    }
-
-    const auto createdAt = boost::json::try_value_to<std::string>(*jvcreatedAt);
+    auto createdAt = boost::json::try_value_to<Timestamp>(*jvcreatedAt);
 
     if (createdAt.has_error())
     {
         return createdAt.error();
     }
 
-    const auto *jvcost = root.if_contains("cost");
-    if (jvcost == nullptr)
-    {
-        static const error::ApplicationErrorCategory error_missing_field_cost{
-            "Missing required key cost"};
-        return boost::system::error_code{129, error_missing_field_cost};
-    }
-
-    const auto cost = boost::json::try_value_to<int>(*jvcost);
+    auto cost = boost::json::try_value_to<int>(*jvcost);
 
     if (cost.has_error())
     {
@@ -172,15 +330,149 @@ boost::json::result_for<Subscription, boost::json::value>::type tag_invoke(
     }
 
     return Subscription{
-        .id = id.value(),
-        .status = status.value(),
-        .type = type.value(),
-        .version = version.value(),
-        .transport = transport.value(),
-        .createdAt = createdAt.value(),
-        .cost = cost.value(),
+        .id = std::move(id.value()),
+        .status = std::move(status.value()),
+        .type = std::move(type.value()),
+        .version = std::move(version.value()),
+        .transport = std::move(transport.value()),
+        .createdAt = std::move(createdAt.value()),
+        .cost = std::move(cost.value()),
     };
 }
+
+const sax::Sink &saxSink(sax::SinkTag<Subscription> /*tag*/)
+{
+    static const sax::ObjectSink<Subscription> sink{
+        [](Subscription &out, std::string_view key,
+           std::uint64_t &seen) -> sax::Slot {
+            switch (key.size())
+            {
+                case 2:
+                    if (key == "id")
+                    {
+                        seen |= std::uint64_t{1} << 0;
+                        return sax::slot(out.id);
+                    }
+                    break;
+                case 4:
+                    switch (key[0])
+                    {
+                        case 't':
+                            if (key == "type")
+                            {
+                                seen |= std::uint64_t{1} << 2;
+                                return sax::slot(out.type);
+                            }
+                            break;
+                        case 'c':
+                            if (key == "cost")
+                            {
+                                seen |= std::uint64_t{1} << 6;
+                                return sax::slot(out.cost);
+                            }
+                            break;
+                    }
+                    break;
+                case 6:
+                    if (key == "status")
+                    {
+                        seen |= std::uint64_t{1} << 1;
+                        return sax::slot(out.status);
+                    }
+                    break;
+                case 7:
+                    if (key == "version")
+                    {
+                        seen |= std::uint64_t{1} << 3;
+                        return sax::slot(out.version);
+                    }
+                    break;
+                case 9:
+                    if (key == "transport")
+                    {
+                        seen |= std::uint64_t{1} << 4;
+                        return sax::slot(out.transport);
+                    }
+                    break;
+                case 10:
+                    if (key == "created_at")
+                    {
+                        seen |= std::uint64_t{1} << 5;
+                        return sax::slot(out.createdAt);
+                    }
+                    break;
+            }
+
+            return {};
+        },
+        [](std::uint64_t seen) -> boost::json::error_code {
+            constexpr std::uint64_t requiredMask = 127U;
+            if ((seen & requiredMask) == requiredMask)
+            {
+                return {};
+            }
+
+            if ((seen & (std::uint64_t{1} << 0)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_id{"Missing required key id"};
+                return boost::system::error_code{129, error_missing_field_id};
+            }
+
+            if ((seen & (std::uint64_t{1} << 1)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_status{"Missing required key status"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_status};
+            }
+
+            if ((seen & (std::uint64_t{1} << 2)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_type{"Missing required key type"};
+                return boost::system::error_code{129, error_missing_field_type};
+            }
+
+            if ((seen & (std::uint64_t{1} << 3)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_version{"Missing required key version"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_version};
+            }
+
+            if ((seen & (std::uint64_t{1} << 4)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_transport{
+                        "Missing required key transport"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_transport};
+            }
+
+            if ((seen & (std::uint64_t{1} << 5)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_createdAt{
+                        "Missing required key created_at"};
+                return boost::system::error_code{129,
+                                                 error_missing_field_createdAt};
+            }
+
+            if ((seen & (std::uint64_t{1} << 6)) == 0)
+            {
+                static const error::ApplicationErrorCategory
+                    error_missing_field_cost{"Missing required key cost"};
+                return boost::system::error_code{129, error_missing_field_cost};
+            }
+
+            return {};
+        },
+    };
+
+    return sink;
+}
 // DESERIALIZATION IMPLEMENTATION END
 
 }  // namespace eventsub::payload::subscription
@@ -0,0 +1,29 @@
+#include "twitch-eventsub-ws/reconnect.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+namespace eventsub {
+
+std::chrono::milliseconds reconnectDelay(const ReconnectOptions &options,
+                                         std::size_t attempt,
+                                         std::minstd_rand &random)
+{
+    // Doubling past 2^16 can't stay below any sensible maxDelay anyway
+    const auto factor = std::chrono::milliseconds::rep{1}
+                        << std::min<std::size_t>(attempt, 16);
+    const auto limit =
+        std::min(options.initialDelay * factor, options.maxDelay);
+    if (limit.count() <= 0)
+    {
+        return std::chrono::milliseconds{0};
+    }
+
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution(
+        0, limit.count());
+    return std::chrono::milliseconds{distribution(random)};
+}
+
+}  // namespace eventsub
@@ -0,0 +1,29 @@
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+
+namespace eventsub::sax {
+
+struct Parser::Impl {
+    boost::json::basic_parser<Handler> parser{boost::json::parse_options{}};
+};
+
+Parser::Parser()
+    : impl(std::make_unique<Impl>())
+{
+}
+
+Parser::~Parser() = default;
+
+boost::json::error_code Parser::parse(std::string_view json, Slot root)
+{
+    auto &parser = this->impl->parser;
+
+    boost::json::error_code ec;
+    parser.reset();
+    parser.handler().reset(root);
+    parser.write_some(false, json.data(), json.size(), ec);
+    return ec;
+}
+
+}  // namespace eventsub::sax
@@ -0,0 +1,341 @@
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <simdjson.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace eventsub::sax {
+
+namespace {
+
+class SimdjsonErrorCategory final : public boost::system::error_category
+{
+public:
+    const char *name() const noexcept override
+    {
+        return "simdjson";
+    }
+
+    std::string message(int ev) const override
+    {
+        return simdjson::error_message(static_cast<simdjson::error_code>(ev));
+    }
+};
+
+const SimdjsonErrorCategory &simdjsonCategory()
+{
+    static const SimdjsonErrorCategory category;
+    return category;
+}
+
+boost::json::error_code toErrorCode(simdjson::error_code error)
+{
+    return boost::system::error_code{static_cast<int>(error),
+                                     simdjsonCategory()};
+}
+
+/**
+ * Walks a value with the On Demand API and forwards it to the sinks, the same
+ * way Handler does for Boost.JSON's callbacks.
+ *
+ * Values without a sink are never looked at; simdjson skips them when it
+ * moves on to the next value.
+ **/
+class Walker
+{
+public:
+    Walker(std::string_view _json, const std::vector<char> &_padded)
+        : json(_json)
+        , padded(_padded)
+    {
+    }
+
+    boost::json::error_code walk(simdjson::ondemand::value value, Slot slot)
+    {
+        if (slot.sink == nullptr)
+        {
+            return {};
+        }
+
+        simdjson::ondemand::json_type type;
+        if (auto error = value.type().get(type))
+        {
+            return toErrorCode(error);
+        }
+
+        if (type == simdjson::ondemand::json_type::null)
+        {
+            if (!value.is_null())
+            {
+                return toErrorCode(simdjson::N_ATOM_ERROR);
+            }
+            return slot.sink->onNull(slot.target);
+        }
+
+        while (slot.sink->kind() == Sink::Kind::Optional)
+        {
+            slot = slot.sink->emplace(slot.target);
+        }
+
+        switch (type)
+        {
+            case simdjson::ondemand::json_type::object:
+                return this->walkObject(value, slot);
+
+            case simdjson::ondemand::json_type::array:
+                return this->walkArray(value, slot);
+
+            case simdjson::ondemand::json_type::string:
+                return this->walkString(value, slot);
+
+            case simdjson::ondemand::json_type::number:
+                return walkNumber(value, slot);
+
+            case simdjson::ondemand::json_type::boolean: {
+                bool b = false;
+                if (auto error = value.get_bool().get(b))
+                {
+                    return toErrorCode(error);
+                }
+                return slot.sink->onBool(slot.target, b);
+            }
+
+            default:
+                return unexpectedType();
+        }
+    }
+
+private:
+    boost::json::error_code walkObject(simdjson::ondemand::value value,
+                                       Slot slot)
+    {
+        if (slot.sink->kind() != Sink::Kind::Object)
+        {
+            return unexpectedType();
+        }
+
+        simdjson::ondemand::object object;
+        if (auto error = value.get_object().get(object))
+        {
+            return toErrorCode(error);
+        }
+
+        std::uint64_t seen = 0;
+        for (auto result : object)
+        {
+            simdjson::ondemand::field field;
+            if (auto error = std::move(result).get(field))
+            {
+                return toErrorCode(error);
+            }
+
+            std::string_view key;
+            if (auto error = field.unescaped_key().get(key))
+            {
+                return toErrorCode(error);
+            }
+
+            Slot next;
+            if (auto ec = slot.sink->onKey(slot.target, key, seen, next))
+            {
+                return ec;
+            }
+
+            if (auto ec = this->walk(field.value(), next))
+            {
+                return ec;
+            }
+        }
+
+        return slot.sink->onObjectEnd(slot.target, seen);
+    }
+
+    boost::json::error_code walkArray(simdjson::ondemand::value value,
+                                      Slot slot)
+    {
+        if (slot.sink->kind() != Sink::Kind::Array)
+        {
+            return unexpectedType();
+        }
+
+        simdjson::ondemand::array array;
+        if (auto error = value.get_array().get(array))
+        {
+            return toErrorCode(error);
+        }
+
+        slot.sink->onArrayBegin(slot.target);
+        for (auto result : array)
+        {
+            simdjson::ondemand::value element;
+            if (auto error = std::move(result).get(element))
+            {
+                return toErrorCode(error);
+            }
+
+            if (auto ec =
+                    this->walk(element, slot.sink->onElement(slot.target)))
+            {
+                return ec;
+            }
+        }
+
+        return {};
+    }
+
+    boost::json::error_code walkString(simdjson::ondemand::value value,
+                                       Slot slot)
+    {
+        // The raw token is the quoted string followed by any whitespace
+        auto token = value.raw_json_token();
+        const auto end = token.rfind('"');
+        if (end != std::string_view::npos && end > 0)
+        {
+            const auto raw = token.substr(1, end - 1);
+            if (raw.find('\\') == std::string_view::npos)
+            {
+                // Nothing to unescape, so hand out a view into the original
+                // document instead of our padded copy of it
+                const auto offset =
+                    static_cast<std::size_t>(raw.data() - this->padded.data());
+                return slot.sink->onString(
+                    slot.target, this->json.substr(offset, raw.size()));
+            }
+        }
+
+        std::string_view s;
+        if (auto error = value.get_string().get(s))
+        {
+            return toErrorCode(error);
+        }
+        return slot.sink->onString(slot.target, s);
+    }
+
+    static boost::json::error_code walkNumber(simdjson::ondemand::value value,
+                                              Slot slot)
+    {
+        simdjson::ondemand::number_type numberType;
+        if (auto error = value.get_number_type().get(numberType))
+        {
+            return toErrorCode(error);
+        }
+
+        // Like with Boost.JSON, none of our fields can hold anything other
+        // than a signed 64-bit integer
+        if (numberType != simdjson::ondemand::number_type::signed_integer)
+        {
+            return unexpectedType();
+        }
+
+        std::int64_t i = 0;
+        if (auto error = value.get_int64().get(i))
+        {
+            return toErrorCode(error);
+        }
+        return slot.sink->onInt64(slot.target, i);
+    }
+
+    const std::string_view json;
+    const std::vector<char> &padded;
+};
+
+}  // namespace
+
+struct Parser::Impl {
+    simdjson::ondemand::parser parser;
+
+    // simdjson needs SIMDJSON_PADDING readable bytes after the document, which
+    // a websocket frame doesn't have, so every document is copied in here
+    std::vector<char> padded;
+
+    // The document that was last indexed into padded.
+    // A message is usually parsed more than once (its metadata, then maybe its
+    // broadcaster, then its payload), so parsing the same JSON again rewinds
+    // this instead of copying & indexing it again
+    simdjson::ondemand::document document;
+    std::size_t size = 0;
+    bool loaded = false;
+
+    simdjson::error_code load(std::string_view json);
+};
+
+simdjson::error_code Parser::Impl::load(std::string_view json)
+{
+    // Comparing the bytes is much cheaper than indexing them again
+    if (this->loaded && this->size == json.size() &&
+        std::memcmp(this->padded.data(), json.data(), json.size()) == 0 &&
+        this->document.is_alive())
+    {
+        this->document.rewind();
+        return simdjson::SUCCESS;
+    }
+
+    this->loaded = false;
+    this->padded.resize(json.size() + simdjson::SIMDJSON_PADDING);
+    std::memcpy(this->padded.data(), json.data(), json.size());
+    std::memset(this->padded.data() + json.size(), 0,
+                simdjson::SIMDJSON_PADDING);
+
+    if (auto error =
+            this->parser
+                .iterate(this->padded.data(), json.size(), this->padded.size())
+                .get(this->document))
+    {
+        return error;
+    }
+
+    this->size = json.size();
+    this->loaded = true;
+    return simdjson::SUCCESS;
+}
+
+Parser::Parser()
+    : impl(std::make_unique<Impl>())
+{
+}
+
+Parser::~Parser() = default;
+
+boost::json::error_code Parser::parse(std::string_view json, Slot root)
+{
+    auto &impl = *this->impl;
+    if (auto error = impl.load(json))
+    {
+        return toErrorCode(error);
+    }
+
+    auto ec = [&]() -> boost::json::error_code {
+        simdjson::ondemand::value value;
+        if (auto error = impl.document.get_value().get(value))
+        {
+            return toErrorCode(error);
+        }
+
+        Walker walker(json, impl.padded);
+        if (auto ec = walker.walk(value, root))
+        {
+            return ec;
+        }
+
+        if (!impl.document.at_end())
+        {
+            return toErrorCode(simdjson::TRAILING_CONTENT);
+        }
+
+        return {};
+    }();
+
+    // Errors from the sinks (e.g. to stop once the metadata has been read)
+    // leave the document intact, but simdjson's own errors may not
+    if (ec && ec.category() == simdjsonCategory())
+    {
+        impl.loaded = false;
+    }
+
+    return ec;
+}
+
+}  // namespace eventsub::sax
@@ -0,0 +1,449 @@
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include "twitch-eventsub-ws/chrono.hpp"
+#include "twitch-eventsub-ws/errors.hpp"
+
+#include <boost/json.hpp>
+
+#include <limits>
+#include <utility>
+
+namespace eventsub::sax {
+
+namespace {
+
+class StringSink final : public Sink
+{
+public:
+    boost::json::error_code onString(void *target,
+                                     std::string_view value) const override
+    {
+        static_cast<std::string *>(target)->assign(value);
+        return {};
+    }
+};
+
+class StringViewSink final : public Sink
+{
+public:
+    boost::json::error_code onString(void *target,
+                                     std::string_view value) const override
+    {
+        *static_cast<std::string_view *>(target) = value;
+        return {};
+    }
+};
+
+class IntSink final : public Sink
+{
+public:
+    boost::json::error_code onInt64(void *target,
+                                    std::int64_t value) const override
+    {
+        if (value < std::numeric_limits<int>::min() ||
+            value > std::numeric_limits<int>::max())
+        {
+            static const error::ApplicationErrorCategory errorOutOfRange{
+                "Number does not fit in an int"};
+            return boost::system::error_code{129, errorOutOfRange};
+        }
+
+        *static_cast<int *>(target) = static_cast<int>(value);
+        return {};
+    }
+};
+
+class BoolSink final : public Sink
+{
+public:
+    boost::json::error_code onBool(void *target, bool value) const override
+    {
+        *static_cast<bool *>(target) = value;
+        return {};
+    }
+};
+
+class ISO8601Sink final : public Sink
+{
+public:
+    boost::json::error_code onString(void *target,
+                                     std::string_view value) const override
+    {
+        *static_cast<std::chrono::system_clock::time_point *>(target) =
+            parseISO8601(value);
+        return {};
+    }
+};
+
+}  // namespace
+
+boost::json::error_code unexpectedType()
+{
+    static const error::ApplicationErrorCategory errorUnexpectedType{
+        "Unexpected JSON type"};
+    return boost::system::error_code{129, errorUnexpectedType};
+}
+
+boost::json::error_code Sink::onKey(void * /*target*/, std::string_view /*key*/,
+                                    std::uint64_t & /*seen*/,
+                                    Slot & /*next*/) const
+{
+    return unexpectedType();
+}
+
+boost::json::error_code Sink::onObjectEnd(void * /*target*/,
+                                          std::uint64_t /*seen*/) const
+{
+    return {};
+}
+
+void Sink::onArrayBegin(void * /*target*/) const
+{
+}
+
+Slot Sink::onElement(void * /*target*/) const
+{
+    return {};
+}
+
+Slot Sink::emplace(void *target) const
+{
+    return {target, this};
+}
+
+boost::json::error_code Sink::onString(void * /*target*/,
+                                       std::string_view /*value*/) const
+{
+    return unexpectedType();
+}
+
+boost::json::error_code Sink::onInt64(void * /*target*/,
+                                      std::int64_t /*value*/) const
+{
+    return unexpectedType();
+}
+
+boost::json::error_code Sink::onBool(void * /*target*/, bool /*value*/) const
+{
+    return unexpectedType();
+}
+
+boost::json::error_code Sink::onNull(void * /*target*/) const
+{
+    return unexpectedType();
+}
+
+const Sink &saxSink(SinkTag<std::string> /*tag*/)
+{
+    static const StringSink sink;
+    return sink;
+}
+
+const Sink &saxSink(SinkTag<std::string_view> /*tag*/)
+{
+    static const StringViewSink sink;
+    return sink;
+}
+
+const Sink &saxSink(SinkTag<int> /*tag*/)
+{
+    static const IntSink sink;
+    return sink;
+}
+
+const Sink &saxSink(SinkTag<bool> /*tag*/)
+{
+    static const BoolSink sink;
+    return sink;
+}
+
+const Sink &saxSink(SinkTag<std::chrono::system_clock::time_point> /*tag*/,
+                    const AsISO8601 & /*tag*/)
+{
+    static const ISO8601Sink sink;
+    return sink;
+}
+
+void Handler::reset(Slot root)
+{
+    this->stack.clear();
+    this->next = root;
+    this->skipDepth = 0;
+    this->parts.clear();
+}
+
+Slot Handler::nextSlot()
+{
+    if (!this->stack.empty())
+    {
+        const auto &top = this->stack.back();
+        if (top.slot.sink->kind() == Sink::Kind::Array)
+        {
+            return top.slot.sink->onElement(top.slot.target);
+        }
+    }
+
+    return std::exchange(this->next, {});
+}
+
+Slot Handler::nextValueSlot()
+{
+    auto slot = this->nextSlot();
+    while (slot.sink != nullptr && slot.sink->kind() == Sink::Kind::Optional)
+    {
+        slot = slot.sink->emplace(slot.target);
+    }
+
+    return slot;
+}
+
+std::string_view Handler::joinParts(boost::json::string_view s)
+{
+    if (this->parts.empty())
+    {
+        return {s.data(), s.size()};
+    }
+
+    this->parts.append(s.data(), s.size());
+    return this->parts;
+}
+
+bool Handler::on_document_begin(boost::json::error_code & /*ec*/)
+{
+    return true;
+}
+
+bool Handler::on_document_end(boost::json::error_code & /*ec*/)
+{
+    return true;
+}
+
+bool Handler::on_object_begin(boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        this->skipDepth++;
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink == nullptr)
+    {
+        this->skipDepth = 1;
+        return true;
+    }
+
+    if (slot.sink->kind() != Sink::Kind::Object)
+    {
+        ec = unexpectedType();
+        return false;
+    }
+
+    this->stack.push_back({slot});
+    return true;
+}
+
+bool Handler::on_object_end(std::size_t /*n*/, boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        this->skipDepth--;
+        return true;
+    }
+
+    const auto frame = this->stack.back();
+    this->stack.pop_back();
+
+    ec = frame.slot.sink->onObjectEnd(frame.slot.target, frame.seen);
+    return !ec;
+}
+
+bool Handler::on_array_begin(boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        this->skipDepth++;
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink == nullptr)
+    {
+        this->skipDepth = 1;
+        return true;
+    }
+
+    if (slot.sink->kind() != Sink::Kind::Array)
+    {
+        ec = unexpectedType();
+        return false;
+    }
+
+    slot.sink->onArrayBegin(slot.target);
+    this->stack.push_back({slot});
+    return true;
+}
+
+bool Handler::on_array_end(std::size_t /*n*/, boost::json::error_code & /*ec*/)
+{
+    if (this->skipDepth > 0)
+    {
+        this->skipDepth--;
+        return true;
+    }
+
+    this->stack.pop_back();
+    return true;
+}
+
+bool Handler::on_key_part(boost::json::string_view s, std::size_t /*n*/,
+                          boost::json::error_code & /*ec*/)
+{
+    if (this->skipDepth == 0)
+    {
+        this->parts.append(s.data(), s.size());
+    }
+    return true;
+}
+
+bool Handler::on_key(boost::json::string_view s, std::size_t /*n*/,
+                     boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto &top = this->stack.back();
+    ec = top.slot.sink->onKey(top.slot.target, this->joinParts(s), top.seen,
+                              this->next);
+    this->parts.clear();
+    return !ec;
+}
+
+bool Handler::on_string_part(boost::json::string_view s, std::size_t /*n*/,
+                             boost::json::error_code & /*ec*/)
+{
+    if (this->skipDepth == 0)
+    {
+        this->parts.append(s.data(), s.size());
+    }
+    return true;
+}
+
+bool Handler::on_string(boost::json::string_view s, std::size_t /*n*/,
+                        boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = slot.sink->onString(slot.target, this->joinParts(s));
+    }
+    this->parts.clear();
+    return !ec;
+}
+
+bool Handler::on_number_part(boost::json::string_view /*s*/,
+                             boost::json::error_code & /*ec*/)
+{
+    return true;
+}
+
+bool Handler::on_int64(std::int64_t i, boost::json::string_view /*s*/,
+                       boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = slot.sink->onInt64(slot.target, i);
+    }
+    return !ec;
+}
+
+bool Handler::on_uint64(std::uint64_t /*u*/, boost::json::string_view /*s*/,
+                        boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    // We're only given numbers that don't fit in an int64, which none of our
+    // fields can hold
+    auto slot = this->nextValueSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = unexpectedType();
+    }
+    return !ec;
+}
+
+bool Handler::on_double(double /*d*/, boost::json::string_view /*s*/,
+                        boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = unexpectedType();
+    }
+    return !ec;
+}
+
+bool Handler::on_bool(bool b, boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto slot = this->nextValueSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = slot.sink->onBool(slot.target, b);
+    }
+    return !ec;
+}
+
+bool Handler::on_null(boost::json::error_code &ec)
+{
+    if (this->skipDepth > 0)
+    {
+        return true;
+    }
+
+    auto slot = this->nextSlot();
+    if (slot.sink != nullptr)
+    {
+        ec = slot.sink->onNull(slot.target);
+    }
+    return !ec;
+}
+
+bool Handler::on_comment_part(boost::json::string_view /*s*/,
+                              boost::json::error_code & /*ec*/)
+{
+    return true;
+}
+
+bool Handler::on_comment(boost::json::string_view /*s*/,
+                         boost::json::error_code & /*ec*/)
+{
+    return true;
+}
+
+}  // namespace eventsub::sax
@@ -0,0 +1,308 @@
+#include "twitch-eventsub-ws/session-pool.hpp"
+
+#include "twitch-eventsub-ws/listener.hpp"
+
+#include <boost/asio.hpp>
+#include <boost/json.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace eventsub {
+
+// The listener of one session of the pool. Tells the pool when its session
+// connects or disconnects, and forwards everything to the pool's listener
+class SessionPool::SlotListener final : public Listener
+{
+public:
+    SlotListener(SessionPool &_pool, std::size_t _index)
+        : pool(_pool)
+        , index(_index)
+    {
+    }
+
+    void onSessionWelcome(const messages::Metadata &metadata,
+                          payload::session_welcome::Payload &&payload) override
+    {
+        this->pool.onSessionWelcome(this->index, payload.id);
+        this->pool.listener->onSessionWelcome(metadata, std::move(payload));
+    }
+
+    void onSessionReconnect(
+        const messages::Metadata &metadata,
+        payload::session_reconnect::Payload &&payload) override
+    {
+        this->pool.listener->onSessionReconnect(metadata, std::move(payload));
+    }
+
+    void onRevocation(const messages::Metadata &metadata,
+                      const boost::json::value &jv) override
+    {
+        this->pool.listener->onRevocation(metadata, jv);
+    }
+
+    void onDisconnected(const boost::system::error_code &ec) override
+    {
+        this->pool.onDisconnected(this->index);
+        this->pool.listener->onDisconnected(ec);
+    }
+
+    bool wantsNotificationJSON() const override
+    {
+        return this->pool.listener->wantsNotificationJSON();
+    }
+
+    void onNotification(const messages::Metadata &metadata,
+                        const boost::json::value &jv) override
+    {
+        this->pool.listener->onNotification(metadata, jv);
+    }
+
+    // Subscription types
+    void onChannelBan(const messages::Metadata &metadata,
+                      payload::channel_ban::v1::Payload &&payload) override
+    {
+        this->pool.listener->onChannelBan(metadata, std::move(payload));
+    }
+
+    void onStreamOnline(const messages::Metadata &metadata,
+                        payload::stream_online::v1::Payload &&payload) override
+    {
+        this->pool.listener->onStreamOnline(metadata, std::move(payload));
+    }
+
+    void onStreamOffline(
+        const messages::Metadata &metadata,
+        payload::stream_offline::v1::Payload &&payload) override
+    {
+        this->pool.listener->onStreamOffline(metadata, std::move(payload));
+    }
+
+    void onChannelChatNotification(
+        const messages::Metadata &metadata,
+        payload::channel_chat_notification::v1::Payload &&payload) override
+    {
+        this->pool.listener->onChannelChatNotification(metadata,
+                                                       std::move(payload));
+    }
+
+    void onChannelUpdate(
+        const messages::Metadata &metadata,
+        payload::channel_update::v1::Payload &&payload) override
+    {
+        this->pool.listener->onChannelUpdate(metadata, std::move(payload));
+    }
+
+    void onChannelChatMessage(
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) override
+    {
+        this->pool.listener->onChannelChatMessage(metadata, std::move(payload));
+    }
+
+    // Add your new subscription types above this line
+
+private:
+    SessionPool &pool;
+    const std::size_t index;
+};
+
+SessionPool::SessionPool(boost::asio::ssl::context &ctx,
+                         std::unique_ptr<Listener> _listener,
+                         SessionPoolOptions _options)
+    : options(std::move(_options))
+    , listener(std::move(_listener))
+    , ioc(static_cast<int>(std::max<std::size_t>(this->options.threads, 1)))
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(options.sessions, 1); i++)
+    {
+        auto session = std::make_shared<Session>(
+            this->ioc, ctx, std::make_unique<SlotListener>(*this, i));
+        session->setReconnect(this->options.reconnect);
+        this->slots.push_back({.session = std::move(session)});
+    }
+}
+
+SessionPool::~SessionPool()
+{
+    // The sessions' listeners point at us, so no handler may run after this
+    this->work.reset();
+    this->ioc.stop();
+    for (auto &thread : this->threads)
+    {
+        thread.join();
+    }
+}
+
+void SessionPool::setSubscriber(Subscriber _subscriber)
+{
+    this->subscriber = std::move(_subscriber);
+}
+
+void SessionPool::run(std::string host, std::string port, std::string path,
+                      std::string userAgent)
+{
+    for (auto &slot : this->slots)
+    {
+        slot.session->run(host, port, path, userAgent);
+    }
+
+    this->work.emplace(this->ioc.get_executor());
+    for (std::size_t i = 0; i < std::max<std::size_t>(this->options.threads, 1);
+         i++)
+    {
+        this->threads.emplace_back([this] {
+            this->ioc.run();
+        });
+    }
+}
+
+bool SessionPool::subscribe(SubscriptionRequest request)
+{
+    std::vector<Placement> placements;
+    {
+        std::lock_guard lock(this->mutex);
+        this->place(std::move(request), this->slots.size(), placements);
+    }
+
+    const bool placed = !placements.empty();
+    this->callSubscriber(placements);
+    return placed;
+}
+
+std::size_t SessionPool::getConnectionCount() const
+{
+    std::lock_guard lock(this->mutex);
+    return static_cast<std::size_t>(std::count_if(
+        this->slots.begin(), this->slots.end(), [](const auto &slot) {
+            return !slot.sessionID.empty();
+        }));
+}
+
+std::vector<SessionLoad> SessionPool::getSessionLoads() const
+{
+    std::lock_guard lock(this->mutex);
+
+    std::vector<SessionLoad> loads;
+    loads.reserve(this->slots.size());
+    for (const auto &slot : this->slots)
+    {
+        loads.push_back({
+            .sessionID = slot.sessionID,
+            .subscriptions = slot.subscriptions.size(),
+            .cost = slot.cost,
+            .deliveredFrames = slot.session->getDeliveredFrames(),
+        });
+    }
+    return loads;
+}
+
+std::size_t SessionPool::getPendingSubscriptions() const
+{
+    std::lock_guard lock(this->mutex);
+    return this->pending.size();
+}
+
+void SessionPool::onSessionWelcome(std::size_t index,
+                                   std::string_view sessionID)
+{
+    std::vector<Placement> placements;
+    {
+        std::lock_guard lock(this->mutex);
+        auto &slot = this->slots[index];
+        slot.sessionID = sessionID;
+
+        // Subscriptions that were waiting for room
+        auto waiting = std::exchange(this->pending, {});
+        for (auto &request : waiting)
+        {
+            this->place(std::move(request), this->slots.size(), placements);
+        }
+    }
+
+    this->callSubscriber(placements);
+}
+
+void SessionPool::onDisconnected(std::size_t index)
+{
+    std::vector<Placement> placements;
+    {
+        std::lock_guard lock(this->mutex);
+        auto &slot = this->slots[index];
+        slot.sessionID.clear();
+        slot.cost = 0;
+
+        // Twitch dropped them along with the connection
+        auto orphans = std::exchange(slot.subscriptions, {});
+        for (auto &request : orphans)
+        {
+            this->place(std::move(request), index, placements);
+        }
+    }
+
+    this->callSubscriber(placements);
+}
+
+std::optional<std::size_t> SessionPool::findSlot(
+    const SubscriptionRequest &request, std::size_t excluded) const
+{
+    std::optional<std::size_t> best;
+    for (std::size_t i = 0; i < this->slots.size(); i++)
+    {
+        const auto &slot = this->slots[i];
+        if (i == excluded || slot.sessionID.empty() ||
+            slot.subscriptions.size() >=
+                this->options.maxSubscriptionsPerSession)
+        {
+            continue;
+        }
+        if (this->options.maxCostPerSession != 0 &&
+            slot.cost + request.cost > this->options.maxCostPerSession)
+        {
+            continue;
+        }
+
+        if (!best || slot.cost < this->slots[*best].cost)
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void SessionPool::place(SubscriptionRequest &&request, std::size_t excluded,
+                        std::vector<Placement> &placements)
+{
+    const auto index = this->findSlot(request, excluded);
+    if (!index)
+    {
+        this->pending.push_back(std::move(request));
+        return;
+    }
+
+    auto &slot = this->slots[*index];
+    slot.cost += request.cost;
+    placements.push_back({slot.sessionID, request});
+    slot.subscriptions.push_back(std::move(request));
+}
+
+void SessionPool::callSubscriber(std::vector<Placement> &placements)
+{
+    if (!this->subscriber)
+    {
+        return;
+    }
+
+    for (const auto &placement : placements)
+    {
+        this->subscriber(placement.sessionID, placement.request);
+    }
+}
+
+}  // namespace eventsub
@@ -0,0 +1,105 @@
+#include "twitch-eventsub-ws/timestamp.hpp"
+
+#include "twitch-eventsub-ws/chrono.hpp"
+
+#include <utility>
+
+namespace eventsub {
+
+namespace {
+
+class TimestampSink final : public sax::Sink
+{
+public:
+    boost::json::error_code onString(void *target,
+                                     std::string_view value) const override
+    {
+        static_cast<Timestamp *>(target)->assign(value);
+        return {};
+    }
+};
+
+}  // namespace
+
+Timestamp::Timestamp(std::string _raw)
+    : rawTimestamp(std::move(_raw))
+{
+}
+
+Timestamp::Timestamp(const Timestamp &other)
+    : rawTimestamp(other.rawTimestamp)
+    , parsed(other.parsed.load(std::memory_order_relaxed))
+{
+}
+
+Timestamp::Timestamp(Timestamp &&other) noexcept
+    : rawTimestamp(std::move(other.rawTimestamp))
+    , parsed(other.parsed.load(std::memory_order_relaxed))
+{
+}
+
+Timestamp &Timestamp::operator=(const Timestamp &other)
+{
+    this->rawTimestamp = other.rawTimestamp;
+    this->parsed.store(other.parsed.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    return *this;
+}
+
+Timestamp &Timestamp::operator=(Timestamp &&other) noexcept
+{
+    this->rawTimestamp = std::move(other.rawTimestamp);
+    this->parsed.store(other.parsed.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    return *this;
+}
+
+const std::string &Timestamp::raw() const noexcept
+{
+    return this->rawTimestamp;
+}
+
+std::chrono::system_clock::time_point Timestamp::timePoint() const
+{
+    auto rep = this->parsed.load(std::memory_order_relaxed);
+    if (rep == NOT_PARSED)
+    {
+        rep = parseISO8601(this->rawTimestamp).time_since_epoch().count();
+        this->parsed.store(rep, std::memory_order_relaxed);
+    }
+
+    return std::chrono::system_clock::time_point{
+        std::chrono::system_clock::duration{rep}};
+}
+
+bool Timestamp::isParsed() const noexcept
+{
+    return this->parsed.load(std::memory_order_relaxed) != NOT_PARSED;
+}
+
+void Timestamp::assign(std::string_view newRaw)
+{
+    this->rawTimestamp.assign(newRaw);
+    this->parsed.store(NOT_PARSED, std::memory_order_relaxed);
+}
+
+boost::json::result_for<Timestamp, boost::json::value>::type tag_invoke(
+    boost::json::try_value_to_tag<Timestamp> /*tag*/,
+    const boost::json::value &jvRoot)
+{
+    const auto *raw = jvRoot.if_string();
+    if (raw == nullptr)
+    {
+        return boost::json::error_code{boost::json::error::not_string};
+    }
+
+    return Timestamp{std::string{raw->data(), raw->size()}};
+}
+
+const sax::Sink &saxSink(sax::SinkTag<Timestamp> /*tag*/)
+{
+    static const TimestampSink sink;
+    return sink;
+}
+
+}  // namespace eventsub
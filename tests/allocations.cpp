@@ -0,0 +1,118 @@
+#include "support/allocation-counter.hpp"
+#include "support/corpus.hpp"
+#include "support/frames.hpp"
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/frame-arena.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+// Parse a frame the way the session does when the listener wants its JSON
+bool parseFrame(const std::string &frame, FrameArena &arena,
+                boost::json::stream_parser &parser)
+{
+    boost::json::error_code ec;
+    parser.reset(&arena);
+    parser.write(frame.data(), frame.size(), ec);
+    if (!ec)
+    {
+        parser.finish(ec);
+    }
+
+    if (!ec)
+    {
+        const auto jv = parser.release();
+        EXPECT_TRUE(jv.is_object());
+    }
+
+    arena.reset();
+
+    return !ec;
+}
+
+}  // namespace
+
+TEST(Allocations, SteadyStateFramesDontAllocate)
+{
+    const auto frames = test::loadChatMessageFrames();
+    ASSERT_FALSE(frames.empty());
+
+    FrameArena arena;
+    boost::json::stream_parser parser;
+
+    // Let the arena & the parser's stacks grow to fit the frames
+    for (const auto &frame : frames)
+    {
+        ASSERT_TRUE(parseFrame(frame, arena, parser));
+    }
+
+    const test::AllocationCounter counter;
+    for (int i = 0; i < 100; i++)
+    {
+        for (const auto &frame : frames)
+        {
+            ASSERT_TRUE(parseFrame(frame, arena, parser));
+        }
+    }
+    EXPECT_EQ(counter.allocations(), 0U);
+}
+
+TEST(Allocations, ArenaGrowsToFitFrames)
+{
+    // A frame that doesn't fit in a small block
+    std::string text(8 * 1024, 'a');
+    const auto frame =
+        test::chatMessageFrame("big", test::chatMessageEvent("11148817", text));
+
+    FrameArena arena(1024);
+    boost::json::stream_parser parser;
+
+    {
+        const test::AllocationCounter counter;
+        ASSERT_TRUE(parseFrame(frame, arena, parser));
+        EXPECT_GT(counter.allocations(), 0U);
+    }
+    EXPECT_GE(arena.blockSize(), arena.highWaterMark());
+
+    const test::AllocationCounter counter;
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(parseFrame(frame, arena, parser));
+    }
+    EXPECT_EQ(counter.allocations(), 0U);
+}
+
+TEST(Allocations, ReadingMetadataDoesntAllocate)
+{
+    const auto frames = test::loadChatMessageFrames();
+    sax::Parser parser;
+
+    for (const auto &frame : frames)
+    {
+        messages::MetadataView metadata;
+        ASSERT_TRUE(detail::readMetadata(frame, parser, metadata));
+        ASSERT_TRUE(readBroadcasterID(frame, parser));
+    }
+
+    const test::AllocationCounter counter;
+    for (int i = 0; i < 100; i++)
+    {
+        for (const auto &frame : frames)
+        {
+            messages::MetadataView metadata;
+            ASSERT_TRUE(detail::readMetadata(frame, parser, metadata));
+            ASSERT_TRUE(readBroadcasterID(frame, parser));
+        }
+    }
+    EXPECT_EQ(counter.allocations(), 0U);
+}
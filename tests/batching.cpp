@@ -0,0 +1,193 @@
+#include "twitch-eventsub-ws/batching.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+
+#include <boost/json.hpp>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+constexpr std::size_t FRAMES = 16;
+
+std::vector<std::string> chatMessageFrames(std::size_t count)
+{
+    std::vector<std::string> frames;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        frames.push_back(test::chatMessageFrame(
+            std::to_string(i),
+            test::chatMessageEvent("1001", "message " + std::to_string(i))));
+    }
+    return frames;
+}
+
+// Dispatch a frame to the batcher like the session does for listeners that
+// want the JSON of notifications
+void dispatchJSON(detail::Batcher<test::RecordingListener> &batcher,
+                  const std::string &frame)
+{
+    static const HandlerRegistry noHandlers;
+    const detail::Consumers<detail::Batcher<test::RecordingListener>> consumers{
+        batcher, noHandlers};
+
+    const auto jv = boost::json::parse(frame);
+    ASSERT_FALSE(detail::dispatchMessage(consumers, jv));
+}
+
+// The same for listeners that only want the typed payloads
+void dispatchDirectly(detail::Batcher<test::RecordingListener> &batcher,
+                      const std::string &frame)
+{
+    static const HandlerRegistry noHandlers;
+    const detail::Consumers<detail::Batcher<test::RecordingListener>> consumers{
+        batcher, noHandlers};
+
+    sax::Parser parser;
+    messages::MetadataView metadata;
+    ASSERT_TRUE(detail::readMetadata(frame, parser, metadata));
+
+    const auto ec = detail::dispatchNotificationDirectly(consumers, metadata,
+                                                         frame, parser);
+    ASSERT_TRUE(ec);
+    ASSERT_FALSE(*ec);
+}
+
+void expectInOrder(const test::RecordingListener::Recording &recording,
+                   std::size_t count)
+{
+    ASSERT_EQ(recording.chatMessages.size(), count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(recording.chatMessages[i].messageID, std::to_string(i));
+    }
+}
+
+}  // namespace
+
+TEST(Batching, BatchesNotificationsWithJSON)
+{
+    test::RecordingListener listener;
+    ASSERT_TRUE(listener.wantsNotificationJSON());
+    detail::Batcher batcher(listener);
+
+    for (const auto &frame : chatMessageFrames(FRAMES))
+    {
+        dispatchJSON(batcher, frame);
+    }
+
+    // The JSON can't wait, the payloads can
+    auto recording = listener.recording();
+    EXPECT_EQ(recording.notifications.size(), FRAMES);
+    EXPECT_TRUE(recording.chatMessages.empty());
+    EXPECT_EQ(batcher.size(), FRAMES);
+
+    batcher.flush();
+
+    recording = listener.recording();
+    EXPECT_EQ(recording.chatMessageBatches, std::vector<std::size_t>{FRAMES});
+    expectInOrder(recording, FRAMES);
+    EXPECT_EQ(batcher.size(), 0U);
+}
+
+TEST(Batching, BatchesNotificationsWithoutJSON)
+{
+    test::RecordingListener listener(false);
+    detail::Batcher batcher(listener);
+
+    for (const auto &frame : chatMessageFrames(FRAMES))
+    {
+        dispatchDirectly(batcher, frame);
+    }
+    EXPECT_EQ(batcher.size(), FRAMES);
+
+    batcher.flush();
+
+    const auto recording = listener.recording();
+    EXPECT_TRUE(recording.notifications.empty());
+    EXPECT_EQ(recording.chatMessageBatches, std::vector<std::size_t>{FRAMES});
+    expectInOrder(recording, FRAMES);
+}
+
+TEST(Batching, WelcomeDeliversTheBatchFirst)
+{
+    test::RecordingListener listener;
+    detail::Batcher batcher(listener);
+
+    for (const auto &frame : chatMessageFrames(3))
+    {
+        dispatchJSON(batcher, frame);
+    }
+    dispatchJSON(batcher, test::welcomeFrame("welcome", "session"));
+
+    const auto recording = listener.recording();
+    EXPECT_EQ(recording.chatMessageBatches, std::vector<std::size_t>{3});
+    EXPECT_EQ(recording.welcomes.size(), 1U);
+    EXPECT_EQ(batcher.size(), 0U);
+
+    // Nothing to deliver
+    batcher.flush();
+    EXPECT_EQ(listener.recording().chatMessageBatches.size(), 1U);
+}
+
+TEST(Batching, SessionDeliversFullBatches)
+{
+    test::ConnectedSession<> session;
+    session->setBatching({
+        .maxNotifications = FRAMES,
+        .maxDelay = std::chrono::seconds{30},
+    });
+    ASSERT_TRUE(session.connect());
+
+    for (const auto &frame : chatMessageFrames(FRAMES))
+    {
+        session.connection->send(frame);
+    }
+
+    // Long before maxDelay
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return !recording.chatMessageBatches.empty();
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.chatMessageBatches, std::vector<std::size_t>{FRAMES});
+    EXPECT_EQ(recording.notifications.size(), FRAMES);
+    expectInOrder(recording, FRAMES);
+}
+
+TEST(Batching, SessionDeliversBatchesAfterMaxDelay)
+{
+    test::ConnectedSession<> session;
+    session->setBatching({
+        .maxNotifications = FRAMES,
+        .maxDelay = std::chrono::milliseconds{50},
+    });
+    ASSERT_TRUE(session.connect());
+
+    for (const auto &frame : chatMessageFrames(3))
+    {
+        session.connection->send(frame);
+    }
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 3;
+    }));
+
+    // Frames that arrive more than maxDelay apart end up in different
+    // batches, but all of them are batched
+    const auto recording = session.listener.recording();
+    std::size_t batched = 0;
+    for (auto size : recording.chatMessageBatches)
+    {
+        batched += size;
+    }
+    EXPECT_EQ(batched, 3U);
+    expectInOrder(recording, 3);
+}
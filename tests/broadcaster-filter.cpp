@@ -0,0 +1,155 @@
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+std::optional<std::uint64_t> read(const std::string &frame)
+{
+    sax::Parser parser;
+    return readBroadcasterID(frame, parser);
+}
+
+}  // namespace
+
+TEST(BroadcasterFilter, ParsesUserIDs)
+{
+    EXPECT_EQ(parseUserID("0"), 0U);
+    EXPECT_EQ(parseUserID("11148817"), 11148817U);
+    EXPECT_EQ(parseUserID("18446744073709551615"), 18446744073709551615U);
+
+    EXPECT_EQ(parseUserID(""), std::nullopt);
+    EXPECT_EQ(parseUserID("pajlada"), std::nullopt);
+    EXPECT_EQ(parseUserID("123a"), std::nullopt);
+    EXPECT_EQ(parseUserID("-1"), std::nullopt);
+    EXPECT_EQ(parseUserID("18446744073709551616"), std::nullopt);
+}
+
+TEST(BroadcasterFilter, ReadsTheCondition)
+{
+    const auto frame = test::notificationFrame(
+        "a", "channel.chat.message", "1001",
+        test::chatMessageEvent("2002", "the event disagrees"));
+
+    // The condition comes first, so the event is never looked at
+    EXPECT_EQ(read(frame), 1001U);
+}
+
+TEST(BroadcasterFilter, ReadsTheEventIfItComesFirst)
+{
+    const auto frame =
+        R"({"metadata":)" +
+        test::metadataJSON("a", "notification", "channel.chat.message") +
+        R"(,"payload":{"event":)" + test::chatMessageEvent("2002", "hi") +
+        R"(,"subscription":{"condition":{"broadcaster_user_id":"1001"}}}})";
+
+    EXPECT_EQ(read(frame), 2002U);
+}
+
+TEST(BroadcasterFilter, ReadsFramesWithoutBroadcaster)
+{
+    EXPECT_EQ(read(test::welcomeFrame("a", "session")), std::nullopt);
+    EXPECT_EQ(read(test::keepaliveFrame("a")), std::nullopt);
+
+    // e.g. the optional broadcaster of channel.moderate
+    const std::string optional =
+        R"({"payload":{"subscription":)"
+        R"({"condition":{"broadcaster_user_id":null}}}})";
+    EXPECT_EQ(read(optional), std::nullopt);
+}
+
+TEST(BroadcasterFilter, RejectsNonNumericIDs)
+{
+    const auto frame =
+        test::notificationFrame("a", "channel.chat.message", "pajlada",
+                                test::chatMessageEvent("pajlada", "hi"));
+
+    EXPECT_EQ(read(frame), std::nullopt);
+    EXPECT_EQ(read(R"({"payload":{"event":{"broadcaster_user_id":1001}}})"),
+              std::nullopt);
+}
+
+TEST(BroadcasterFilter, RejectsInvalidJSON)
+{
+    EXPECT_EQ(read(R"({"payload":{"subscription":)"), std::nullopt);
+    EXPECT_EQ(read("not json"), std::nullopt);
+}
+
+TEST(BroadcasterFilter, WantsItsBroadcasters)
+{
+    BroadcasterFilter filter;
+    EXPECT_TRUE(filter.empty());
+    EXPECT_TRUE(filter.wants(1001));
+    EXPECT_TRUE(filter.wants(std::nullopt));
+
+    filter.setBroadcasters({"1001", "1003", "not-a-number"});
+    EXPECT_FALSE(filter.empty());
+    EXPECT_TRUE(filter.wants(1001));
+    EXPECT_FALSE(filter.wants(1002));
+    EXPECT_TRUE(filter.wants(1003));
+
+    // Messages that aren't about a broadcaster always pass
+    EXPECT_TRUE(filter.wants(std::nullopt));
+
+    filter.setBroadcasters({});
+    EXPECT_TRUE(filter.empty());
+    EXPECT_TRUE(filter.wants(1002));
+}
+
+TEST(BroadcasterFilter, NonNumericIDsMatchNothing)
+{
+    BroadcasterFilter filter;
+    filter.setBroadcasters({"pajlada"});
+
+    EXPECT_FALSE(filter.empty());
+    EXPECT_FALSE(filter.wants(1001));
+    EXPECT_TRUE(filter.wants(std::nullopt));
+}
+
+TEST(BroadcasterFilter, SessionCountsFilteredFrames)
+{
+    test::ConnectedSession<> session;
+    session->setBroadcasterFilter({"1001", "1003"});
+    ASSERT_TRUE(session.connect());
+
+    auto &connection = *session.connection;
+    connection.send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+    connection.send(
+        test::chatMessageFrame("2", test::chatMessageEvent("1002", "b")));
+    connection.send(
+        test::chatMessageFrame("3", test::chatMessageEvent("1002", "c")));
+    connection.send(
+        test::chatMessageFrame("4", test::chatMessageEvent("1003", "d")));
+
+    // Frames are handled in order, so the filtered ones are done by now
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 2;
+    }));
+
+    const auto recording = session.listener.recording();
+    ASSERT_EQ(recording.welcomes.size(), 1);
+    EXPECT_EQ(recording.welcomes[0], "session");
+    EXPECT_EQ(recording.chatMessages[0].messageID, "1");
+    EXPECT_EQ(recording.chatMessages[0].broadcasterID, "1001");
+    EXPECT_EQ(recording.chatMessages[1].messageID, "4");
+    EXPECT_EQ(recording.chatMessages[1].broadcasterID, "1003");
+
+    // Filtered notifications don't reach onNotification either
+    EXPECT_EQ(recording.notifications, (std::vector<std::string>{"1", "4"}));
+
+    EXPECT_EQ(session->getFilteredFrames(), 2);
+
+    // The welcome & the chat messages of 1001 and 1003
+    EXPECT_EQ(session->getDeliveredFrames(), 3);
+}
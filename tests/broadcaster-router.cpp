@@ -0,0 +1,293 @@
+#include "twitch-eventsub-ws/broadcaster-router.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+// Stands in for a listener, and remembers which broadcaster it was added for
+struct Channel {
+    explicit Channel(std::uint64_t _broadcasterID,
+                     std::atomic<std::size_t> *_destroyed = nullptr)
+        : broadcasterID(_broadcasterID)
+        , destroyed(_destroyed)
+    {
+    }
+
+    ~Channel()
+    {
+        if (this->destroyed != nullptr)
+        {
+            (*this->destroyed)++;
+        }
+    }
+
+    const std::uint64_t broadcasterID;
+    std::atomic<std::size_t> *destroyed;
+};
+
+using Router = BasicBroadcasterRouter<Channel>;
+
+std::unique_ptr<Channel> channel(std::uint64_t broadcasterID,
+                                 std::atomic<std::size_t> *destroyed = nullptr)
+{
+    return std::make_unique<Channel>(broadcasterID, destroyed);
+}
+
+}  // namespace
+
+TEST(BroadcasterRouter, FindsItsListeners)
+{
+    Router router{16};
+    Router::Reader reader{router};
+
+    EXPECT_TRUE(router.add(1001, channel(1001)));
+    EXPECT_TRUE(router.add("1002", channel(1002)));
+
+    ASSERT_NE(router.find(1001), nullptr);
+    EXPECT_EQ(router.find(1001)->broadcasterID, 1001);
+    ASSERT_NE(router.find(1002), nullptr);
+    EXPECT_EQ(router.find(1002)->broadcasterID, 1002);
+    EXPECT_EQ(router.find(1003), nullptr);
+    EXPECT_EQ(router.find(0), nullptr);
+}
+
+TEST(BroadcasterRouter, RejectsInvalidAdds)
+{
+    Router router{16};
+
+    EXPECT_TRUE(router.add(1001, channel(1001)));
+    EXPECT_FALSE(router.add(1001, channel(1001)));
+    EXPECT_FALSE(router.add(0, channel(0)));
+    EXPECT_FALSE(router.add("pajlada", channel(0)));
+    EXPECT_FALSE(router.remove(1002));
+    EXPECT_FALSE(router.remove("pajlada"));
+}
+
+TEST(BroadcasterRouter, DestroysRemovedListenersWithoutReaders)
+{
+    std::atomic<std::size_t> destroyed{0};
+    Router router{16};
+
+    ASSERT_TRUE(router.add(1001, channel(1001, &destroyed)));
+    ASSERT_TRUE(router.add(1002, channel(1002, &destroyed)));
+
+    {
+        Router::Reader reader{router};
+        auto *found = router.find(1001);
+        ASSERT_NE(found, nullptr);
+
+        EXPECT_TRUE(router.remove(1001));
+        EXPECT_FALSE(router.remove(1001));
+        EXPECT_EQ(router.find(1001), nullptr);
+
+        // The listener we found is still in use
+        router.collect();
+        EXPECT_EQ(destroyed, 0);
+        EXPECT_EQ(found->broadcasterID, 1001);
+    }
+
+    router.collect();
+    EXPECT_EQ(destroyed, 1);
+
+    // The slot is reused
+    EXPECT_TRUE(router.add(1001, channel(1001, &destroyed)));
+    EXPECT_NE(router.find(1001), nullptr);
+}
+
+TEST(BroadcasterRouter, DestroysRemovedListenersWhileReadersOverlap)
+{
+    std::atomic<std::size_t> destroyed{0};
+    Router router{16};
+
+    ASSERT_TRUE(router.add(1001, channel(1001, &destroyed)));
+    ASSERT_TRUE(router.add(1002, channel(1002, &destroyed)));
+
+    // Like workers delivering side by side, there's always a Reader alive
+    auto first = std::make_unique<Router::Reader>(router);
+    ASSERT_TRUE(router.remove(1001));
+    router.collect();
+    EXPECT_EQ(destroyed, 0);
+
+    auto second = std::make_unique<Router::Reader>(router);
+    first.reset();
+
+    // Only the first Reader could have found it
+    router.collect();
+    EXPECT_EQ(destroyed, 1);
+
+    ASSERT_TRUE(router.remove(1002));
+    router.collect();
+    EXPECT_EQ(destroyed, 1);
+
+    auto third = std::make_unique<Router::Reader>(router);
+    second.reset();
+    router.collect();
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST(BroadcasterRouter, IsLimitedToMaxBroadcasters)
+{
+    Router router{16};
+
+    for (std::uint64_t id = 1; id <= 16; id++)
+    {
+        ASSERT_TRUE(router.add(id, channel(id)));
+    }
+    EXPECT_FALSE(router.add(17, channel(17)));
+
+    ASSERT_TRUE(router.remove(1));
+    EXPECT_TRUE(router.add(17, channel(17)));
+    EXPECT_FALSE(router.add(18, channel(18)));
+}
+
+TEST(BroadcasterRouter, ChurnsThroughMoreBroadcastersThanItHolds)
+{
+    std::atomic<std::size_t> destroyed{0};
+    Router router{16};
+
+    // Half of the router is kept the whole time
+    for (std::uint64_t id = 1; id <= 8; id++)
+    {
+        ASSERT_TRUE(router.add(id, channel(id, &destroyed)));
+    }
+
+    // The other half keeps changing, many times over the size of the table
+    for (std::uint64_t id = 100; id < 10'100; id++)
+    {
+        ASSERT_TRUE(router.add(id, channel(id, &destroyed))) << id;
+        if (id >= 107)
+        {
+            ASSERT_TRUE(router.remove(id - 7)) << id;
+        }
+        router.collect();
+    }
+
+    Router::Reader reader{router};
+    for (std::uint64_t id = 1; id <= 8; id++)
+    {
+        ASSERT_NE(router.find(id), nullptr);
+        EXPECT_EQ(router.find(id)->broadcasterID, id);
+    }
+    for (std::uint64_t id = 10'093; id < 10'100; id++)
+    {
+        ASSERT_NE(router.find(id), nullptr);
+        EXPECT_EQ(router.find(id)->broadcasterID, id);
+    }
+    EXPECT_EQ(router.find(10'092), nullptr);
+    EXPECT_EQ(destroyed, 10'000 - 7);
+}
+
+TEST(BroadcasterRouter, ScalesTo100kChannels)
+{
+    constexpr std::uint64_t CHANNELS = 100'000;
+    constexpr std::uint64_t FIRST_ID = 11'148'817;
+
+    Router router{CHANNELS};
+    for (auto id = FIRST_ID; id < FIRST_ID + CHANNELS; id++)
+    {
+        ASSERT_TRUE(router.add(id, channel(id)));
+    }
+    EXPECT_FALSE(router.add(FIRST_ID + CHANNELS, channel(0)));
+
+    Router::Reader reader{router};
+    for (auto id = FIRST_ID; id < FIRST_ID + CHANNELS; id++)
+    {
+        auto *found = router.find(id);
+        ASSERT_NE(found, nullptr);
+        ASSERT_EQ(found->broadcasterID, id);
+    }
+    EXPECT_EQ(router.find(FIRST_ID - 1), nullptr);
+    EXPECT_EQ(router.find(FIRST_ID + CHANNELS), nullptr);
+}
+
+TEST(BroadcasterRouter, AddsAndRemovesWhileFinding)
+{
+    constexpr std::uint64_t STABLE = 64;
+    constexpr std::uint64_t CHURNING = 1'000;
+
+    std::atomic<std::size_t> destroyed{0};
+    Router router{128};
+    for (std::uint64_t id = 1; id <= STABLE; id++)
+    {
+        ASSERT_TRUE(router.add(id, channel(id, &destroyed)));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> mismatches{0};
+    std::atomic<std::size_t> missing{0};
+
+    // Like a session delivering notifications
+    std::thread finder([&] {
+        std::uint64_t i = 0;
+        while (!done)
+        {
+            {
+                Router::Reader reader{router};
+
+                const auto stable = 1 + (i % STABLE);
+                auto *found = router.find(stable);
+                if (found == nullptr)
+                {
+                    missing++;
+                }
+                else if (found->broadcasterID != stable)
+                {
+                    mismatches++;
+                }
+
+                const auto churning = 1'000 + (i % CHURNING);
+                if (auto *other = router.find(churning))
+                {
+                    if (other->broadcasterID != churning)
+                    {
+                        mismatches++;
+                    }
+                }
+            }
+
+            router.collect();
+            i++;
+        }
+    });
+
+    // Two threads churning through broadcasters of their own
+    auto churn = [&](std::uint64_t firstID) {
+        for (int round = 0; round < 20; round++)
+        {
+            for (auto id = firstID; id < firstID + CHURNING / 2; id++)
+            {
+                ASSERT_TRUE(router.add(id, channel(id, &destroyed)));
+                if (id >= firstID + 16)
+                {
+                    ASSERT_TRUE(router.remove(id - 16));
+                }
+            }
+            for (auto id = firstID + CHURNING / 2 - 16;
+                 id < firstID + CHURNING / 2; id++)
+            {
+                ASSERT_TRUE(router.remove(id));
+            }
+        }
+    };
+    std::thread first(churn, 1'000);
+    std::thread second(churn, 1'000 + CHURNING / 2);
+
+    first.join();
+    second.join();
+    done = true;
+    finder.join();
+
+    EXPECT_EQ(missing, 0);
+    EXPECT_EQ(mismatches, 0);
+
+    router.collect();
+    EXPECT_EQ(destroyed, 20 * CHURNING);
+}
@@ -0,0 +1,132 @@
+#include "twitch-eventsub-ws/chrono.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace eventsub;
+using namespace std::chrono_literals;
+
+namespace {
+
+// How timestamps were parsed before tryParseISO8601
+std::chrono::system_clock::time_point parseWithDate(std::string_view raw)
+{
+    std::istringstream in{std::string{raw}};
+    std::chrono::system_clock::time_point tp;
+    in >> date::parse("%FT%TZ", tp);
+
+    return tp;
+}
+
+}  // namespace
+
+TEST(Chrono, ParsesTwitchTimestamps)
+{
+    const std::string_view timestamps[] = {
+        "2023-05-14T12:31:47.995298776Z", "2019-11-16T10:11:12.464757833Z",
+        "2023-07-19T10:11:12.634234626Z", "2024-02-29T23:59:59.999999999Z",
+        "1970-01-01T00:00:00Z",           "2023-05-14T12:31:47Z",
+    };
+
+    for (auto raw : timestamps)
+    {
+        const auto tp = tryParseISO8601(raw);
+        ASSERT_TRUE(tp) << raw;
+        EXPECT_EQ(*tp, parseWithDate(raw)) << raw;
+        EXPECT_EQ(parseISO8601(raw), *tp) << raw;
+    }
+}
+
+TEST(Chrono, ParsesEveryFractionLength)
+{
+    std::string raw = "2023-05-14T12:31:47.";
+    const std::string digits = "123456789";
+
+    for (std::size_t length = 1; length <= digits.size(); length++)
+    {
+        const auto timestamp = raw + digits.substr(0, length) + "Z";
+
+        const auto tp = tryParseISO8601(timestamp);
+        ASSERT_TRUE(tp) << timestamp;
+        EXPECT_EQ(*tp, parseWithDate(timestamp)) << timestamp;
+    }
+}
+
+TEST(Chrono, MatchesDateParse)
+{
+    std::mt19937_64 random{1234};
+    // 1970 to 2100
+    std::uniform_int_distribution<std::int64_t> nanoseconds{
+        0, std::int64_t{4102444800} * 1'000'000'000};
+
+    for (int i = 0; i < 10000; i++)
+    {
+        const auto expected =
+            std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+                date::sys_time<std::chrono::nanoseconds>{
+                    std::chrono::nanoseconds{nanoseconds(random)}});
+        const auto raw = date::format(
+            "%FT%TZ", date::sys_time<std::chrono::nanoseconds>{expected});
+
+        const auto tp = tryParseISO8601(raw);
+        ASSERT_TRUE(tp) << raw;
+        EXPECT_EQ(*tp, expected) << raw;
+        EXPECT_EQ(*tp, parseWithDate(raw)) << raw;
+    }
+}
+
+TEST(Chrono, RejectsOtherLayouts)
+{
+    const std::string_view timestamps[] = {
+        "",
+        "2023-05-14",
+        "2023-05-14T12:31:47",
+        "2023-05-14 12:31:47Z",
+        "2023-05-14t12:31:47Z",
+        "2023/05/14T12:31:47Z",
+        "2023-05-14T12-31-47Z",
+        "2023-05-14T12:31:47+00:00",
+        "2023-05-14T12:31:47.Z",
+        "2023-05-14T12:31:47,5Z",
+        "2023-05-14T12:31:47.1234567890Z",
+        "2023-05-14T12:31:47.12a4Z",
+        "2023-5-14T12:31:47.123Z",
+        "+023-05-14T12:31:47Z",
+    };
+
+    for (auto raw : timestamps)
+    {
+        EXPECT_FALSE(tryParseISO8601(raw)) << raw;
+    }
+}
+
+TEST(Chrono, RejectsInvalidDates)
+{
+    const std::string_view timestamps[] = {
+        "2023-13-14T12:31:47Z", "2023-00-14T12:31:47Z", "2023-05-00T12:31:47Z",
+        "2023-04-31T12:31:47Z", "2023-02-29T12:31:47Z", "2100-02-29T12:31:47Z",
+        "2023-05-14T24:00:00Z", "2023-05-14T12:60:47Z", "2023-05-14T12:31:60Z",
+    };
+
+    for (auto raw : timestamps)
+    {
+        EXPECT_FALSE(tryParseISO8601(raw)) << raw;
+    }
+
+    EXPECT_TRUE(tryParseISO8601("2000-02-29T12:31:47Z"));
+}
+
+TEST(Chrono, FallsBackToDateParse)
+{
+    // Leap seconds aren't in the fast path's layout
+    const std::string_view raw = "2016-12-31T23:59:60Z";
+
+    EXPECT_FALSE(tryParseISO8601(raw));
+    EXPECT_EQ(parseISO8601(raw), parseWithDate(raw));
+}
@@ -0,0 +1,270 @@
+#include "support/corpus.hpp"
+#include "support/frames.hpp"
+#include "twitch-eventsub-ws/broadcaster-filter.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/payloads/channel-chat-message-v1.hpp"
+#include "twitch-eventsub-ws/payloads/session-reconnect.hpp"
+#include "twitch-eventsub-ws/payloads/session-welcome.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Runs the JSON parser this executable was built with over the sample
+ * messages, and checks that everything it reads matches what the
+ * Boost.JSON DOM (boost::json::parse + tag_invoke) reads.
+ *
+ * The suite is built once per parser, so comparing each of them to the DOM
+ * also makes sure they agree with each other
+ **/
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+
+namespace {
+
+void expectEqual(const payload::subscription::Subscription &a,
+                 const payload::subscription::Subscription &b)
+{
+    EXPECT_EQ(a.id, b.id);
+    EXPECT_EQ(a.status, b.status);
+    EXPECT_EQ(a.type, b.type);
+    EXPECT_EQ(a.version, b.version);
+    EXPECT_EQ(a.transport.method, b.transport.method);
+    EXPECT_EQ(a.transport.sessionID, b.transport.sessionID);
+    EXPECT_EQ(a.createdAt.raw(), b.createdAt.raw());
+    EXPECT_EQ(a.cost, b.cost);
+}
+
+void expectEqual(const chat::MessageFragment &a, const chat::MessageFragment &b)
+{
+    EXPECT_EQ(a.type, b.type);
+    EXPECT_EQ(a.text, b.text);
+
+    ASSERT_EQ(a.cheermote.has_value(), b.cheermote.has_value());
+    if (a.cheermote)
+    {
+        EXPECT_EQ(a.cheermote->prefix, b.cheermote->prefix);
+        EXPECT_EQ(a.cheermote->bits, b.cheermote->bits);
+        EXPECT_EQ(a.cheermote->tier, b.cheermote->tier);
+    }
+
+    ASSERT_EQ(a.emote.has_value(), b.emote.has_value());
+    if (a.emote)
+    {
+        EXPECT_EQ(a.emote->id, b.emote->id);
+        EXPECT_EQ(a.emote->emoteSetID, b.emote->emoteSetID);
+        EXPECT_EQ(a.emote->ownerID, b.emote->ownerID);
+        EXPECT_EQ(a.emote->format, b.emote->format);
+    }
+
+    ASSERT_EQ(a.mention.has_value(), b.mention.has_value());
+    if (a.mention)
+    {
+        EXPECT_EQ(a.mention->userID, b.mention->userID);
+        EXPECT_EQ(a.mention->userName, b.mention->userName);
+        EXPECT_EQ(a.mention->userLogin, b.mention->userLogin);
+    }
+}
+
+void expectEqual(const chat::Payload &a, const chat::Payload &b)
+{
+    expectEqual(a.subscription, b.subscription);
+
+    const auto &x = a.event;
+    const auto &y = b.event;
+    EXPECT_EQ(x.broadcasterUserID, y.broadcasterUserID);
+    EXPECT_EQ(x.broadcasterUserLogin, y.broadcasterUserLogin);
+    EXPECT_EQ(x.broadcasterUserName, y.broadcasterUserName);
+    EXPECT_EQ(x.chatterUserID, y.chatterUserID);
+    EXPECT_EQ(x.chatterUserLogin, y.chatterUserLogin);
+    EXPECT_EQ(x.chatterUserName, y.chatterUserName);
+    EXPECT_EQ(x.color, y.color);
+    EXPECT_EQ(x.messageID, y.messageID);
+    EXPECT_EQ(x.messageType, y.messageType);
+    EXPECT_EQ(x.channelPointsCustomRewardID, y.channelPointsCustomRewardID);
+
+    ASSERT_EQ(x.badges.size(), y.badges.size());
+    for (std::size_t i = 0; i < x.badges.size(); i++)
+    {
+        EXPECT_EQ(x.badges[i].setID, y.badges[i].setID);
+        EXPECT_EQ(x.badges[i].id, y.badges[i].id);
+        EXPECT_EQ(x.badges[i].info, y.badges[i].info);
+    }
+
+    EXPECT_EQ(x.message.text, y.message.text);
+    ASSERT_EQ(x.message.fragments.size(), y.message.fragments.size());
+    for (std::size_t i = 0; i < x.message.fragments.size(); i++)
+    {
+        expectEqual(x.message.fragments[i], y.message.fragments[i]);
+    }
+
+    ASSERT_EQ(x.cheer.has_value(), y.cheer.has_value());
+    if (x.cheer)
+    {
+        EXPECT_EQ(x.cheer->bits, y.cheer->bits);
+    }
+
+    ASSERT_EQ(x.reply.has_value(), y.reply.has_value());
+    if (x.reply)
+    {
+        EXPECT_EQ(x.reply->parentMessageID, y.reply->parentMessageID);
+        EXPECT_EQ(x.reply->parentUserID, y.reply->parentUserID);
+        EXPECT_EQ(x.reply->parentUserLogin, y.reply->parentUserLogin);
+        EXPECT_EQ(x.reply->parentUserName, y.reply->parentUserName);
+        EXPECT_EQ(x.reply->parentMessageBody, y.reply->parentMessageBody);
+        EXPECT_EQ(x.reply->threadMessageID, y.reply->threadMessageID);
+        EXPECT_EQ(x.reply->threadUserID, y.reply->threadUserID);
+        EXPECT_EQ(x.reply->threadUserLogin, y.reply->threadUserLogin);
+        EXPECT_EQ(x.reply->threadUserName, y.reply->threadUserName);
+    }
+}
+
+template <typename T>
+T parseWithDOM(const boost::json::value &jv)
+{
+    auto result = boost::json::try_value_to<T>(jv);
+    EXPECT_TRUE(result.has_value());
+    return std::move(result.value());
+}
+
+// Read a notification the way the session does, then compare each step to
+// the DOM
+void checkChatMessage(const std::string &frame, sax::Parser &parser)
+{
+    SCOPED_TRACE(frame);
+
+    const auto jv = boost::json::parse(frame);
+    const auto &root = jv.as_object();
+
+    messages::MetadataView metadata;
+    ASSERT_TRUE(detail::readMetadata(frame, parser, metadata));
+    const auto expectedMetadata =
+        parseWithDOM<messages::MetadataView>(root.at("metadata"));
+    EXPECT_EQ(metadata.messageID, expectedMetadata.messageID);
+    EXPECT_EQ(metadata.messageType, expectedMetadata.messageType);
+    EXPECT_EQ(metadata.messageTimestamp, expectedMetadata.messageTimestamp);
+    EXPECT_EQ(metadata.subscriptionType, expectedMetadata.subscriptionType);
+    EXPECT_EQ(metadata.subscriptionVersion,
+              expectedMetadata.subscriptionVersion);
+    EXPECT_EQ(metadata.type, expectedMetadata.type);
+    EXPECT_EQ(metadata.subscription, expectedMetadata.subscription);
+
+    const auto &condition = root.at("payload")
+                                .at("subscription")
+                                .at("condition")
+                                .at("broadcaster_user_id")
+                                .as_string();
+    EXPECT_EQ(readBroadcasterID(frame, parser),
+              parseUserID({condition.data(), condition.size()}));
+
+    const auto payload = detail::parsePayload<chat::Payload>(frame, parser);
+    ASSERT_TRUE(payload);
+    expectEqual(*payload, parseWithDOM<chat::Payload>(root.at("payload")));
+}
+
+}  // namespace
+
+TEST(Conformance, ChatMessages)
+{
+    const auto frames = test::loadChatMessageFrames();
+    ASSERT_FALSE(frames.empty());
+
+    sax::Parser parser;
+    for (const auto &frame : frames)
+    {
+        checkChatMessage(frame, parser);
+    }
+
+    // Once more with the parser's buffers already in use
+    for (const auto &frame : frames)
+    {
+        checkChatMessage(frame, parser);
+    }
+}
+
+TEST(Conformance, EscapedStrings)
+{
+    const std::string texts[] = {
+        R"(a \"quoted\" word)", R"(back\\slash)", R"(éè 😀)",
+        R"(tab\tnew\nline)",    "테스트계정420",
+    };
+
+    sax::Parser parser;
+    for (const auto &text : texts)
+    {
+        checkChatMessage(
+            test::chatMessageFrame("escaped",
+                                   test::chatMessageEvent("11148817", text)),
+            parser);
+    }
+}
+
+TEST(Conformance, ChangedFrameOfSameSize)
+{
+    // The parser may reuse what it knows about the last frame, but only if
+    // it's the same frame
+    const auto first = test::chatMessageFrame(
+        "a", test::chatMessageEvent("11148817", "first"));
+    const auto second = test::chatMessageFrame(
+        "b", test::chatMessageEvent("22148817", "other"));
+    ASSERT_EQ(first.size(), second.size());
+
+    sax::Parser parser;
+    checkChatMessage(first, parser);
+    checkChatMessage(second, parser);
+    checkChatMessage(first, parser);
+}
+
+TEST(Conformance, SessionMessages)
+{
+    sax::Parser parser;
+
+    const auto welcome = test::welcomeFrame("welcome", "AQoQexAWVYKSTIu4", 30);
+    auto welcomePayload =
+        detail::parsePayload<payload::session_welcome::Payload>(welcome,
+                                                                parser);
+    ASSERT_TRUE(welcomePayload);
+    EXPECT_EQ(welcomePayload->id, "AQoQexAWVYKSTIu4");
+    EXPECT_EQ(welcomePayload->keepaliveTimeoutSeconds, 30);
+
+    const auto reconnect = test::reconnectFrame(
+        "reconnect", "AQoQexAWVYKSTIu4", "wss://eventsub.wss.twitch.tv?id=1");
+    auto reconnectPayload =
+        detail::parsePayload<payload::session_reconnect::Payload>(reconnect,
+                                                                  parser);
+    ASSERT_TRUE(reconnectPayload);
+    EXPECT_EQ(reconnectPayload->reconnectURL,
+              "wss://eventsub.wss.twitch.tv?id=1");
+}
+
+TEST(Conformance, RejectsInvalidJSON)
+{
+    const std::string frames[] = {
+        "",
+        "{",
+        R"({"metadata": )",
+        R"({"metadata": {}} trailing)",
+        R"([1, 2, 3])",
+    };
+
+    sax::Parser parser;
+    for (const auto &frame : frames)
+    {
+        messages::MetadataView metadata;
+        EXPECT_FALSE(detail::readMetadata(frame, parser, metadata)) << frame;
+        EXPECT_FALSE(detail::parsePayload<chat::Payload>(frame, parser))
+            << frame;
+    }
+
+    // A valid frame still parses after all of those
+    checkChatMessage(test::chatMessageFrame(
+                         "valid", test::chatMessageEvent("11148817", "valid")),
+                     parser);
+}
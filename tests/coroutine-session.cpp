@@ -0,0 +1,113 @@
+#include "twitch-eventsub-ws/coroutine-session.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+using ConnectedCoroutineSession =
+    test::ConnectedSession<test::RecordingListener, CoroutineSession>;
+
+constexpr ReconnectOptions QUICK_RECONNECT{
+    .initialDelay = std::chrono::milliseconds{10},
+    .maxDelay = std::chrono::milliseconds{10},
+};
+
+}  // namespace
+
+TEST(CoroutineSession, DeliversNotifications)
+{
+    ConnectedCoroutineSession session;
+    ASSERT_TRUE(session.connect());
+
+    session.connection->send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+    session.connection->send(
+        test::chatMessageFrame("2", test::chatMessageEvent("1001", "b")));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 2;
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.welcomes, std::vector<std::string>{"session"});
+    EXPECT_EQ(recording.chatMessages[0].messageID, "1");
+    EXPECT_EQ(recording.chatMessages[1].messageID, "2");
+}
+
+TEST(CoroutineSession, DeliversTheWelcomeAfterAFailedMigration)
+{
+    ConnectedCoroutineSession session;
+    session->setReconnect(QUICK_RECONNECT);
+    ASSERT_TRUE(session.connect("first"));
+
+    auto &server = session.server;
+    const auto &recorder = session.listener;
+
+    auto first = session.connection;
+    first->send(
+        test::reconnectFrame("reconnect", "first", server.url("/reconnect")));
+
+    // The connection we're told to move to dies before it's welcomed, once
+    // the session is reading it
+    auto migrated = server.accept();
+    ASSERT_NE(migrated, nullptr);
+    EXPECT_EQ(migrated->path(), "/reconnect");
+    migrated->send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 1;
+    }));
+    migrated->drop();
+    first->close();
+
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.disconnects == 1;
+    }));
+
+    // So the session starts over, with a new Twitch session the listener
+    // needs to hear about
+    auto fresh = server.accept();
+    ASSERT_NE(fresh, nullptr);
+    EXPECT_EQ(fresh->path(), "/ws");
+    fresh->send(test::welcomeFrame("welcome-fresh", "fresh"));
+
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.welcomes.size() == 2;
+    }));
+    EXPECT_EQ(recorder.recording().welcomes,
+              (std::vector<std::string>{"first", "fresh"}));
+}
+
+TEST(CoroutineSession, SkipsFramesItCantDeliver)
+{
+    ConnectedCoroutineSession session;
+    ASSERT_TRUE(session.connect());
+
+    session.connection->send(
+        R"({"metadata":)" +
+        test::metadataJSON("1", "notification", "channel.chat.message") +
+        R"(,"payload":{"subscription":)");
+    session.connection->send(
+        test::revocationFrame("2", "channel.chat.message", "1001"));
+    session.connection->send(
+        test::chatMessageFrame("3", test::chatMessageEvent("1001", "a")));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 1;
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.revocations, std::vector<std::string>{"2"});
+    EXPECT_EQ(recording.disconnects, 0U);
+    EXPECT_EQ(session->getMessageErrors(), 1U);
+}
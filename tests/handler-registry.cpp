@@ -0,0 +1,224 @@
+#include "twitch-eventsub-ws/handler-registry.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/wait.hpp"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+namespace ban = eventsub::payload::channel_ban::v1;
+
+namespace {
+
+constexpr auto CHAT = messages::Subscription::ChannelChatMessageV1;
+
+chat::Payload chatMessage(std::string text)
+{
+    chat::Payload payload;
+    payload.event.message.text = std::move(text);
+    return payload;
+}
+
+// Call the handler registered for chat messages like the session does
+void deliver(const HandlerRegistry &registry, chat::Payload payload)
+{
+    const auto *handler = registry.find(CHAT);
+    ASSERT_NE(handler, nullptr);
+    (*handler)(messages::Metadata{}, &payload);
+}
+
+}  // namespace
+
+TEST(HandlerRegistry, StartsEmpty)
+{
+    const HandlerRegistry registry;
+
+    EXPECT_TRUE(registry.empty());
+    EXPECT_EQ(registry.find(CHAT), nullptr);
+}
+
+TEST(HandlerRegistry, OnReplacesTheHandler)
+{
+    HandlerRegistry registry;
+    std::vector<std::string> first;
+    std::vector<std::string> second;
+
+    EXPECT_TRUE(registry.on<chat::Payload>(
+        [&](const messages::Metadata & /*metadata*/, chat::Payload payload) {
+            first.push_back(std::move(payload.event.message.text));
+        }));
+    deliver(registry, chatMessage("a"));
+
+    EXPECT_TRUE(registry.on<chat::Payload>(
+        [&](const messages::Metadata & /*metadata*/, chat::Payload &&payload) {
+            second.push_back(std::move(payload.event.message.text));
+        }));
+    deliver(registry, chatMessage("b"));
+
+    EXPECT_EQ(first, std::vector<std::string>{"a"});
+    EXPECT_EQ(second, std::vector<std::string>{"b"});
+    EXPECT_FALSE(registry.empty());
+    EXPECT_EQ(registry.find(messages::Subscription::ChannelBanV1), nullptr);
+}
+
+TEST(HandlerRegistry, SharedHandlersGetTheSamePayload)
+{
+    HandlerRegistry registry;
+    std::vector<SharedPayload<chat::Payload>> received;
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_TRUE(registry.share<chat::Payload>(
+            [&](const messages::Metadata & /*metadata*/,
+                SharedPayload<chat::Payload> payload) {
+                received.push_back(std::move(payload));
+            }));
+    }
+    deliver(registry, chatMessage("shared"));
+
+    ASSERT_EQ(received.size(), 3U);
+    EXPECT_EQ(received[0]->event.message.text, "shared");
+    EXPECT_EQ(received[1].get(), received[0].get());
+    EXPECT_EQ(received[2].get(), received[0].get());
+    EXPECT_EQ(received[0].useCount(), 3U);
+}
+
+TEST(HandlerRegistry, RejectsSharedHandlersAfterOn)
+{
+    HandlerRegistry registry;
+    std::vector<std::string> own;
+    std::size_t shared = 0;
+
+    ASSERT_TRUE(
+        registry.on<chat::Payload>([&](const messages::Metadata & /*metadata*/,
+                                       const chat::Payload &payload) {
+            own.push_back(payload.event.message.text);
+        }));
+    EXPECT_FALSE(registry.share<chat::Payload>(
+        [&](const messages::Metadata & /*metadata*/,
+            SharedPayload<chat::Payload> /*payload*/) {
+            shared++;
+        }));
+
+    deliver(registry, chatMessage("a"));
+    EXPECT_EQ(own, std::vector<std::string>{"a"});
+    EXPECT_EQ(shared, 0U);
+}
+
+TEST(HandlerRegistry, RejectsOnAfterSharedHandlers)
+{
+    HandlerRegistry registry;
+    std::size_t own = 0;
+    std::size_t shared = 0;
+
+    ASSERT_TRUE(registry.share<chat::Payload>(
+        [&](const messages::Metadata & /*metadata*/,
+            SharedPayload<chat::Payload> /*payload*/) {
+            shared++;
+        }));
+    EXPECT_FALSE(
+        registry.on<chat::Payload>([&](const messages::Metadata & /*metadata*/,
+                                       chat::Payload /*payload*/) {
+            own++;
+        }));
+
+    deliver(registry, chatMessage("a"));
+    EXPECT_EQ(own, 0U);
+    EXPECT_EQ(shared, 1U);
+}
+
+TEST(HandlerRegistry, KeepsSubscriptionsApart)
+{
+    HandlerRegistry registry;
+    std::size_t bans = 0;
+    std::size_t chatMessages = 0;
+
+    ASSERT_TRUE(registry.on<ban::Payload>(
+        [&](const messages::Metadata & /*metadata*/, auto && /*payload*/) {
+            bans++;
+        }));
+
+    // Sharing chat messages doesn't conflict with the ban handler
+    ASSERT_TRUE(registry.share<chat::Payload>(
+        [&](const messages::Metadata & /*metadata*/, auto && /*payload*/) {
+            chatMessages++;
+        }));
+
+    deliver(registry, chatMessage("a"));
+
+    ban::Payload payload;
+    const auto *handler = registry.find(messages::Subscription::ChannelBanV1);
+    ASSERT_NE(handler, nullptr);
+    (*handler)(messages::Metadata{}, &payload);
+
+    EXPECT_EQ(bans, 1U);
+    EXPECT_EQ(chatMessages, 1U);
+}
+
+TEST(HandlerRegistry, SessionDeliversToHandlersInsteadOfTheListener)
+{
+    std::mutex mutex;
+    std::vector<SharedPayload<chat::Payload>> first;
+    std::vector<SharedPayload<chat::Payload>> second;
+
+    auto received = [&] {
+        std::lock_guard lock(mutex);
+        return std::make_pair(first.size(), second.size());
+    };
+
+    test::ConnectedSession<> session;
+    for (auto *handled : {&first, &second})
+    {
+        ASSERT_TRUE(session->share<chat::Payload>(
+            [&, handled](const messages::Metadata & /*metadata*/,
+                         SharedPayload<chat::Payload> payload) {
+                std::lock_guard lock(mutex);
+                handled->push_back(std::move(payload));
+            }));
+    }
+    ASSERT_TRUE(session.connect());
+
+    auto &connection = *session.connection;
+    connection.send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+
+    // Nothing handles bans, so this one is dropped before its payload, which
+    // would fail to parse, is looked at
+    connection.send(test::notificationFrame(
+        "2", "channel.ban", "1001", R"({"broadcaster_user_id":"1001"})"));
+
+    connection.send(
+        test::chatMessageFrame("3", test::chatMessageEvent("1001", "b")));
+
+    ASSERT_TRUE(test::waitUntil([&] {
+        return received() == std::make_pair(std::size_t{2}, std::size_t{2});
+    }));
+
+    {
+        std::lock_guard lock(mutex);
+        for (std::size_t i = 0; i < 2; i++)
+        {
+            // Both handlers got the same payload
+            EXPECT_EQ(first[i].get(), second[i].get());
+            EXPECT_EQ(first[i].useCount(), 2U);
+        }
+        EXPECT_EQ(first[0]->event.message.text, "a");
+        EXPECT_EQ(first[1]->event.message.text, "b");
+    }
+
+    // The listener is bypassed, except for the session messages
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.welcomes.size(), 1U);
+    EXPECT_TRUE(recording.notifications.empty());
+    EXPECT_TRUE(recording.chatMessages.empty());
+    EXPECT_EQ(recording.disconnects, 0U);
+
+    EXPECT_EQ(session->getDroppedNotifications(), 1U);
+}
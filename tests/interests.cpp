@@ -0,0 +1,47 @@
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace eventsub;
+
+TEST(Interests, DropsUninterestingNotificationsBeforeTheirPayload)
+{
+    test::ConnectedSession<> session;
+    session->setInterests({{"channel.chat.message", "1"}});
+    ASSERT_TRUE(session.connect());
+
+    auto &connection = *session.connection;
+    connection.send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+
+    // Its payload isn't even JSON, which only goes unnoticed if it's never
+    // parsed
+    connection.send(R"({"metadata":)" +
+                    test::metadataJSON("2", "notification", "stream.online") +
+                    R"(,"payload":{"subscription":)");
+
+    // Nor is this one's, which is missing most of its fields
+    connection.send(test::notificationFrame(
+        "3", "channel.ban", "1001", R"({"broadcaster_user_id":"1001"})"));
+    connection.send(
+        test::chatMessageFrame("4", test::chatMessageEvent("1001", "b")));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 2;
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.notifications, (std::vector<std::string>{"1", "4"}));
+    EXPECT_EQ(recording.chatMessages[0].messageID, "1");
+    EXPECT_EQ(recording.chatMessages[1].messageID, "4");
+    EXPECT_EQ(recording.disconnects, 0U);
+
+    EXPECT_EQ(session->getDroppedNotifications(), 2U);
+
+    // The welcome & both chat messages
+    EXPECT_EQ(session->getDeliveredFrames(), 3U);
+}
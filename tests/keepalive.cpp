@@ -0,0 +1,56 @@
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+using namespace eventsub;
+
+TEST(Keepalive, SilentConnectionsAreGivenUpOn)
+{
+    test::ConnectedSession<> session;
+    ASSERT_TRUE(session.accept());
+
+    const auto welcomedAt = std::chrono::steady_clock::now();
+    session.connection->send(test::welcomeFrame("welcome", "session", 1));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.disconnects == 1;
+    }));
+
+    // The keepalive timeout, and a second of slack on top. The deadline is
+    // counted from when the session received the welcome, which is after
+    // welcomedAt, so the session can't give up any earlier than this
+    const auto elapsed = std::chrono::steady_clock::now() - welcomedAt;
+    EXPECT_GE(elapsed, std::chrono::seconds{2});
+
+    // Nor much later: the watchdog fires right at the deadline. The margin
+    // covers getting the welcome & the disconnect across the loopback
+    EXPECT_LT(elapsed, std::chrono::milliseconds{2500});
+}
+
+TEST(Keepalive, KeepalivesRightAtTheTimeoutAreInTime)
+{
+    test::ConnectedSession<> session;
+    ASSERT_TRUE(session.accept());
+
+    // Like Twitch, which sends a keepalive whenever the connection has been
+    // quiet for the keepalive timeout
+    session.connection->send(test::welcomeFrame("welcome", "session", 1));
+    for (int i = 0; i < 4; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::seconds{1});
+        session.connection->send(
+            test::keepaliveFrame("keepalive-" + std::to_string(i)));
+    }
+
+    EXPECT_FALSE(session.listener.waitFor(
+        [](const auto &recording) {
+            return recording.disconnects > 0;
+        },
+        std::chrono::milliseconds{500}));
+    EXPECT_EQ(session.listener.recording().welcomes.size(), 1U);
+}
@@ -0,0 +1,118 @@
+#include "twitch-eventsub-ws/legacy-listener.hpp"
+
+#include "support/allocation-counter.hpp"
+#include "support/corpus.hpp"
+#include "support/listeners.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+using namespace eventsub;
+namespace chat = eventsub::payload::channel_chat_message::v1;
+
+namespace {
+
+// Keeps the last chat message it was given, like a real listener would
+class KeepingLegacyListener final : public test::NullLegacyListener
+{
+public:
+    void onChannelChatMessage(messages::Metadata metadata,
+                              chat::Payload payload) override
+    {
+        this->lastMetadata = std::move(metadata);
+        this->last = std::move(payload);
+    }
+
+    std::optional<messages::Metadata> lastMetadata;
+    std::optional<chat::Payload> last;
+};
+
+class KeepingListener final : public test::NullListener
+{
+public:
+    void onChannelChatMessage(const messages::Metadata & /*metadata*/,
+                              chat::Payload &&payload) override
+    {
+        this->last = std::move(payload);
+    }
+
+    std::optional<chat::Payload> last;
+};
+
+struct Event {
+    messages::Metadata metadata;
+    chat::Payload payload;
+};
+
+Event readEvent(const std::string &frame)
+{
+    sax::Parser parser;
+
+    messages::MetadataView metadata;
+    EXPECT_TRUE(detail::readMetadata(frame, parser, metadata));
+    auto payload = detail::parsePayload<chat::Payload>(frame, parser);
+    EXPECT_TRUE(payload);
+
+    return {metadata.toMetadata(), std::move(*payload)};
+}
+
+}  // namespace
+
+TEST(LegacyListener, AdapterForwardsPayloads)
+{
+    const auto frames = test::loadChatMessageFrames();
+    ASSERT_FALSE(frames.empty());
+
+    auto legacy = std::make_unique<KeepingLegacyListener>();
+    auto &inner = *legacy;
+    LegacyListenerAdapter adapter(std::move(legacy));
+
+    auto event = readEvent(frames[0]);
+    const auto text = event.payload.event.message.text;
+    adapter.onChannelChatMessage(event.metadata, std::move(event.payload));
+
+    ASSERT_TRUE(inner.last);
+    EXPECT_EQ(inner.last->event.message.text, text);
+    ASSERT_TRUE(inner.lastMetadata);
+    EXPECT_EQ(inner.lastMetadata->messageID, event.metadata.messageID);
+}
+
+TEST(LegacyListener, AdapterOnlyCopiesMetadata)
+{
+    KeepingListener listener;
+    auto legacy = std::make_unique<KeepingLegacyListener>();
+    LegacyListenerAdapter adapter(std::move(legacy));
+
+    for (const auto &frame : test::loadChatMessageFrames())
+    {
+        auto event = readEvent(frame);
+
+        std::size_t metadataCopy = 0;
+        {
+            const test::AllocationCounter counter;
+            auto copy = event.metadata;
+            metadataCopy = counter.allocations();
+        }
+
+        // Warm up the kept optionals
+        auto warmUp = event.payload;
+        adapter.onChannelChatMessage(event.metadata, std::move(warmUp));
+
+        auto payload = event.payload;
+        const test::AllocationCounter adapterCounter;
+        adapter.onChannelChatMessage(event.metadata, std::move(payload));
+        EXPECT_EQ(adapterCounter.allocations(), metadataCopy);
+
+        payload = event.payload;
+        const test::AllocationCounter listenerCounter;
+        listener.onChannelChatMessage(event.metadata, std::move(payload));
+        EXPECT_EQ(listenerCounter.allocations(), 0U);
+    }
+}
@@ -0,0 +1,149 @@
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+
+#include "twitch-eventsub-ws/sax.hpp"
+
+#include <boost/json.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+using namespace eventsub;
+using namespace eventsub::messages;
+
+namespace {
+
+// Reads the view through both the DOM tag_invoke & the SAX sink, making sure
+// they agree
+boost::json::error_code readView(std::string_view json, MetadataView &out)
+{
+    const auto jv = boost::json::parse(json);
+    const auto dom = boost::json::try_value_to<MetadataView>(jv);
+
+    sax::Parser parser;
+    MetadataView view;
+    const auto ec = parser.parse(json, sax::slot(view));
+
+    EXPECT_EQ(dom.has_error(), static_cast<bool>(ec)) << json;
+    if (dom.has_error())
+    {
+        EXPECT_EQ(dom.error().message(), ec.message()) << json;
+        return ec;
+    }
+
+    EXPECT_EQ(dom->messageID, view.messageID);
+    EXPECT_EQ(dom->messageType, view.messageType);
+    EXPECT_EQ(dom->messageTimestamp, view.messageTimestamp);
+    EXPECT_EQ(dom->subscriptionType, view.subscriptionType);
+    EXPECT_EQ(dom->subscriptionVersion, view.subscriptionVersion);
+    EXPECT_EQ(dom->type, view.type);
+    EXPECT_EQ(dom->subscription, view.subscription);
+
+    out = view;
+    return ec;
+}
+
+}  // namespace
+
+TEST(MetadataView, ReadsNotification)
+{
+    MetadataView view;
+    ASSERT_FALSE(readView(R"({
+        "message_id": "befa7b53-d79d-478f-86b9-120f112b044e",
+        "message_type": "notification",
+        "message_timestamp": "2019-11-16T10:11:12.464757833Z",
+        "subscription_type": "channel.ban",
+        "subscription_version": "1"
+    })",
+                          view));
+
+    EXPECT_EQ(view.messageID, "befa7b53-d79d-478f-86b9-120f112b044e");
+    EXPECT_EQ(view.messageType, "notification");
+    EXPECT_EQ(view.messageTimestamp, "2019-11-16T10:11:12.464757833Z");
+    EXPECT_EQ(view.subscriptionType, "channel.ban");
+    EXPECT_EQ(view.subscriptionVersion, "1");
+    EXPECT_EQ(view.type, MessageType::Notification);
+    EXPECT_EQ(view.subscription, Subscription::ChannelBanV1);
+}
+
+TEST(MetadataView, ReadsKeysInAnyOrder)
+{
+    MetadataView view;
+    ASSERT_FALSE(readView(R"({
+        "subscription_version": "1",
+        "unknown_key": {"message_id": "nested"},
+        "message_timestamp": "2019-11-16T10:11:12.464757833Z",
+        "subscription_type": "stream.online",
+        "message_type": "notification",
+        "message_id": "id"
+    })",
+                          view));
+
+    EXPECT_EQ(view.messageID, "id");
+    EXPECT_EQ(view.type, MessageType::Notification);
+    EXPECT_EQ(view.subscription, Subscription::StreamOnlineV1);
+}
+
+TEST(MetadataView, ReadsMessageWithoutSubscription)
+{
+    MetadataView view;
+    ASSERT_FALSE(readView(R"({
+        "message_id": "id",
+        "message_type": "session_keepalive",
+        "message_timestamp": "2023-07-19T10:11:12.634234626Z",
+        "subscription_type": null
+    })",
+                          view));
+
+    EXPECT_EQ(view.type, MessageType::SessionKeepalive);
+    EXPECT_FALSE(view.subscriptionType);
+    EXPECT_FALSE(view.subscriptionVersion);
+    EXPECT_EQ(view.subscription, Subscription::Unknown);
+}
+
+TEST(MetadataView, RejectsMissingKeys)
+{
+    MetadataView view;
+
+    auto ec = readView(R"({
+        "message_type": "session_keepalive",
+        "message_timestamp": "2023-07-19T10:11:12.634234626Z"
+    })",
+                       view);
+    EXPECT_EQ(ec.message(), "Missing required key message_id");
+
+    ec = readView(R"({
+        "message_id": "id",
+        "message_timestamp": "2023-07-19T10:11:12.634234626Z"
+    })",
+                  view);
+    EXPECT_EQ(ec.message(), "Missing required key message_type");
+
+    ec = readView(R"({
+        "message_id": "id",
+        "message_type": "session_keepalive"
+    })",
+                  view);
+    EXPECT_EQ(ec.message(), "Missing required key message_timestamp");
+}
+
+TEST(MetadataView, RejectsWrongTypes)
+{
+    MetadataView view;
+
+    EXPECT_TRUE(readView(R"({
+        "message_id": 1,
+        "message_type": "session_keepalive",
+        "message_timestamp": "2023-07-19T10:11:12.634234626Z"
+    })",
+                         view));
+
+    EXPECT_TRUE(readView(R"({
+        "message_id": "id",
+        "message_type": "notification",
+        "message_timestamp": "2023-07-19T10:11:12.634234626Z",
+        "subscription_type": "channel.ban",
+        "subscription_version": 1
+    })",
+                         view));
+}
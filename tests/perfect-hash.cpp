@@ -0,0 +1,89 @@
+#include "twitch-eventsub-ws/perfect-hash.hpp"
+
+#include "twitch-eventsub-ws/messages/metadata.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+using namespace eventsub;
+using namespace eventsub::messages;
+
+namespace {
+
+constexpr auto COLORS = makePerfectHashMap<int>({
+    {"red", "1", 1},
+    {"red", "2", 2},
+    {"green", "1", 3},
+    {"ab", "c", 4},
+    {"a", "bc", 5},
+});
+
+// Lookups can happen at compile time
+static_assert(*COLORS.find("red", "2") == 2);
+static_assert(*COLORS.find("ab", "c") == 4);
+static_assert(*COLORS.find("a", "bc") == 5);
+static_assert(COLORS.find("blue", "1") == nullptr);
+
+}  // namespace
+
+TEST(PerfectHash, FindsEveryEntry)
+{
+    for (const auto &entry : COLORS.getEntries())
+    {
+        // Copy the keys so they don't point at the entry's own strings
+        const std::string first{entry.first};
+        const std::string second{entry.second};
+
+        const auto *value = COLORS.find(first, second);
+        ASSERT_NE(value, nullptr) << first << ' ' << second;
+        EXPECT_EQ(*value, entry.value);
+    }
+}
+
+TEST(PerfectHash, RejectsUnknownKeys)
+{
+    EXPECT_EQ(COLORS.find("red"), nullptr);
+    EXPECT_EQ(COLORS.find("red", "3"), nullptr);
+    EXPECT_EQ(COLORS.find("1", "red"), nullptr);
+    EXPECT_EQ(COLORS.find("abc"), nullptr);
+    EXPECT_EQ(COLORS.find("", ""), nullptr);
+}
+
+TEST(PerfectHash, ParsesMessageTypes)
+{
+    EXPECT_EQ(parseMessageType("session_welcome"), MessageType::SessionWelcome);
+    EXPECT_EQ(parseMessageType("session_keepalive"),
+              MessageType::SessionKeepalive);
+    EXPECT_EQ(parseMessageType("session_reconnect"),
+              MessageType::SessionReconnect);
+    EXPECT_EQ(parseMessageType("notification"), MessageType::Notification);
+    EXPECT_EQ(parseMessageType("revocation"), MessageType::Revocation);
+
+    EXPECT_EQ(parseMessageType(""), MessageType::Unknown);
+    EXPECT_EQ(parseMessageType("session"), MessageType::Unknown);
+    EXPECT_EQ(parseMessageType("Notification"), MessageType::Unknown);
+}
+
+TEST(PerfectHash, ParsesSubscriptions)
+{
+    EXPECT_EQ(parseSubscription("channel.ban", "1"),
+              Subscription::ChannelBanV1);
+    EXPECT_EQ(parseSubscription("stream.online", "1"),
+              Subscription::StreamOnlineV1);
+    EXPECT_EQ(parseSubscription("stream.offline", "1"),
+              Subscription::StreamOfflineV1);
+    EXPECT_EQ(parseSubscription("channel.chat.notification", "1"),
+              Subscription::ChannelChatNotificationV1);
+    EXPECT_EQ(parseSubscription("channel.update", "1"),
+              Subscription::ChannelUpdateV1);
+    EXPECT_EQ(parseSubscription("channel.chat.message", "1"),
+              Subscription::ChannelChatMessageV1);
+
+    EXPECT_EQ(parseSubscription("channel.ban", "2"), Subscription::Unknown);
+    EXPECT_EQ(parseSubscription("channel.chat.message", "v1"),
+              Subscription::Unknown);
+    EXPECT_EQ(parseSubscription("channel.follow", "2"), Subscription::Unknown);
+    EXPECT_EQ(parseSubscription("", ""), Subscription::Unknown);
+}
@@ -0,0 +1,239 @@
+#include "twitch-eventsub-ws/pipeline.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+// Holds up whoever passes it until it's opened
+class Gate
+{
+public:
+    void pass()
+    {
+        std::unique_lock lock(this->mutex);
+        this->passing++;
+        this->changed.notify_all();
+        this->changed.wait(lock, [this] {
+            return this->opened;
+        });
+    }
+
+    // Wait until someone is held up by the gate
+    bool waitForPassing(
+        std::chrono::milliseconds timeout = std::chrono::seconds{5})
+    {
+        std::unique_lock lock(this->mutex);
+        return this->changed.wait_for(lock, timeout, [this] {
+            return this->passing > 0;
+        });
+    }
+
+    void open()
+    {
+        std::lock_guard lock(this->mutex);
+        this->opened = true;
+        this->changed.notify_all();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::size_t passing = 0;
+    bool opened = false;
+};
+
+// Opens the gate when it goes out of scope, so a failing test doesn't leave
+// a worker stuck in it
+class OpenOnExit
+{
+public:
+    explicit OpenOnExit(Gate &_gate)
+        : gate(_gate)
+    {
+    }
+
+    ~OpenOnExit()
+    {
+        this->gate.open();
+    }
+
+    OpenOnExit(const OpenOnExit &) = delete;
+    OpenOnExit &operator=(const OpenOnExit &) = delete;
+
+private:
+    Gate &gate;
+};
+
+// A listener that can't keep up: it handles no chat message until the gate
+// is opened
+class GatedListener final : public test::RecordingListener
+{
+public:
+    explicit GatedListener(Gate &_gate)
+        : gate(_gate)
+    {
+    }
+
+    void onChannelChatMessage(
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) override
+    {
+        this->gate.pass();
+        RecordingListener::onChannelChatMessage(metadata, std::move(payload));
+    }
+
+private:
+    Gate &gate;
+};
+
+}  // namespace
+
+TEST(Pipeline, BlockingDoesntHoldUpTheIOThread)
+{
+    constexpr std::size_t FRAMES = 16;
+
+    // Outlives the session, whose worker may still be passing it
+    Gate gate;
+
+    test::ConnectedSession<GatedListener> blocked{
+        std::make_unique<GatedListener>(gate)};
+    blocked->setPipeline({
+        .threads = 1,
+        .queueCapacity = 2,
+        .overflow = OverflowPolicy::Block,
+    });
+    const auto &slow = blocked.listener;
+
+    // Both sessions share the I/O thread, like the sessions of a SessionPool
+    // with threads = 1
+    auto fastListener = std::make_unique<test::RecordingListener>();
+    const auto &fast = *fastListener;
+    auto other = std::make_shared<Session>(blocked.ioc, blocked.ctx,
+                                           std::move(fastListener));
+
+    const OpenOnExit openOnExit{gate};
+
+    ASSERT_TRUE(blocked.accept("/blocked"));
+    EXPECT_EQ(blocked.connection->path(), "/blocked");
+
+    blocked.connection->send(test::welcomeFrame("welcome", "blocked"));
+    for (std::size_t i = 0; i < FRAMES; i++)
+    {
+        blocked.connection->send(test::chatMessageFrame(
+            std::to_string(i), test::chatMessageEvent("1001", "slow")));
+    }
+
+    // The worker is stuck on the first message, so the queue fills up and
+    // the session stops reading
+    ASSERT_TRUE(gate.waitForPassing());
+    ASSERT_TRUE(slow.waitFor([](const auto &recording) {
+        return !recording.welcomes.empty();
+    }));
+
+    // Meanwhile, the I/O thread is free to serve another session
+    auto &server = blocked.server;
+    boost::asio::post(blocked.ioc, [&] {
+        other->run(server.host(), server.port(), "/other", "test");
+    });
+
+    auto otherConnection = server.accept();
+    ASSERT_NE(otherConnection, nullptr);
+    EXPECT_EQ(otherConnection->path(), "/other");
+
+    otherConnection->send(test::welcomeFrame("welcome", "other"));
+    otherConnection->send(test::chatMessageFrame(
+        "other", test::chatMessageEvent("1002", "fast")));
+
+    ASSERT_TRUE(fast.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 1;
+    }));
+    EXPECT_TRUE(slow.recording().chatMessages.empty());
+    EXPECT_LE(blocked->getPipelineStats().queueHighWaterMark, 2U);
+
+    // Once the worker catches up, every frame is delivered, in order
+    gate.open();
+    ASSERT_TRUE(slow.waitFor([&](const auto &recording) {
+        return recording.chatMessages.size() == FRAMES;
+    }));
+
+    const auto recording = slow.recording();
+    for (std::size_t i = 0; i < FRAMES; i++)
+    {
+        EXPECT_EQ(recording.chatMessages[i].messageID, std::to_string(i));
+    }
+    EXPECT_EQ(blocked->getPipelineStats().droppedFrames, 0U);
+}
+
+TEST(Pipeline, KeepsEachBroadcasterInOrder)
+{
+    constexpr std::size_t THREADS = 4;
+    constexpr std::uint64_t BROADCASTERS = 8;
+    constexpr std::size_t FRAMES = 400;
+
+    test::ConnectedSession<> session;
+    session->setPipeline({
+        .threads = THREADS,
+        .queueCapacity = 16,
+        .overflow = OverflowPolicy::Block,
+    });
+    ASSERT_TRUE(session.connect());
+
+    // The broadcasters take turns, so every worker has frames of two
+    // broadcasters interleaved in its queue
+    for (std::size_t i = 0; i < FRAMES; i++)
+    {
+        const auto broadcasterID = std::to_string(1001 + (i % BROADCASTERS));
+        session.connection->send(test::chatMessageFrame(
+            broadcasterID + ":" + std::to_string(i / BROADCASTERS),
+            test::chatMessageEvent(broadcasterID, "hi")));
+    }
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == FRAMES;
+    }));
+
+    std::map<std::string, std::vector<std::string>> messagesOf;
+    std::map<std::string, std::set<std::thread::id>> threadsOf;
+    std::set<std::thread::id> threads;
+    for (const auto &message : session.listener.recording().chatMessages)
+    {
+        messagesOf[message.broadcasterID].push_back(message.messageID);
+        threadsOf[message.broadcasterID].insert(message.thread);
+        threads.insert(message.thread);
+    }
+
+    ASSERT_EQ(messagesOf.size(), BROADCASTERS);
+    for (const auto &[broadcasterID, messageIDs] : messagesOf)
+    {
+        ASSERT_EQ(messageIDs.size(), FRAMES / BROADCASTERS);
+        for (std::size_t i = 0; i < messageIDs.size(); i++)
+        {
+            EXPECT_EQ(messageIDs[i], broadcasterID + ":" + std::to_string(i));
+        }
+
+        // A broadcaster sticks to its worker
+        EXPECT_EQ(threadsOf[broadcasterID].size(), 1U) << broadcasterID;
+    }
+
+    // ... and the broadcasters are spread over all of them
+    EXPECT_EQ(threads.size(), THREADS);
+    EXPECT_EQ(session->getPipelineStats().droppedFrames, 0U);
+}
@@ -0,0 +1,350 @@
+#include "twitch-eventsub-ws/reconnect.hpp"
+
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/wait.hpp"
+#include "twitch-eventsub-ws/message-deduplicator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+std::string chatMessage(const std::string &messageID)
+{
+    return test::chatMessageFrame(messageID,
+                                  test::chatMessageEvent("1001", messageID));
+}
+
+}  // namespace
+
+TEST(MessageDeduplicator, RejectsIDsItHasSeen)
+{
+    MessageDeduplicator deduplicator;
+
+    EXPECT_TRUE(deduplicator.insert("a"));
+    EXPECT_TRUE(deduplicator.insert("b"));
+    EXPECT_FALSE(deduplicator.insert("a"));
+    EXPECT_FALSE(deduplicator.insert("b"));
+
+    deduplicator.clear();
+    EXPECT_TRUE(deduplicator.insert("a"));
+}
+
+TEST(MessageDeduplicator, ForgetsTheOldestIDs)
+{
+    MessageDeduplicator deduplicator{2};
+
+    EXPECT_TRUE(deduplicator.insert("a"));
+    EXPECT_TRUE(deduplicator.insert("b"));
+    EXPECT_TRUE(deduplicator.insert("c"));
+
+    EXPECT_FALSE(deduplicator.insert("c"));
+    EXPECT_FALSE(deduplicator.insert("b"));
+    EXPECT_TRUE(deduplicator.insert("a"));
+}
+
+TEST(ReconnectDelay, StaysWithinTheDoublingLimit)
+{
+    const ReconnectOptions options{
+        .initialDelay = std::chrono::milliseconds{100},
+        .maxDelay = std::chrono::milliseconds{1000},
+    };
+    std::minstd_rand random{1};
+
+    for (std::size_t attempt = 0; attempt < 8; attempt++)
+    {
+        // 100, 200, 400, 800, then capped
+        const auto limit =
+            std::min(options.initialDelay * (1 << attempt), options.maxDelay);
+
+        auto shortest = limit;
+        auto longest = std::chrono::milliseconds{0};
+        for (int i = 0; i < 1000; i++)
+        {
+            const auto delay = reconnectDelay(options, attempt, random);
+            ASSERT_GE(delay.count(), 0);
+            ASSERT_LE(delay, limit);
+            shortest = std::min(shortest, delay);
+            longest = std::max(longest, delay);
+        }
+
+        // Full jitter, so the whole range is used
+        EXPECT_LT(shortest, limit / 10) << "attempt " << attempt;
+        EXPECT_GT(longest, limit * 9 / 10) << "attempt " << attempt;
+    }
+}
+
+TEST(ReconnectDelay, HonoursTheCap)
+{
+    const ReconnectOptions options{
+        .initialDelay = std::chrono::milliseconds{500},
+        .maxDelay = std::chrono::milliseconds{30000},
+    };
+    std::minstd_rand random{1};
+
+    // Way past the point where the doubling would overflow
+    for (const std::size_t attempt : {6U, 16U, 63U, 64U, 1000U})
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            ASSERT_LE(reconnectDelay(options, attempt, random),
+                      options.maxDelay);
+        }
+    }
+
+    const ReconnectOptions immediate{
+        .initialDelay = std::chrono::milliseconds{0},
+        .maxDelay = std::chrono::milliseconds{0},
+    };
+    EXPECT_EQ(reconnectDelay(immediate, 0, random).count(), 0);
+    EXPECT_EQ(reconnectDelay(immediate, 10, random).count(), 0);
+}
+
+TEST(Reconnect, DeliversEveryNotificationExactlyOnce)
+{
+    test::ConnectedSession<> session;
+    ASSERT_TRUE(session.connect("old"));
+
+    auto &server = session.server;
+    const auto &recorder = session.listener;
+    auto oldConnection = session.connection;
+
+    oldConnection->send(chatMessage("1"));
+    oldConnection->send(chatMessage("2"));
+    oldConnection->send(
+        test::reconnectFrame("reconnect", "old", server.url("/reconnect")));
+
+    auto newConnection = server.accept();
+    ASSERT_NE(newConnection, nullptr);
+    EXPECT_EQ(newConnection->path(), "/reconnect");
+
+    // Twitch sends to both connections while the session moves over
+    oldConnection->send(chatMessage("3"));
+    newConnection->send(chatMessage("3"));
+    oldConnection->send(chatMessage("4"));
+    newConnection->send(chatMessage("4"));
+
+    newConnection->send(test::welcomeFrame("welcome-new", "new"));
+    newConnection->send(chatMessage("5"));
+    newConnection->send(chatMessage("6"));
+
+    // Only the new connection sent 6, after its welcome, so the session has
+    // moved over by the time it's delivered
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() >= 6;
+    }));
+
+    // The old connection lags behind until Twitch closes it
+    oldConnection->send(chatMessage("5"));
+    oldConnection->close();
+
+    // Everything the old connection sent has been read once its close is
+    // answered
+    ASSERT_TRUE(oldConnection->waitClosed(std::chrono::seconds{5}));
+    ASSERT_TRUE(test::waitUntil([&] {
+        return session->getDuplicateNotifications() == 3;
+    }));
+
+    const auto recording = recorder.recording();
+    std::map<std::string, std::size_t> deliveries;
+    for (const auto &message : recording.chatMessages)
+    {
+        deliveries[message.messageID]++;
+    }
+    EXPECT_EQ(deliveries, (std::map<std::string, std::size_t>{
+                              {"1", 1},
+                              {"2", 1},
+                              {"3", 1},
+                              {"4", 1},
+                              {"5", 1},
+                              {"6", 1},
+                          }));
+
+    // The subscriptions carried over, so the listener only saw one session
+    ASSERT_EQ(recording.welcomes.size(), 1U);
+    EXPECT_EQ(recording.welcomes[0], "old");
+    EXPECT_EQ(recording.disconnects, 0U);
+
+    // The new connection is the one that's kept
+    newConnection->send(chatMessage("7"));
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 7;
+    }));
+    EXPECT_EQ(recorder.recording().chatMessages.back().messageID, "7");
+}
+
+TEST(Reconnect, KeepsLatencyLowWhileMoving)
+{
+    test::ConnectedSession<> session;
+    ASSERT_TRUE(session.connect("old"));
+
+    auto &server = session.server;
+    const auto &recorder = session.listener;
+    auto oldConnection = session.connection;
+    std::shared_ptr<test::MockConnection> newConnection;
+
+    // When each message was first sent, on whichever connection
+    std::map<std::string, std::chrono::steady_clock::time_point> sentAt;
+    std::size_t sent = 0;
+    const auto send = [&](bool toOld, bool toNew) {
+        const auto id = std::to_string(++sent);
+        sentAt[id] = std::chrono::steady_clock::now();
+        if (toOld)
+        {
+            oldConnection->send(chatMessage(id));
+        }
+        if (toNew)
+        {
+            newConnection->send(chatMessage(id));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    };
+
+    for (int i = 0; i < 5; i++)
+    {
+        send(true, false);
+    }
+
+    // The old connection keeps going while the session connects to the new
+    // one
+    oldConnection->send(
+        test::reconnectFrame("reconnect", "old", server.url("/reconnect")));
+    for (int i = 0; i < 5; i++)
+    {
+        send(true, false);
+    }
+
+    newConnection = server.accept();
+    ASSERT_NE(newConnection, nullptr);
+    for (int i = 0; i < 5; i++)
+    {
+        send(true, true);
+    }
+
+    newConnection->send(test::welcomeFrame("welcome-new", "new"));
+    for (int i = 0; i < 5; i++)
+    {
+        send(true, true);
+    }
+    oldConnection->close();
+    for (int i = 0; i < 5; i++)
+    {
+        send(false, true);
+    }
+
+    ASSERT_TRUE(recorder.waitFor([&](const auto &recording) {
+        return recording.chatMessages.size() == sent;
+    }));
+
+    // From sending a message until the listener has it, so this includes
+    // the loopback & TLS on top of what moving adds
+    std::chrono::steady_clock::duration longest{0};
+    for (const auto &message : recorder.recording().chatMessages)
+    {
+        longest =
+            std::max(longest, message.deliveredAt - sentAt[message.messageID]);
+    }
+    RecordProperty(
+        "longestLatencyMicroseconds",
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(longest)
+                .count()));
+    EXPECT_LT(longest, std::chrono::milliseconds{50});
+}
+
+TEST(Reconnect, FramesThatCantBeDeliveredDontCostTheConnection)
+{
+    test::ConnectedSession<> session;
+    ASSERT_TRUE(session.connect());
+
+    auto &connection = *session.connection;
+
+    // A notification that isn't JSON past its metadata
+    connection.send(
+        R"({"metadata":)" +
+        test::metadataJSON("1", "notification", "channel.chat.message") +
+        R"(,"payload":{"subscription":)");
+
+    // A message type we don't know about
+    connection.send(R"({"metadata":)" + test::metadataJSON("2", "unknown") +
+                    R"(,"payload":{}})");
+
+    connection.send(test::revocationFrame("3", "channel.chat.message", "1001"));
+    connection.send(chatMessage("4"));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 1;
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.chatMessages[0].messageID, "4");
+    EXPECT_EQ(recording.revocations, std::vector<std::string>{"3"});
+    EXPECT_EQ(recording.disconnects, 0U);
+    EXPECT_EQ(session->getMessageErrors(), 2U);
+}
+
+TEST(Reconnect, ReplacesALostConnection)
+{
+    test::ConnectedSession<> session;
+    session->setReconnect({
+        .initialDelay = std::chrono::milliseconds{10},
+        .maxDelay = std::chrono::milliseconds{10},
+    });
+    ASSERT_TRUE(session.connect("first"));
+
+    auto &server = session.server;
+    const auto &recorder = session.listener;
+
+    session.connection->send(chatMessage("1"));
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 1;
+    }));
+    session.connection->drop();
+
+    // The first attempt is lost before its welcome
+    auto failed = server.accept();
+    ASSERT_NE(failed, nullptr);
+    EXPECT_EQ(failed->path(), "/ws");
+    failed->drop();
+
+    auto replacement = server.accept();
+    ASSERT_NE(replacement, nullptr);
+    EXPECT_EQ(replacement->path(), "/ws");
+
+    // So the reconnect takes at least this long
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    replacement->send(test::welcomeFrame("welcome-second", "second"));
+    replacement->send(chatMessage("2"));
+
+    ASSERT_TRUE(recorder.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 2;
+    }));
+
+    const auto recording = recorder.recording();
+    EXPECT_EQ(recording.welcomes,
+              (std::vector<std::string>{"first", "second"}));
+    EXPECT_GE(recording.disconnects, 1U);
+
+    const auto stats = session->getReconnectStats();
+    EXPECT_EQ(stats.reconnects, 1U);
+    EXPECT_EQ(stats.failedAttempts, 1U);
+    EXPECT_GE(stats.lastDuration, std::chrono::milliseconds{20});
+    EXPECT_EQ(stats.longestDuration, stats.lastDuration);
+    EXPECT_EQ(stats.totalDuration, stats.lastDuration);
+
+    // Both attempts connected to the addresses looked up for the first
+    // connection
+    EXPECT_EQ(stats.resolves, 1U);
+}
@@ -0,0 +1,266 @@
+#include "twitch-eventsub-ws/session-pool.hpp"
+
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+#include "support/mock-server.hpp"
+#include "support/wait.hpp"
+
+#include <boost/asio/ssl.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+// The subscriptions the pool asked to be created
+class Subscriptions
+{
+public:
+    struct Placed {
+        std::string sessionID;
+        std::string type;
+        std::size_t cost = 0;
+    };
+
+    SessionPool::Subscriber subscriber()
+    {
+        return [this](std::string_view sessionID,
+                      const SubscriptionRequest &request) {
+            std::lock_guard lock(this->mutex);
+            this->placed.push_back({
+                .sessionID = std::string{sessionID},
+                .type = request.type,
+                .cost = request.cost,
+            });
+        };
+    }
+
+    std::vector<Placed> get() const
+    {
+        std::lock_guard lock(this->mutex);
+        return this->placed;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::vector<Placed> placed;
+};
+
+/**
+ * A SessionPool whose sessions connect to a MockServer. Each connection is
+ * welcomed with a session ID of its own by welcome()
+ **/
+class ConnectedPool
+{
+public:
+    explicit ConnectedPool(SessionPoolOptions options)
+        : pool(ctx, std::make_unique<test::RecordingListener>(),
+               std::move(options))
+    {
+        this->pool.setSubscriber(this->subscriptions.subscriber());
+        this->pool.run(this->server.host(), this->server.port(), "/ws", "test");
+    }
+
+    // Accept the next connection of a session. Returns false if there's none
+    bool accept()
+    {
+        auto connection = this->server.accept();
+        if (connection == nullptr)
+        {
+            return false;
+        }
+        this->connections.push_back(std::move(connection));
+        return true;
+    }
+
+    // Welcome the accepted connection as "session-<index>", and wait until
+    // the pool knows it's connected
+    bool welcome(std::size_t index)
+    {
+        const auto connected = this->pool.getConnectionCount();
+        this->connections[index]->send(test::welcomeFrame(
+            "welcome-" + std::to_string(index), sessionID(index)));
+        return test::waitUntil([&] {
+            return this->pool.getConnectionCount() == connected + 1;
+        });
+    }
+
+    static std::string sessionID(std::size_t index)
+    {
+        return "session-" + std::to_string(index);
+    }
+
+    // The load of the session with the given ID
+    SessionLoad loadOf(const std::string &id) const
+    {
+        const auto loads = this->pool.getSessionLoads();
+        const auto it =
+            std::find_if(loads.begin(), loads.end(), [&](const auto &load) {
+                return load.sessionID == id;
+            });
+        return it == loads.end() ? SessionLoad{} : *it;
+    }
+
+    test::MockServer server;
+    boost::asio::ssl::context ctx{boost::asio::ssl::context::tlsv12_client};
+    Subscriptions subscriptions;
+    SessionPool pool;
+    std::vector<std::shared_ptr<test::MockConnection>> connections;
+};
+
+// The pool doesn't look at the condition, only the subscriber does
+SubscriptionRequest request(std::string type, std::size_t cost = 1)
+{
+    return {
+        .type = std::move(type),
+        .version = "1",
+        .cost = cost,
+    };
+}
+
+}  // namespace
+
+TEST(SessionPool, PlacesSubscriptionsOnTheLowestCost)
+{
+    ConnectedPool pool({.sessions = 2});
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.welcome(0));
+    ASSERT_TRUE(pool.welcome(1));
+
+    ASSERT_TRUE(pool.pool.subscribe(request("channel.ban", 3)));
+    const auto heavy = pool.subscriptions.get().back().sessionID;
+
+    // The other session stays cheaper until it has taken as much
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(pool.pool.subscribe(request("channel.chat.message")));
+        EXPECT_NE(pool.subscriptions.get().back().sessionID, heavy);
+    }
+
+    const auto placed = pool.subscriptions.get();
+    ASSERT_EQ(placed.size(), 4U);
+    const auto light = placed.back().sessionID;
+    EXPECT_EQ(pool.loadOf(heavy).cost, 3U);
+    EXPECT_EQ(pool.loadOf(heavy).subscriptions, 1U);
+    EXPECT_EQ(pool.loadOf(light).cost, 3U);
+    EXPECT_EQ(pool.loadOf(light).subscriptions, 3U);
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 0U);
+}
+
+TEST(SessionPool, SpillsOverTheCostCap)
+{
+    ConnectedPool pool({.sessions = 2, .maxCostPerSession = 2});
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.welcome(0));
+
+    ASSERT_TRUE(pool.pool.subscribe(request("channel.ban", 2)));
+
+    // Nothing else fits on the only connected session
+    EXPECT_FALSE(pool.pool.subscribe(request("stream.online")));
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 1U);
+    EXPECT_EQ(pool.subscriptions.get().size(), 1U);
+
+    // So it goes to the next session that connects
+    ASSERT_TRUE(pool.welcome(1));
+    ASSERT_TRUE(test::waitUntil([&] {
+        return pool.subscriptions.get().size() == 2;
+    }));
+
+    const auto placed = pool.subscriptions.get();
+    EXPECT_EQ(placed[0].sessionID, ConnectedPool::sessionID(0));
+    EXPECT_EQ(placed[1].sessionID, ConnectedPool::sessionID(1));
+    EXPECT_EQ(placed[1].type, "stream.online");
+    EXPECT_EQ(pool.loadOf(ConnectedPool::sessionID(0)).cost, 2U);
+    EXPECT_EQ(pool.loadOf(ConnectedPool::sessionID(1)).cost, 1U);
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 0U);
+}
+
+TEST(SessionPool, PlacesPendingSubscriptionsOnceASessionIsWelcomed)
+{
+    ConnectedPool pool({.sessions = 1});
+    ASSERT_TRUE(pool.accept());
+
+    // The session is connected, but Twitch hasn't given it an ID yet
+    EXPECT_FALSE(pool.pool.subscribe(request("channel.ban")));
+    EXPECT_FALSE(pool.pool.subscribe(request("stream.online")));
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 2U);
+    EXPECT_EQ(pool.pool.getConnectionCount(), 0U);
+    EXPECT_TRUE(pool.subscriptions.get().empty());
+
+    ASSERT_TRUE(pool.welcome(0));
+    ASSERT_TRUE(test::waitUntil([&] {
+        return pool.subscriptions.get().size() == 2;
+    }));
+
+    for (const auto &placed : pool.subscriptions.get())
+    {
+        EXPECT_EQ(placed.sessionID, ConnectedPool::sessionID(0));
+    }
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 0U);
+
+    const auto loads = pool.pool.getSessionLoads();
+    ASSERT_EQ(loads.size(), 1U);
+    EXPECT_EQ(loads[0].sessionID, ConnectedPool::sessionID(0));
+    EXPECT_EQ(loads[0].subscriptions, 2U);
+    EXPECT_EQ(loads[0].cost, 2U);
+
+    // The welcome
+    EXPECT_EQ(loads[0].deliveredFrames, 1U);
+}
+
+TEST(SessionPool, MovesSubscriptionsOffADisconnectedSession)
+{
+    ConnectedPool pool({.sessions = 2});
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.accept());
+    ASSERT_TRUE(pool.welcome(0));
+    ASSERT_TRUE(pool.welcome(1));
+
+    ASSERT_TRUE(pool.pool.subscribe(request("channel.ban")));
+    ASSERT_TRUE(pool.pool.subscribe(request("stream.online")));
+    EXPECT_EQ(pool.loadOf(ConnectedPool::sessionID(0)).subscriptions, 1U);
+    EXPECT_EQ(pool.loadOf(ConnectedPool::sessionID(1)).subscriptions, 1U);
+
+    // Twitch drops the subscriptions of a lost connection
+    pool.connections[0]->drop();
+    ASSERT_TRUE(test::waitUntil([&] {
+        return pool.pool.getConnectionCount() == 1;
+    }));
+    ASSERT_TRUE(test::waitUntil([&] {
+        return pool.subscriptions.get().size() == 3;
+    }));
+
+    const auto placed = pool.subscriptions.get();
+    EXPECT_EQ(placed[2].sessionID, ConnectedPool::sessionID(1));
+    EXPECT_EQ(placed[2].type, placed[0].sessionID == ConnectedPool::sessionID(0)
+                                  ? placed[0].type
+                                  : placed[1].type);
+
+    const auto loads = pool.pool.getSessionLoads();
+    ASSERT_EQ(loads.size(), 2U);
+    for (const auto &load : loads)
+    {
+        if (load.sessionID.empty())
+        {
+            EXPECT_EQ(load.subscriptions, 0U);
+            EXPECT_EQ(load.cost, 0U);
+        }
+        else
+        {
+            EXPECT_EQ(load.sessionID, ConnectedPool::sessionID(1));
+            EXPECT_EQ(load.subscriptions, 2U);
+            EXPECT_EQ(load.cost, 2U);
+        }
+    }
+    EXPECT_EQ(pool.pool.getPendingSubscriptions(), 0U);
+}
@@ -0,0 +1,68 @@
+#include "support/connected-session.hpp"
+#include "support/frames.hpp"
+#include "support/listeners.hpp"
+#include "twitch-eventsub-ws/dispatch.hpp"
+#include "twitch-eventsub-ws/session-impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+// Dispatch templated on this type calls its callbacks without going through
+// the vtable
+class FinalListener final : public test::RecordingListener
+{
+public:
+    using RecordingListener::RecordingListener;
+};
+static_assert(std::is_final_v<FinalListener>);
+
+}  // namespace
+
+TEST(StaticDispatch, HandlesMessagesForAFinalListener)
+{
+    for (const bool wantsJSON : {true, false})
+    {
+        FinalListener listener{wantsJSON};
+
+        EXPECT_FALSE(
+            handleMessage(listener, test::welcomeFrame("welcome", "session")));
+        EXPECT_FALSE(handleMessage(
+            listener,
+            test::chatMessageFrame("1", test::chatMessageEvent("1001", "a"))));
+
+        const auto recording = listener.recording();
+        EXPECT_EQ(recording.welcomes, std::vector<std::string>{"session"});
+        ASSERT_EQ(recording.chatMessages.size(), 1U) << wantsJSON;
+        EXPECT_EQ(recording.chatMessages[0].messageID, "1");
+        EXPECT_EQ(recording.chatMessages[0].broadcasterID, "1001");
+        EXPECT_EQ(recording.notifications.size(), wantsJSON ? 1U : 0U);
+    }
+}
+
+TEST(StaticDispatch, SessionOfAFinalListener)
+{
+    test::ConnectedSession<FinalListener, BasicSession<FinalListener>> session{
+        std::make_unique<FinalListener>(false)};
+    ASSERT_TRUE(session.connect());
+
+    session.connection->send(
+        test::chatMessageFrame("1", test::chatMessageEvent("1001", "a")));
+    session.connection->send(
+        test::chatMessageFrame("2", test::chatMessageEvent("1002", "b")));
+
+    ASSERT_TRUE(session.listener.waitFor([](const auto &recording) {
+        return recording.chatMessages.size() == 2;
+    }));
+
+    const auto recording = session.listener.recording();
+    EXPECT_EQ(recording.welcomes, std::vector<std::string>{"session"});
+    EXPECT_EQ(recording.chatMessages[0].broadcasterID, "1001");
+    EXPECT_EQ(recording.chatMessages[1].broadcasterID, "1002");
+}
@@ -0,0 +1,172 @@
+#include "support/allocation-counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> count{0};
+std::atomic<std::size_t> bytes{0};
+
+void *allocate(std::size_t size)
+{
+    count.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void *allocateAligned(std::size_t size, std::align_val_t align)
+{
+    count.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+
+    const auto alignment = static_cast<std::size_t>(align);
+#ifdef _WIN32
+    return _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+    // aligned_alloc wants a multiple of the alignment
+    const auto rounded = (size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+#endif
+}
+
+void deallocateAligned(void *p)
+{
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+}  // namespace
+
+namespace eventsub::test {
+
+std::size_t allocationCount()
+{
+    return count.load(std::memory_order_relaxed);
+}
+
+std::size_t allocatedBytes()
+{
+    return bytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace eventsub::test
+
+void *operator new(std::size_t size)
+{
+    if (auto *p = allocate(size))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t & /*tag*/) noexcept
+{
+    return allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t align)
+{
+    if (auto *p = allocateAligned(size, align))
+    {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void *operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t & /*tag*/) noexcept
+{
+    return allocateAligned(size, align);
+}
+
+void *operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t & /*tag*/) noexcept
+{
+    return allocateAligned(size, align);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t /*size*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t & /*tag*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t & /*tag*/) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::align_val_t /*align*/) noexcept
+{
+    deallocateAligned(p);
+}
+
+void operator delete[](void *p, std::align_val_t /*align*/) noexcept
+{
+    deallocateAligned(p);
+}
+
+void operator delete(void *p, std::size_t /*size*/,
+                     std::align_val_t /*align*/) noexcept
+{
+    deallocateAligned(p);
+}
+
+void operator delete[](void *p, std::size_t /*size*/,
+                       std::align_val_t /*align*/) noexcept
+{
+    deallocateAligned(p);
+}
+
+void operator delete(void *p, std::align_val_t /*align*/,
+                     const std::nothrow_t & /*tag*/) noexcept
+{
+    deallocateAligned(p);
+}
+
+void operator delete[](void *p, std::align_val_t /*align*/,
+                       const std::nothrow_t & /*tag*/) noexcept
+{
+    deallocateAligned(p);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Counts the heap allocations made through the global operator new.
+ *
+ * Only works in executables that link allocation-counter.cpp, which replaces
+ * operator new & delete for the whole program
+ **/
+namespace eventsub::test {
+
+// The number of allocations made so far, by any thread
+std::size_t allocationCount();
+
+// The number of bytes allocated so far, by any thread
+std::size_t allocatedBytes();
+
+// Counts the allocations made while it's alive
+class AllocationCounter
+{
+public:
+    AllocationCounter()
+        : startCount(allocationCount())
+        , startBytes(allocatedBytes())
+    {
+    }
+
+    std::size_t allocations() const
+    {
+        return allocationCount() - this->startCount;
+    }
+
+    std::size_t bytes() const
+    {
+        return allocatedBytes() - this->startBytes;
+    }
+
+private:
+    const std::size_t startCount;
+    const std::size_t startBytes;
+};
+
+}  // namespace eventsub::test
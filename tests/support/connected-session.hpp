@@ -0,0 +1,133 @@
+#pragma once
+
+#include "support/frames.hpp"
+#include "support/io-thread.hpp"
+#include "support/listeners.hpp"
+#include "support/mock-server.hpp"
+#include "twitch-eventsub-ws/session.hpp"
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace eventsub::test {
+
+namespace detail {
+
+// The coroutine keeps the session alive until the io_context destroys it
+template <typename SessionT>
+boost::asio::awaitable<void> runSession(std::shared_ptr<SessionT> session,
+                                        std::string host, std::string port,
+                                        std::string path)
+{
+    co_await session->run(std::move(host), std::move(port), std::move(path),
+                          "test");
+}
+
+}  // namespace detail
+
+/**
+ * A session connected to a MockServer of its own, for tests & benchmarks:
+ *
+ *   test::ConnectedSession session;
+ *   session->setPipeline({...});
+ *   ASSERT_TRUE(session.connect());
+ *
+ *   session.connection->send(test::chatMessageFrame(...));
+ *   session.listener.waitFor(...);
+ *
+ * SessionT is a Session (or any BasicSession), or a CoroutineSession. The
+ * session can be configured through -> until it's connected
+ **/
+template <typename ListenerT = RecordingListener, typename SessionT = Session>
+class ConnectedSession
+{
+public:
+    explicit ConnectedSession(
+        std::unique_ptr<ListenerT> _listener = std::make_unique<ListenerT>())
+        : listener(*_listener)
+        , session(this->makeSession(std::move(_listener)))
+    {
+    }
+
+    ConnectedSession(const ConnectedSession &) = delete;
+    ConnectedSession &operator=(const ConnectedSession &) = delete;
+
+    SessionT *operator->() const
+    {
+        return this->session.get();
+    }
+
+    // Run the session against the server and accept its connection.
+    // Returns false if it didn't connect
+    bool accept(const std::string &path = "/ws")
+    {
+        if constexpr (std::is_void_v<decltype(this->session->run("", "", "",
+                                                                 ""))>)
+        {
+            this->session->run(this->server.host(), this->server.port(), path,
+                               "test");
+        }
+        else
+        {
+            boost::asio::co_spawn(
+                this->ioc,
+                detail::runSession(this->session, this->server.host(),
+                                   this->server.port(), path),
+                boost::asio::detached);
+        }
+        this->io.emplace(this->ioc);
+
+        this->connection = this->server.accept();
+        return this->connection != nullptr;
+    }
+
+    // accept() the session's connection, and welcome it
+    bool connect(const std::string &sessionID = "session")
+    {
+        if (!this->accept())
+        {
+            return false;
+        }
+
+        this->connection->send(welcomeFrame("welcome", sessionID));
+        return true;
+    }
+
+    MockServer server;
+    boost::asio::ssl::context ctx{boost::asio::ssl::context::tlsv12_client};
+    boost::asio::io_context ioc;
+
+    // Owned by the session
+    ListenerT &listener;
+
+    std::shared_ptr<SessionT> session;
+    std::shared_ptr<MockConnection> connection;
+
+private:
+    std::shared_ptr<SessionT> makeSession(std::unique_ptr<ListenerT> owned)
+    {
+        if constexpr (std::is_constructible_v<SessionT,
+                                              boost::asio::io_context &,
+                                              boost::asio::ssl::context &,
+                                              std::unique_ptr<ListenerT>>)
+        {
+            return std::make_shared<SessionT>(this->ioc, this->ctx,
+                                              std::move(owned));
+        }
+        else
+        {
+            return std::make_shared<SessionT>(this->ctx, std::move(owned));
+        }
+    }
+
+    // Stops the io_context first, while everything it uses is still around
+    std::optional<IoThread> io;
+};
+
+}  // namespace eventsub::test
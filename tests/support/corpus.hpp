@@ -0,0 +1,72 @@
+#pragma once
+
+#include "support/frames.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace eventsub::test {
+
+/**
+ * The channel.chat.message events in chat-messages.txt, which are real
+ * messages captured from Twitch.
+ *
+ * Each sample in the file is the payload of a notification with its
+ * subscription left out ("...,"), so only the event is kept
+ **/
+inline std::vector<std::string> loadChatMessageEvents()
+{
+    std::ifstream file{TWITCH_EVENTSUB_WS_CORPUS};
+    if (!file)
+    {
+        throw std::runtime_error{"Unable to open " TWITCH_EVENTSUB_WS_CORPUS};
+    }
+
+    std::vector<std::string> events;
+    std::string sample;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line == "{")
+        {
+            sample.clear();
+            continue;
+        }
+        if (line == "}")
+        {
+            // "event": {...}
+            const auto begin = sample.find('{');
+            events.push_back(sample.substr(begin));
+            continue;
+        }
+        if (line == "  ...,")
+        {
+            continue;
+        }
+
+        sample += line;
+        sample += '\n';
+    }
+
+    return events;
+}
+
+// Each chat message event in a whole notification frame
+inline std::vector<std::string> loadChatMessageFrames()
+{
+    std::vector<std::string> frames;
+    const auto events = loadChatMessageEvents();
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        frames.push_back(
+            chatMessageFrame("corpus-" + std::to_string(i), events[i]));
+    }
+
+    return frames;
+}
+
+}  // namespace eventsub::test
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * Builders for the frames Twitch sends, for feeding to a parser or a session
+ **/
+namespace eventsub::test {
+
+inline std::string metadataJSON(std::string_view messageID,
+                                std::string_view messageType,
+                                std::string_view subscriptionType = {})
+{
+    std::string json = R"({"message_id":")";
+    json += messageID;
+    json += R"(","message_type":")";
+    json += messageType;
+    json += R"(","message_timestamp":"2023-05-14T12:31:47.995298776Z")";
+    if (!subscriptionType.empty())
+    {
+        json += R"(,"subscription_type":")";
+        json += subscriptionType;
+        json += R"(","subscription_version":"1")";
+    }
+    json += "}";
+
+    return json;
+}
+
+inline std::string welcomeFrame(std::string_view messageID,
+                                std::string_view sessionID,
+                                int keepaliveTimeoutSeconds = 10)
+{
+    return R"({"metadata":)" + metadataJSON(messageID, "session_welcome") +
+           R"(,"payload":{"session":{"id":")" + std::string{sessionID} +
+           R"(","status":"connected","keepalive_timeout_seconds":)" +
+           std::to_string(keepaliveTimeoutSeconds) +
+           R"(,"reconnect_url":null,)"
+           R"("connected_at":"2023-05-14T12:31:47.995262791Z"}}})";
+}
+
+inline std::string keepaliveFrame(std::string_view messageID)
+{
+    return R"({"metadata":)" + metadataJSON(messageID, "session_keepalive") +
+           R"(,"payload":{}})";
+}
+
+inline std::string reconnectFrame(std::string_view messageID,
+                                  std::string_view sessionID,
+                                  std::string_view reconnectURL)
+{
+    return R"({"metadata":)" + metadataJSON(messageID, "session_reconnect") +
+           R"(,"payload":{"session":{"id":")" + std::string{sessionID} +
+           R"(","status":"reconnecting","keepalive_timeout_seconds":null,)"
+           R"("reconnect_url":")" +
+           std::string{reconnectURL} +
+           R"(","connected_at":"2023-05-14T12:31:47.995262791Z"}}})";
+}
+
+// A notification with the given event, subscribed to for broadcasterID
+inline std::string notificationFrame(std::string_view messageID,
+                                     std::string_view subscriptionType,
+                                     std::string_view broadcasterID,
+                                     std::string_view event)
+{
+    return R"({"metadata":)" +
+           metadataJSON(messageID, "notification", subscriptionType) +
+           R"(,"payload":{"subscription":{)"
+           R"("id":"4aa632e0-fca3-590b-e981-bbd12abdb3fe","status":"enabled",)"
+           R"("type":")" +
+           std::string{subscriptionType} +
+           R"(","version":"1","condition":{"broadcaster_user_id":")" +
+           std::string{broadcasterID} +
+           R"("},"transport":{"method":"websocket",)"
+           R"("session_id":"38de428e_b11f07be"},)"
+           R"("created_at":"2023-05-20T12:30:55.518375571Z","cost":0},)"
+           R"("event":)" +
+           std::string{event} + "}}";
+}
+
+// Twitch revoking a subscription of broadcasterID
+inline std::string revocationFrame(std::string_view messageID,
+                                   std::string_view subscriptionType,
+                                   std::string_view broadcasterID)
+{
+    return R"({"metadata":)" +
+           metadataJSON(messageID, "revocation", subscriptionType) +
+           R"(,"payload":{"subscription":{)"
+           R"("id":"4aa632e0-fca3-590b-e981-bbd12abdb3fe",)"
+           R"("status":"authorization_revoked","type":")" +
+           std::string{subscriptionType} +
+           R"(","version":"1","condition":{"broadcaster_user_id":")" +
+           std::string{broadcasterID} +
+           R"("},"transport":{"method":"websocket",)"
+           R"("session_id":"38de428e_b11f07be"},)"
+           R"("created_at":"2023-05-20T12:30:55.518375571Z","cost":0}}})";
+}
+
+// The broadcaster_user_id of a channel.chat.message event
+inline std::string_view broadcasterOf(std::string_view event)
+{
+    constexpr std::string_view key = R"("broadcaster_user_id")";
+    auto pos = event.find(key);
+    if (pos == std::string_view::npos)
+    {
+        return {};
+    }
+
+    const auto begin = event.find('"', pos + key.size()) + 1;
+    const auto end = event.find('"', begin);
+    return event.substr(begin, end - begin);
+}
+
+inline std::string chatMessageFrame(std::string_view messageID,
+                                    std::string_view event)
+{
+    return notificationFrame(messageID, "channel.chat.message",
+                             broadcasterOf(event), event);
+}
+
+// A minimal channel.chat.message event
+inline std::string chatMessageEvent(std::string_view broadcasterID,
+                                    std::string_view text)
+{
+    return R"({"broadcaster_user_id":")" + std::string{broadcasterID} +
+           R"(","broadcaster_user_login":"broadcaster",)"
+           R"("broadcaster_user_name":"Broadcaster",)"
+           R"("chatter_user_id":"11148817","chatter_user_login":"pajlada",)"
+           R"("chatter_user_name":"pajlada",)"
+           R"("message_id":"218fe138-adb5-483b-87a6-dce3eaea7281",)"
+           R"("message":{"text":")" +
+           std::string{text} + R"(","fragments":[{"type":"text","text":")" +
+           std::string{text} +
+           R"(","cheermote":null,"emote":null,"mention":null}]},)"
+           R"("color":"#0000FF","badges":[],"message_type":"text",)"
+           R"("cheer":null,"reply":null,)"
+           R"("channel_points_custom_reward_id":null})";
+}
+
+}  // namespace eventsub::test
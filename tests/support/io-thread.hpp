@@ -0,0 +1,42 @@
+#pragma once
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <thread>
+
+namespace eventsub::test {
+
+/**
+ * Runs an io_context on a thread of its own until it's destroyed, so tests
+ * can wait for what a session does from the main thread
+ **/
+class IoThread
+{
+public:
+    explicit IoThread(boost::asio::io_context &_ioc)
+        : ioc(_ioc)
+        , work(boost::asio::make_work_guard(_ioc))
+        , thread([this] {
+            this->ioc.run();
+        })
+    {
+    }
+
+    ~IoThread()
+    {
+        this->ioc.stop();
+        this->thread.join();
+    }
+
+    IoThread(const IoThread &) = delete;
+    IoThread &operator=(const IoThread &) = delete;
+
+private:
+    boost::asio::io_context &ioc;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        work;
+    std::thread thread;
+};
+
+}  // namespace eventsub::test
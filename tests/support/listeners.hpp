@@ -0,0 +1,291 @@
+#pragma once
+
+#include "twitch-eventsub-ws/legacy-listener.hpp"
+#include "twitch-eventsub-ws/listener.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace eventsub::test {
+
+// A Listener that ignores everything, for tests to override what they need
+class NullListener : public Listener
+{
+public:
+    void onSessionWelcome(
+        const messages::Metadata & /*metadata*/,
+        payload::session_welcome::Payload && /*payload*/) override
+    {
+    }
+
+    void onNotification(const messages::Metadata & /*metadata*/,
+                        const boost::json::value & /*jv*/) override
+    {
+    }
+
+    // Subscription types
+    void onChannelBan(const messages::Metadata & /*metadata*/,
+                      payload::channel_ban::v1::Payload && /*payload*/) override
+    {
+    }
+
+    void onStreamOnline(
+        const messages::Metadata & /*metadata*/,
+        payload::stream_online::v1::Payload && /*payload*/) override
+    {
+    }
+
+    void onStreamOffline(
+        const messages::Metadata & /*metadata*/,
+        payload::stream_offline::v1::Payload && /*payload*/) override
+    {
+    }
+
+    void onChannelChatNotification(
+        const messages::Metadata & /*metadata*/,
+        payload::channel_chat_notification::v1::Payload && /*payload*/) override
+    {
+    }
+
+    void onChannelUpdate(
+        const messages::Metadata & /*metadata*/,
+        payload::channel_update::v1::Payload && /*payload*/) override
+    {
+    }
+
+    void onChannelChatMessage(
+        const messages::Metadata & /*metadata*/,
+        payload::channel_chat_message::v1::Payload && /*payload*/) override
+    {
+    }
+
+    // Add your new subscription types above this line
+};
+
+// The same for the old by-value interface
+class NullLegacyListener : public LegacyListener
+{
+public:
+    void onSessionWelcome(
+        messages::Metadata /*metadata*/,
+        payload::session_welcome::Payload /*payload*/) override
+    {
+    }
+
+    void onNotification(messages::Metadata /*metadata*/,
+                        const boost::json::value & /*jv*/) override
+    {
+    }
+
+    // Subscription types
+    void onChannelBan(messages::Metadata /*metadata*/,
+                      payload::channel_ban::v1::Payload /*payload*/) override
+    {
+    }
+
+    void onStreamOnline(
+        messages::Metadata /*metadata*/,
+        payload::stream_online::v1::Payload /*payload*/) override
+    {
+    }
+
+    void onStreamOffline(
+        messages::Metadata /*metadata*/,
+        payload::stream_offline::v1::Payload /*payload*/) override
+    {
+    }
+
+    void onChannelChatNotification(
+        messages::Metadata /*metadata*/,
+        payload::channel_chat_notification::v1::Payload /*payload*/) override
+    {
+    }
+
+    void onChannelUpdate(
+        messages::Metadata /*metadata*/,
+        payload::channel_update::v1::Payload /*payload*/) override
+    {
+    }
+
+    void onChannelChatMessage(
+        messages::Metadata /*metadata*/,
+        payload::channel_chat_message::v1::Payload /*payload*/) override
+    {
+    }
+
+    // Add your new subscription types above this line
+};
+
+/**
+ * A Listener that records what a session delivers to it, for tests to wait
+ * for from another thread than the one delivering
+ **/
+class RecordingListener : public NullListener
+{
+public:
+    struct ChatMessage {
+        std::string messageID;
+        std::string broadcasterID;
+
+        // The thread it was delivered on, and when
+        std::thread::id thread;
+        std::chrono::steady_clock::time_point deliveredAt;
+    };
+
+    struct Recording {
+        // The session IDs of the session_welcome messages
+        std::vector<std::string> welcomes;
+
+        // The message IDs of the notifications passed to onNotification
+        std::vector<std::string> notifications;
+
+        std::vector<ChatMessage> chatMessages;
+
+        // The size of each batch passed to onChannelChatMessages
+        std::vector<std::size_t> chatMessageBatches;
+
+        // The message IDs of the revocations
+        std::vector<std::string> revocations;
+
+        std::size_t disconnects = 0;
+    };
+
+    explicit RecordingListener(bool _wantsJSON = true)
+        : wantsJSON(_wantsJSON)
+    {
+    }
+
+    bool wantsNotificationJSON() const override
+    {
+        return this->wantsJSON;
+    }
+
+    void onSessionWelcome(const messages::Metadata & /*metadata*/,
+                          payload::session_welcome::Payload &&payload) override
+    {
+        this->record([&](Recording &recording) {
+            recording.welcomes.push_back(std::move(payload.id));
+        });
+    }
+
+    void onDisconnected(const boost::system::error_code & /*ec*/) override
+    {
+        this->record([](Recording &recording) {
+            recording.disconnects++;
+        });
+    }
+
+    void onNotification(const messages::Metadata &metadata,
+                        const boost::json::value & /*jv*/) override
+    {
+        this->record([&](Recording &recording) {
+            recording.notifications.push_back(metadata.messageID);
+        });
+    }
+
+    void onRevocation(const messages::Metadata &metadata,
+                      const boost::json::value & /*jv*/) override
+    {
+        this->record([&](Recording &recording) {
+            recording.revocations.push_back(metadata.messageID);
+        });
+    }
+
+    void onChannelChatMessage(
+        const messages::Metadata &metadata,
+        payload::channel_chat_message::v1::Payload &&payload) override
+    {
+        this->record([&](Recording &recording) {
+            recording.chatMessages.push_back({
+                .messageID = metadata.messageID,
+                .broadcasterID = std::move(payload.event.broadcasterUserID),
+                .thread = std::this_thread::get_id(),
+                .deliveredAt = std::chrono::steady_clock::now(),
+            });
+        });
+    }
+
+    void onChannelChatMessages(
+        std::span<Notification<payload::channel_chat_message::v1::Payload>>
+            batch) override
+    {
+        this->record([&](Recording &recording) {
+            recording.chatMessageBatches.push_back(batch.size());
+        });
+        Listener::onChannelChatMessages(batch);
+    }
+
+    // A copy of everything recorded so far
+    Recording recording() const
+    {
+        std::lock_guard lock(this->mutex);
+        return this->recorded;
+    }
+
+    // Wait until done(recording) returns true. Returns false on timeout
+    template <typename Predicate>
+    bool waitFor(Predicate done,
+                 std::chrono::milliseconds timeout = std::chrono::seconds{
+                     5}) const
+    {
+        std::unique_lock lock(this->mutex);
+        return this->changed.wait_for(lock, timeout, [&] {
+            return done(this->recorded);
+        });
+    }
+
+private:
+    template <typename Fn>
+    void record(Fn fn)
+    {
+        std::lock_guard lock(this->mutex);
+        fn(this->recorded);
+        this->changed.notify_all();
+    }
+
+    const bool wantsJSON;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable changed;
+    Recording recorded;
+};
+
+/**
+ * A Listener that only counts the chat messages it's handed, for benchmarks
+ * to wait for without recording anything
+ **/
+class CountingListener final : public NullListener
+{
+public:
+    void onChannelChatMessage(
+        const messages::Metadata & /*metadata*/,
+        payload::channel_chat_message::v1::Payload && /*payload*/) override
+    {
+        this->count.fetch_add(1);
+        this->count.notify_all();
+    }
+
+    // Wait until total chat messages have been handed over
+    void waitFor(std::size_t total) const
+    {
+        auto current = this->count.load();
+        while (current < total)
+        {
+            this->count.wait(current);
+            current = this->count.load();
+        }
+    }
+
+private:
+    std::atomic<std::size_t> count{0};
+};
+
+}  // namespace eventsub::test
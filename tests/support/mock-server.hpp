@@ -0,0 +1,108 @@
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace eventsub::test {
+
+/**
+ * One WebSocket connection accepted by the MockServer.
+ *
+ * Frames are sent in the order send() is called. Whatever the client sends
+ * is read & discarded
+ **/
+class MockConnection : public std::enable_shared_from_this<MockConnection>
+{
+public:
+    using Stream = boost::beast::websocket::stream<
+        boost::beast::ssl_stream<boost::beast::tcp_stream>>;
+
+    MockConnection(Stream _ws, std::string _path);
+
+    // The path (and query) the client connected to
+    const std::string &path() const;
+
+    void send(std::string frame);
+
+    // Close the WebSocket once everything sent so far has been written
+    void close();
+
+    // Drop the TCP connection without closing the WebSocket
+    void drop();
+
+    // Wait until the connection is gone, from either side
+    bool waitClosed(std::chrono::milliseconds timeout);
+
+private:
+    friend class MockServer;
+
+    void start();
+    void read();
+    void write();
+    void onClosed();
+
+    Stream ws;
+    const std::string requestPath;
+
+    boost::beast::flat_buffer readBuffer;
+    std::deque<std::string> outgoing;
+    bool writing = false;
+    bool closing = false;
+
+    std::mutex mutex;
+    std::condition_variable closedChanged;
+    bool closed = false;
+};
+
+/**
+ * A local WebSocket server for sessions to connect to instead of Twitch.
+ *
+ * It listens on 127.0.0.1 on a free port, with a self-signed certificate, and
+ * runs on its own thread. Tests accept() the connections a session makes and
+ * send it frames through them
+ **/
+class MockServer
+{
+public:
+    MockServer();
+    ~MockServer();
+
+    MockServer(const MockServer &) = delete;
+    MockServer &operator=(const MockServer &) = delete;
+
+    std::string host() const;
+    std::string port() const;
+
+    // The wss:// URL of the given path on this server
+    std::string url(const std::string &path) const;
+
+    // Wait for the next connection. Returns nullptr on timeout
+    std::shared_ptr<MockConnection> accept(
+        std::chrono::milliseconds timeout = std::chrono::seconds{5});
+
+private:
+    void doAccept();
+    void handshake(boost::asio::ip::tcp::socket socket);
+
+    boost::asio::io_context ioc;
+    boost::asio::ssl::context ctx;
+    boost::asio::ip::tcp::acceptor acceptor;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable acceptedChanged;
+    std::deque<std::shared_ptr<MockConnection>> accepted;
+};
+
+}  // namespace eventsub::test
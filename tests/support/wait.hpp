@@ -0,0 +1,26 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+namespace eventsub::test {
+
+// Poll for things a session doesn't tell its listener about. Returns false
+// if done() doesn't return true within the timeout
+template <typename Predicate>
+bool waitUntil(Predicate done,
+               std::chrono::milliseconds timeout = std::chrono::seconds{5})
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+}  // namespace eventsub::test
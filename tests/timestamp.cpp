@@ -0,0 +1,109 @@
+#include "twitch-eventsub-ws/timestamp.hpp"
+
+#include "twitch-eventsub-ws/chrono.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eventsub;
+
+namespace {
+
+constexpr auto RAW = "2023-05-14T12:31:47.995298776Z";
+
+}  // namespace
+
+TEST(Timestamp, IsParsedOnFirstUse)
+{
+    const Timestamp timestamp{RAW};
+    EXPECT_FALSE(timestamp.isParsed());
+    EXPECT_EQ(timestamp.raw(), RAW);
+
+    EXPECT_EQ(timestamp.timePoint(), parseISO8601(RAW));
+    EXPECT_TRUE(timestamp.isParsed());
+
+    // The cached value from now on
+    EXPECT_EQ(timestamp.timePoint(), parseISO8601(RAW));
+    EXPECT_EQ(timestamp.raw(), RAW);
+}
+
+TEST(Timestamp, CopiesKeepWhatHasBeenParsed)
+{
+    const Timestamp unparsed{RAW};
+    const Timestamp parsed{RAW};
+    parsed.timePoint();
+
+    const Timestamp copy{parsed};
+    EXPECT_TRUE(copy.isParsed());
+    EXPECT_EQ(copy.timePoint(), parsed.timePoint());
+
+    Timestamp moved{Timestamp{unparsed}};
+    EXPECT_FALSE(moved.isParsed());
+    EXPECT_EQ(moved.raw(), RAW);
+
+    moved = copy;
+    EXPECT_TRUE(moved.isParsed());
+}
+
+TEST(Timestamp, AssigningStartsOver)
+{
+    Timestamp timestamp{RAW};
+    timestamp.timePoint();
+
+    timestamp.assign("1970-01-01T00:00:01Z");
+    EXPECT_FALSE(timestamp.isParsed());
+    EXPECT_EQ(timestamp.timePoint(),
+              std::chrono::system_clock::time_point{std::chrono::seconds{1}});
+}
+
+TEST(Timestamp, InvalidTimestampsAreTheEpoch)
+{
+    for (const auto *raw : {"", "not a timestamp", "2023-13-45T99:99:99Z"})
+    {
+        const Timestamp timestamp{raw};
+        EXPECT_EQ(timestamp.timePoint(),
+                  std::chrono::system_clock::time_point{})
+            << raw;
+
+        // ... which is cached like any other value
+        EXPECT_TRUE(timestamp.isParsed()) << raw;
+        EXPECT_EQ(timestamp.raw(), raw);
+    }
+}
+
+TEST(Timestamp, CanBeParsedByManyThreadsAtOnce)
+{
+    constexpr std::size_t THREADS = 8;
+    const auto expected = parseISO8601(RAW);
+
+    for (int round = 0; round < 100; round++)
+    {
+        const Timestamp timestamp{RAW};
+        std::latch start{THREADS};
+        std::vector<std::chrono::system_clock::time_point> results(THREADS);
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < THREADS; i++)
+        {
+            threads.emplace_back([&, i] {
+                start.arrive_and_wait();
+                results[i] = timestamp.timePoint();
+            });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const auto &result : results)
+        {
+            EXPECT_EQ(result, expected);
+        }
+        EXPECT_TRUE(timestamp.isParsed());
+    }
+}